@@ -35,7 +35,18 @@ void Kernel::Lock::lock()
 		            " error: re-entered lock. Kernel exception?!");
 	}
 
-	while (!Genode::cmpxchg((volatile int*)&_locked, UNLOCKED, LOCKED)) { ; }
+	/*
+	 * Spin on reading the lock value and attempt the atomic operation only
+	 * once the lock appears to be free. While spinning, the CPUs thereby
+	 * share the cache line of the lock instead of bouncing it between each
+	 * other with each attempt.
+	 */
+	for (;;) {
+		while (_locked == LOCKED) { ; }
+
+		if (Genode::cmpxchg((volatile int*)&_locked, UNLOCKED, LOCKED))
+			break;
+	}
 
 	_current_cpu = Cpu::executing_id();
 }
@@ -27,43 +27,75 @@ Timer::Irq::Irq(unsigned id, Cpu &cpu)
 : Kernel::Irq(id, cpu.irq_pool()), _cpu(cpu) {}
 
 
+Timeout::~Timeout()
+{
+	if (_timer)
+		_timer->remove(*this);
+}
+
+
 time_t Timer::timeout_max_us() const
 {
 	return ticks_to_us(_max_value());
 }
 
 
+void Timer::_insert(Timeout &timeout)
+{
+	/* insert the timeout in front of the first one that ends later */
+	Timeout *next = _first;
+	while (next && next->_end < timeout._end)
+		next = next->_next;
+
+	Timeout *prev = next ? next->_prev : _last;
+
+	timeout._prev  = prev;
+	timeout._next  = next;
+	timeout._timer = this;
+
+	if (prev) prev->_next = &timeout;
+	else      _first      = &timeout;
+
+	if (next) next->_prev = &timeout;
+	else      _last       = &timeout;
+}
+
+
+void Timer::remove(Timeout &timeout)
+{
+	if (timeout._timer != this)
+		return;
+
+	if (timeout._prev) timeout._prev->_next = timeout._next;
+	else               _first               = timeout._next;
+
+	if (timeout._next) timeout._next->_prev = timeout._prev;
+	else               _last                = timeout._prev;
+
+	timeout._prev  = nullptr;
+	timeout._next  = nullptr;
+	timeout._timer = nullptr;
+}
+
+
 void Timer::set_timeout(Timeout * const timeout, time_t const duration)
 {
 	/*
 	 * Remove timeout if it is already in use. Timeouts may get overridden as
 	 * result of an update.
 	 */
-	if (timeout->_listed) {
-		_timeout_list.remove(timeout);
-	} else {
-		timeout->_listed = true; }
+	remove(*timeout);
 
-	/* set timeout parameters */
 	timeout->_end = time() + duration;
 
-	/*
-	 * Insert timeout. Timeouts are ordered ascending according to their end
-	 * time to be able to quickly determine the nearest timeout.
-	 */
-	Timeout * t1 = 0;
-	for (Timeout * t2 = _timeout_list.first();
-	     t2 && t2->_end < timeout->_end;
-	     t1 = t2, t2 = t2->next()) { }
-
-	_timeout_list.insert(timeout, t1);
+	_insert(*timeout);
 }
 
 
 void Timer::schedule_timeout()
 {
 	/* get the timeout with the nearest end time */
-	Timeout * timeout = _timeout_list.first();
+	Timeout * timeout = _first;
 	assert(timeout);
 
 	/* install timeout at timer hardware */
@@ -80,11 +112,10 @@ void Timer::process_timeouts()
 	 */
 	time_t t = time();
 	while (true) {
-		Timeout * const timeout = _timeout_list.first();
+		Timeout * const timeout = _first;
 		if (!timeout) { break; }
 		if (timeout->_end > t) { break; }
-		_timeout_list.remove(timeout);
-		timeout->_listed = false;
+		remove(*timeout);
 		timeout->timeout_triggered();
 	}
 }
@@ -18,9 +18,6 @@
 #include <kernel/types.h>
 #include <kernel/irq.h>
 
-/* Genode includes */
-#include <util/list.h>
-
 /* Core includes */
 #include <timer_driver.h>
 
@@ -34,24 +31,40 @@ namespace Kernel
 /**
  * A timeout causes a kernel pass and the call of a timeout specific handle
  */
-class Kernel::Timeout : Genode::List<Timeout>::Element
+class Kernel::Timeout
 {
 	friend class Timer;
-	friend class Genode::List<Timeout>;
 
 	private:
 
-		bool   _listed     = false;
-		time_t _end        = 0;
+		/*
+		 * Noncopyable
+		 */
+		Timeout(Timeout const &);
+		Timeout &operator = (Timeout const &);
+
+		Timer   *_timer      = nullptr;
+		Timeout *_prev       = nullptr;
+		Timeout *_next       = nullptr;
+		time_t   _end        = 0;
 
 	public:
 
+		Timeout() { }
+
 		/**
 		 * Callback handle
 		 */
 		virtual void timeout_triggered() { }
 
-		virtual ~Timeout() { }
+		/**
+		 * Destructor
+		 *
+		 * A timeout may get destructed on another CPU than the one of its
+		 * timer, e.g., if a thread is deleted remotely. Like any other access
+		 * to a timer, this must happen with the kernel lock held.
+		 */
+		virtual ~Timeout();
 };
 
 /**
@@ -74,13 +87,29 @@ class Kernel::Timer
 				void occurred() override;
 		};
 
+		/*
+		 * Noncopyable
+		 */
+		Timer(Timer const &);
+		Timer &operator = (Timer const &);
+
 		using Driver = Timer_driver;
 
-		Driver                _driver;
-		Irq                   _irq;
-		time_t                _time = 0;
-		time_t                _last_timeout_duration;
-		Genode::List<Timeout> _timeout_list {};
+		Driver   _driver;
+		Irq      _irq;
+		time_t   _time = 0;
+		time_t   _last_timeout_duration;
+
+		/*
+		 * Timeouts are kept in a doubly-linked list sorted by their end
+		 * time. The nearest timeout is thereby at hand and a timeout can
+		 * be removed in constant time, which matters because the timeout
+		 * of the CPU scheduler is updated at each scheduling pass.
+		 */
+		Timeout *_first = nullptr;
+		Timeout *_last  = nullptr;
+
+		void _insert(Timeout &timeout);
 
 		void _start_one_shot(time_t const ticks);
 
@@ -100,6 +129,8 @@ class Kernel::Timer
 
 		void set_timeout(Timeout * const timeout, time_t const duration);
 
+		void remove(Timeout &timeout);
+
 		time_t us_to_ticks(time_t const us) const;
 
 		time_t ticks_to_us(time_t const ticks) const;
@@ -199,7 +199,7 @@ Native_pd_component::~Native_pd_component()
 void Native_pd_component::start(Capability<Dataspace> binary)
 {
 	/* lookup binary dataspace */
-	_pd_session._ep.apply(binary, [&] (Dataspace_component *ds) {
+	_pd_session._ds_ep.apply(binary, [&] (Dataspace_component *ds) {
 
 		if (ds)
 			_start(*ds);
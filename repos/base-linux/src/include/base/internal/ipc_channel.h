@@ -0,0 +1,114 @@
+/*
+ * \brief  Shared-memory channel for the RPC fast path on Linux
+ * \author agent
+ * \date   2026-10-19
+ *
+ * A client thread that repeatedly calls the same entrypoint obtains a
+ * shared-memory buffer from the server. Request and reply payloads are
+ * exchanged via this buffer. The server is woken up by a tiny datagram on
+ * the entrypoint socket and the client waits for the reply on a futex
+ * located in the buffer. Hence, the common call/reply path does not need
+ * to create, transfer, and close a reply socket for each call. Calls that
+ * transfer capabilities still take the socket path.
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+#ifndef _INCLUDE__BASE__INTERNAL__IPC_CHANNEL_H_
+#define _INCLUDE__BASE__INTERNAL__IPC_CHANNEL_H_
+
+#include <base/stdint.h>
+
+namespace Genode {
+
+	struct Ipc_channel_buffer;
+	struct Ipc_channel;
+	struct Ipc_channels;
+
+	/**
+	 * Unmap the buffers and close the sockets of all channels of a thread
+	 */
+	void release_ipc_channels(Ipc_channels &);
+}
+
+
+/**
+ * Layout of the memory shared between client and server
+ */
+struct Genode::Ipc_channel_buffer
+{
+	enum { SIZE = 8192 };
+
+	enum State {
+		IDLE             = 0,
+		REQUEST          = 1,  /* written by the client */
+		REPLY            = 2,  /* written by the server */
+		REPLY_VIA_SOCKET = 3,  /* reply with capabilities, see 'Ipc_channel' */
+	};
+
+	/* futex word, the client waits for the transition away from 'REQUEST' */
+	int state;
+
+	/* local name of invoked object (request) or exception code (reply) */
+	unsigned long protocol_word;
+
+	size_t data_size;
+
+	enum { CAPACITY = SIZE - 4*sizeof(long) };
+
+	char data[CAPACITY];
+};
+
+
+/**
+ * Client-side state of a channel to one entrypoint
+ */
+struct Genode::Ipc_channel
+{
+	/*
+	 * Global ID of the entrypoint, -1 if the channel slot is unused
+	 *
+	 * The channel is not keyed by the entrypoint socket because the
+	 * descriptor number may be reused for another entrypoint once the
+	 * socket got closed.
+	 */
+	int dst_id = -1;
+
+	/*
+	 * Local end of a socket pair whose remote end is owned by the server
+	 *
+	 * The server uses the socket for replies that carry capabilities. The
+	 * socket also allows both sides to detect the disappearance of the
+	 * peer.
+	 */
+	int reply_sd = -1;
+
+	/* identifier of the channel at the server, 0 if unavailable */
+	unsigned long cookie = 0;
+
+	Ipc_channel_buffer *buffer = nullptr;
+
+	unsigned long last_used = 0;
+
+	bool ready() const { return buffer != nullptr; }
+};
+
+
+/**
+ * Per-thread channels to the most recently called entrypoints
+ */
+struct Genode::Ipc_channels
+{
+	enum { MAX = 8 };
+
+	Ipc_channel channel[MAX];
+
+	unsigned long use_count = 0;
+};
+
+#endif /* _INCLUDE__BASE__INTERNAL__IPC_CHANNEL_H_ */
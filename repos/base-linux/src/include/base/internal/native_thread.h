@@ -16,6 +16,7 @@
 
 #include <base/stdint.h>
 #include <base/internal/server_socket_pair.h>
+#include <base/internal/ipc_channel.h>
 
 namespace Genode { struct Native_thread; }
 
@@ -48,6 +49,11 @@ struct Genode::Native_thread
 
 	Socket_pair socket_pair { };
 
+	/**
+	 * Shared-memory channels used by the thread as RPC client
+	 */
+	Ipc_channels ipc_channels { };
+
 	Native_thread() { }
 };
 
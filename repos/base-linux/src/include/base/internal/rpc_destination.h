@@ -22,8 +22,17 @@ namespace Genode {
 	{
 		int socket = -1;
 
+		/*
+		 * Shared-memory channel of the caller, used for reply capabilities
+		 * only, see 'ipc_channel.h'
+		 */
+		unsigned long channel = 0;
+
 		explicit Rpc_destination(int socket) : socket(socket) { }
 
+		Rpc_destination(int socket, unsigned long channel)
+		: socket(socket), channel(channel) { }
+
 		Rpc_destination() { }
 	};
 
@@ -35,6 +44,8 @@ namespace Genode {
 	static void print(Output &out, Rpc_destination const &dst)
 	{
 		Genode::print(out, "socket=", dst.socket);
+		if (dst.channel)
+			Genode::print(out, ", channel=", Hex(dst.channel));
 	}
 }
 
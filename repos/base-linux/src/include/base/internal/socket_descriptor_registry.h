@@ -102,6 +102,23 @@ class Genode::Socket_descriptor_registry
 
 	public:
 
+		/**
+		 * Return global ID associated with socket descriptor, or -1
+		 */
+		int global_id(int sd) const
+		{
+			if (sd == -1)
+				return -1;
+
+			Genode::Lock::Guard guard(_lock);
+
+			for (unsigned i = 0; i < MAX_FDS; i++)
+				if (_entries[i].fd == sd)
+					return _entries[i].global_id;
+
+			return -1;
+		}
+
 		void disassociate(int sd)
 		{
 			Genode::Lock::Guard guard(_lock);
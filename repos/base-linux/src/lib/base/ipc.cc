@@ -25,6 +25,7 @@
 #include <base/internal/ipc_server.h>
 #include <base/internal/server_socket_pair.h>
 #include <base/internal/capability_space_tpl.h>
+#include <base/internal/ipc_channel.h>
 
 /* Linux includes */
 #include <linux_syscalls.h>
@@ -72,6 +73,20 @@ struct Protocol_header
 	/* badges of the transferred capability arguments */
 	unsigned long badges[Msgbuf_base::MAX_CAPS_PER_MSG];
 
+	/*
+	 * Shared-memory channel, see 'ipc_channel.h'
+	 *
+	 * On call, 'channel_op' tells whether the client offers a reply socket
+	 * for a new channel (SETUP) or whether the request resides in the
+	 * buffer of the channel named by 'channel_cookie' (CALL). On the reply
+	 * to a SETUP call, 'channel_cookie' is the identifier of the new
+	 * channel, or 0 if the server declined the offer.
+	 */
+	enum Channel_op { CHANNEL_NONE, CHANNEL_SETUP, CHANNEL_CALL };
+
+	unsigned long channel_op;
+	unsigned long channel_cookie;
+
 	enum { INVALID_BADGE = ~1UL };
 
 	void *msg_start() { return &protocol_word; }
@@ -104,6 +119,7 @@ Genode::Ep_socket_descriptor_registry &Genode::ep_sd_registry()
 
 enum {
 	LX_EINTR        = 4,
+	LX_ETIMEDOUT    = 110,
 	LX_ECONNREFUSED = 111
 };
 
@@ -329,24 +345,424 @@ static void extract_sds_from_message(unsigned start_index,
 }
 
 
+/*********************************
+ ** Shared-memory channel setup **
+ *********************************/
+
+/**
+ * Return true unless the peer of the connected socket 'sd' vanished
+ */
+static bool peer_alive(int sd)
+{
+	char   byte  = 0;
+	iovec  iov   { &byte, sizeof(byte) };
+	msghdr msg   { };
+	msg.msg_iov    = &iov;
+	msg.msg_iovlen = 1;
+
+	return lx_recvmsg(sd, &msg, MSG_PEEK | MSG_DONTWAIT) != 0;
+}
+
+
+static bool mmap_failed(void *addr)
+{
+	return ((long)addr < 0) && ((long)addr > -4095);
+}
+
+
+namespace {
+
+	/**
+	 * Server-side channels of the component
+	 *
+	 * The registry is shared by all entrypoints because a reply may be
+	 * issued by a thread other than the one that received the request,
+	 * e.g., via 'Rpc_entrypoint::reply_signal_info'.
+	 */
+	class Channel_registry
+	{
+		private:
+
+			/*
+			 * The lower bits of a cookie hold the index of the entry, the
+			 * upper bits are random so that a client cannot guess the
+			 * cookie of another client's channel
+			 */
+			enum { SLOT_BITS = 8, MAX_CHANNELS = 1 << SLOT_BITS };
+
+			struct Entry
+			{
+				Ipc_channel_buffer *buffer   = nullptr;
+				int                 reply_sd = -1;
+				int                 memfd    = -1;
+				unsigned long       cookie   = 0;
+
+				bool free() const { return buffer == nullptr; }
+			};
+
+			Entry _entries[MAX_CHANNELS];
+			Lock  _lock { };
+
+			static void _release(Entry &entry)
+			{
+				lx_munmap(entry.buffer, Ipc_channel_buffer::SIZE);
+				lx_close(entry.reply_sd);
+
+				if (entry.memfd >= 0)
+					lx_close(entry.memfd);
+
+				entry = Entry();
+			}
+
+			Entry *_free_entry()
+			{
+				for (unsigned i = 0; i < MAX_CHANNELS; i++)
+					if (_entries[i].free())
+						return &_entries[i];
+
+				return nullptr;
+			}
+
+			/**
+			 * Release channels of clients that no longer exist
+			 */
+			void _reap()
+			{
+				for (unsigned i = 0; i < MAX_CHANNELS; i++)
+					if (!_entries[i].free() && !peer_alive(_entries[i].reply_sd))
+						_release(_entries[i]);
+			}
+
+			Entry *_lookup(unsigned long cookie)
+			{
+				Entry &entry = _entries[cookie & (MAX_CHANNELS - 1)];
+
+				return (cookie && entry.cookie == cookie) ? &entry : nullptr;
+			}
+
+		public:
+
+			/**
+			 * Create channel for the client-provided reply socket
+			 *
+			 * \return cookie of the new channel, or 0 if no channel could
+			 *         be created
+			 *
+			 * On success, the registry takes over the ownership of
+			 * 'reply_sd'.
+			 */
+			unsigned long create(int reply_sd)
+			{
+				Lock::Guard guard(_lock);
+
+				Entry *entry = _free_entry();
+				if (!entry) {
+					_reap();
+					entry = _free_entry();
+				}
+				if (!entry)
+					return 0;
+
+				unsigned long random = 0;
+				if (lx_getrandom(&random, sizeof(random)) != sizeof(random))
+					return 0;
+
+				unsigned long const index  = entry - _entries;
+				unsigned long const cookie = (random << SLOT_BITS) | index;
+				if (!cookie)
+					return 0;
+
+				int const fd = lx_memfd_create("ipc_channel", LX_MFD_CLOEXEC
+				                                            | LX_MFD_ALLOW_SEALING);
+				if (fd < 0)
+					return 0;
+
+				/* keep the client from resizing the buffer under our feet */
+				int const seals = LX_F_SEAL_SHRINK | LX_F_SEAL_GROW | LX_F_SEAL_SEAL;
+
+				void *addr = nullptr;
+				if (lx_ftruncate(fd, Ipc_channel_buffer::SIZE) < 0
+				 || lx_fcntl(fd, LX_F_ADD_SEALS, seals) < 0
+				 || mmap_failed(addr = lx_mmap(nullptr, Ipc_channel_buffer::SIZE,
+				                               PROT_READ | PROT_WRITE, MAP_SHARED,
+				                               fd, 0))) {
+					lx_close(fd);
+					return 0;
+				}
+
+				entry->buffer   = (Ipc_channel_buffer *)addr;
+				entry->reply_sd = reply_sd;
+				entry->memfd    = fd;
+				entry->cookie   = cookie;
+
+				return entry->cookie;
+			}
+
+			/**
+			 * Hand out the memory file of the channel to be sent to the client
+			 *
+			 * \return file descriptor owned by the caller, or -1
+			 */
+			int take_memfd(unsigned long cookie)
+			{
+				Lock::Guard guard(_lock);
+
+				Entry *entry = _lookup(cookie);
+				if (!entry)
+					return -1;
+
+				int const fd = entry->memfd;
+				entry->memfd = -1;
+				return fd;
+			}
+
+			/**
+			 * Call 'fn' with buffer and reply socket of the channel
+			 *
+			 * The functor is called with the registry locked, which keeps
+			 * the buffer from being unmapped meanwhile.
+			 */
+			template <typename FN>
+			void apply(unsigned long cookie, FN const &fn)
+			{
+				Lock::Guard guard(_lock);
+
+				Entry *entry = _lookup(cookie);
+				if (entry)
+					fn(*entry->buffer, entry->reply_sd);
+			}
+	};
+
+	Channel_registry &channel_registry()
+	{
+		static Channel_registry registry;
+		return registry;
+	}
+}
+
+
+static int channel_state(Ipc_channel_buffer const &buffer)
+{
+	return __atomic_load_n(&buffer.state, __ATOMIC_ACQUIRE);
+}
+
+
+static void channel_state(Ipc_channel_buffer &buffer, int state)
+{
+	__atomic_store_n(&buffer.state, state, __ATOMIC_RELEASE);
+}
+
+
+static void release_channel(Ipc_channel &channel)
+{
+	if (channel.buffer)
+		lx_munmap(channel.buffer, Ipc_channel_buffer::SIZE);
+
+	if (channel.reply_sd >= 0)
+		lx_close(channel.reply_sd);
+
+	channel = Ipc_channel();
+}
+
+
+void Genode::release_ipc_channels(Ipc_channels &channels)
+{
+	for (unsigned i = 0; i < Ipc_channels::MAX; i++)
+		release_channel(channels.channel[i]);
+}
+
+
+/**
+ * Return channel of the calling thread to the entrypoint with ID 'dst_id'
+ *
+ * If no channel exists, the least recently used slot is assigned to
+ * 'dst_id' and 'fresh' is set to true.
+ */
+static Ipc_channel &client_channel(Ipc_channels &channels, int dst_id, bool &fresh)
+{
+	Ipc_channel *victim = &channels.channel[0];
+
+	for (unsigned i = 0; i < Ipc_channels::MAX; i++) {
+
+		Ipc_channel &channel = channels.channel[i];
+
+		if (channel.dst_id == dst_id) {
+			channel.last_used = ++channels.use_count;
+			fresh = false;
+			return channel;
+		}
+
+		if (channel.last_used < victim->last_used)
+			victim = &channel;
+	}
+
+	release_channel(*victim);
+
+	victim->dst_id    = dst_id;
+	victim->last_used = ++channels.use_count;
+	fresh = true;
+	return *victim;
+}
+
+
+/**
+ * Reply socket pair offered to the server along with a SETUP call
+ */
+struct Channel_offer
+{
+	enum { LOCAL_SOCKET = 0, REMOTE_SOCKET = 1 };
+	int sd[2] { -1, -1 };
+
+	Channel_offer(bool enabled)
+	{
+		if (enabled && lx_socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0, sd) < 0)
+			sd[LOCAL_SOCKET] = sd[REMOTE_SOCKET] = -1;
+	}
+
+	~Channel_offer()
+	{
+		if (sd[LOCAL_SOCKET]  != -1) lx_close(sd[LOCAL_SOCKET]);
+		if (sd[REMOTE_SOCKET] != -1) lx_close(sd[REMOTE_SOCKET]);
+	}
+
+	bool valid() const { return sd[REMOTE_SOCKET] != -1; }
+
+	int remote_socket() const { return sd[REMOTE_SOCKET]; }
+
+	void sent()
+	{
+		lx_close(sd[REMOTE_SOCKET]);
+		sd[REMOTE_SOCKET] = -1;
+	}
+
+	/**
+	 * Complete the setup of 'channel' with the memory file sent by the server
+	 */
+	void accept(Ipc_channel &channel, unsigned long cookie, int memfd)
+	{
+		void *addr = lx_mmap(nullptr, Ipc_channel_buffer::SIZE,
+		                     PROT_READ | PROT_WRITE, MAP_SHARED, memfd, 0);
+		lx_close(memfd);
+
+		if (mmap_failed(addr))
+			return;
+
+		channel.buffer   = (Ipc_channel_buffer *)addr;
+		channel.cookie   = cookie;
+		channel.reply_sd = sd[LOCAL_SOCKET];
+		sd[LOCAL_SOCKET] = -1;
+	}
+};
+
+
+static void init_reply_header(Protocol_header &header, Rpc_exception_code exc)
+{
+	header.protocol_word  = exc.value;
+	header.channel_op     = Protocol_header::CHANNEL_NONE;
+	header.channel_cookie = 0;
+}
+
+
+/**
+ * Send reply to a client that called via a shared-memory channel
+ */
+static void channel_reply(unsigned long cookie, Rpc_exception_code exception_code,
+                          Genode::Msgbuf_base &snd_msgbuf)
+{
+	size_t const size = snd_msgbuf.data_size();
+
+	/* duplicate of the reply socket if the reply must be sent via the socket */
+	int reply_sd = -1;
+
+	channel_registry().apply(cookie, [&] (Ipc_channel_buffer &buffer, int sd) {
+
+		/* there is no call pending at the channel */
+		if (channel_state(buffer) != Ipc_channel_buffer::REQUEST)
+			return;
+
+		if (snd_msgbuf.used_caps() == 0 && size <= Ipc_channel_buffer::CAPACITY) {
+
+			buffer.protocol_word = exception_code.value;
+			buffer.data_size     = size;
+			Genode::memcpy(buffer.data, snd_msgbuf.data(), size);
+
+			channel_state(buffer, Ipc_channel_buffer::REPLY);
+
+		} else {
+
+			/*
+			 * Capabilities can be transferred via the socket only. The
+			 * client blocks on the socket until the reply arrives. The
+			 * message is sent after releasing the registry because the
+			 * send operation may block.
+			 */
+			reply_sd = lx_fcntl(sd, LX_F_DUPFD_CLOEXEC, 0);
+
+			if (reply_sd >= 0) {
+				channel_state(buffer, Ipc_channel_buffer::REPLY_VIA_SOCKET);
+			} else {
+
+				/* out of file descriptors, let the call fail */
+				buffer.protocol_word = Rpc_exception_code::INVALID_OBJECT;
+				buffer.data_size     = 0;
+				channel_state(buffer, Ipc_channel_buffer::REPLY);
+			}
+		}
+
+		lx_futex(&buffer.state, LX_FUTEX_WAKE, 1);
+	});
+
+	if (reply_sd < 0)
+		return;
+
+	Protocol_header &header = snd_msgbuf.header<Protocol_header>();
+	init_reply_header(header, exception_code);
+
+	Message msg(header.msg_start(), sizeof(Protocol_header) + size);
+	insert_sds_into_message(msg, header, snd_msgbuf);
+
+	/* a send error is caused by a disappearing client */
+	lx_sendmsg(reply_sd, msg.msg(), 0);
+
+	lx_close(reply_sd);
+}
+
+
 /**
  * Send reply to client
  */
-static inline void lx_reply(int reply_socket, Rpc_exception_code exception_code,
+static inline void lx_reply(Rpc_destination dst, Rpc_exception_code exception_code,
                             Genode::Msgbuf_base &snd_msgbuf)
 {
+	if (dst.socket < 0) {
+		if (dst.channel)
+			channel_reply(dst.channel, exception_code, snd_msgbuf);
+		return;
+	}
+
+	int const reply_socket = dst.socket;
 
 	Protocol_header &header = snd_msgbuf.header<Protocol_header>();
 
-	header.protocol_word = exception_code.value;
+	init_reply_header(header, exception_code);
 
 	Message msg(header.msg_start(), sizeof(Protocol_header) + snd_msgbuf.data_size());
 
+	/* complete the setup of a channel by handing out its memory */
+	int const memfd = dst.channel ? channel_registry().take_memfd(dst.channel) : -1;
+	if (memfd >= 0) {
+		msg.marshal_socket(memfd);
+		header.channel_cookie = dst.channel;
+	}
+
 	/* marshall capabilities to be transferred to the client */
 	insert_sds_into_message(msg, header, snd_msgbuf);
 
 	int const ret = lx_sendmsg(reply_socket, msg.msg(), 0);
 
+	if (memfd >= 0)
+		lx_close(memfd);
+
 	/* ignore reply send error caused by disappearing client */
 	if (ret >= 0 || ret == -LX_ECONNREFUSED) {
 		lx_close(reply_socket);
@@ -363,12 +779,140 @@ static inline void lx_reply(int reply_socket, Rpc_exception_code exception_code,
  ** IPC client **
  ****************/
 
+/**
+ * Perform call via the shared-memory channel
+ */
+static Rpc_exception_code channel_call(Ipc_channel &channel, int dst_socket,
+                                       unsigned long local_name,
+                                       Msgbuf_base &snd_msgbuf,
+                                       Msgbuf_base &rcv_msgbuf)
+{
+	Ipc_channel_buffer &buffer = *channel.buffer;
+
+	buffer.protocol_word = local_name;
+	buffer.data_size     = snd_msgbuf.data_size();
+	Genode::memcpy(buffer.data, snd_msgbuf.data(), snd_msgbuf.data_size());
+
+	channel_state(buffer, Ipc_channel_buffer::REQUEST);
+
+	/* wake up the server with a message that consists of the header only */
+	Protocol_header &snd_header = snd_msgbuf.header<Protocol_header>();
+	snd_header.protocol_word  = 0;
+	snd_header.num_caps       = 0;
+	snd_header.channel_op     = Protocol_header::CHANNEL_CALL;
+	snd_header.channel_cookie = channel.cookie;
+
+	Message snd_msg(snd_header.msg_start(), sizeof(Protocol_header));
+
+	int const send_ret = lx_sendmsg(dst_socket, snd_msg.msg(), 0);
+	if (send_ret < 0) {
+		raw(Pid(), " lx_sendmsg to sd ", dst_socket,
+		    " failed with ", send_ret, " in channel_call()");
+		release_channel(channel);
+		throw Genode::Ipc_error();
+	}
+
+	/*
+	 * Wait for the reply
+	 *
+	 * The timeout is used to detect the disappearance of the server, which
+	 * is indicated by the closed remote end of the reply socket.
+	 */
+	while (channel_state(buffer) == Ipc_channel_buffer::REQUEST) {
+
+		struct timespec const timeout = { 1, 0 };
+		int const ret = lx_futex_timed(&buffer.state, LX_FUTEX_WAIT,
+		                               Ipc_channel_buffer::REQUEST, &timeout);
+
+		/* system call got interrupted by a signal, abandon the channel */
+		if (ret == -LX_EINTR) {
+			release_channel(channel);
+			throw Genode::Blocking_canceled();
+		}
+
+		if (ret == -LX_ETIMEDOUT && !peer_alive(channel.reply_sd)) {
+			release_channel(channel);
+			throw Genode::Ipc_error();
+		}
+	}
+
+	rcv_msgbuf.reset();
+
+	if (channel_state(buffer) == Ipc_channel_buffer::REPLY) {
+
+		size_t const size = min(min((size_t)buffer.data_size, rcv_msgbuf.capacity()),
+		                        (size_t)Ipc_channel_buffer::CAPACITY);
+
+		Genode::memcpy(rcv_msgbuf.data(), buffer.data, size);
+
+		channel_state(buffer, Ipc_channel_buffer::IDLE);
+		return Rpc_exception_code(buffer.protocol_word);
+	}
+
+	/* reply with capabilities */
+	Protocol_header &rcv_header = rcv_msgbuf.header<Protocol_header>();
+	rcv_header.protocol_word = 0;
+
+	Message rcv_msg(rcv_header.msg_start(),
+	                sizeof(Protocol_header) + rcv_msgbuf.capacity());
+	rcv_msg.accept_sockets(Message::MAX_SDS_PER_MSG);
+
+	int const recv_ret = lx_recvmsg(channel.reply_sd, rcv_msg.msg(), 0);
+
+	if (recv_ret == -LX_EINTR) {
+		release_channel(channel);
+		throw Genode::Blocking_canceled();
+	}
+
+	if (recv_ret <= 0) {
+		raw("[", lx_getpid(), "] lx_recvmsg failed with ", recv_ret, " in channel_call()");
+		release_channel(channel);
+		throw Genode::Ipc_error();
+	}
+
+	extract_sds_from_message(0, rcv_msg, rcv_header, rcv_msgbuf);
+
+	channel_state(buffer, Ipc_channel_buffer::IDLE);
+	return Rpc_exception_code(rcv_header.protocol_word);
+}
+
+
 Rpc_exception_code Genode::ipc_call(Native_capability dst,
                                     Msgbuf_base &snd_msgbuf, Msgbuf_base &rcv_msgbuf,
                                     size_t)
 {
+	int const dst_socket = Capability_space::ipc_cap_data(dst).dst.socket;
+
+	/*
+	 * Use the shared-memory channel to the entrypoint if possible, or offer
+	 * a new channel along with the first call to the entrypoint
+	 */
+	Thread      * const myself  = Thread::myself();
+	Ipc_channel *       channel = nullptr;
+	bool                fresh   = false;
+
+	if (myself && snd_msgbuf.used_caps() == 0
+	 && snd_msgbuf.data_size() <= Ipc_channel_buffer::CAPACITY) {
+
+		/* channels exist only to entrypoints with a known global ID */
+		int const dst_id = ep_sd_registry().global_id(dst_socket);
+
+		if (dst_id != -1)
+			channel = &client_channel(myself->native_thread().ipc_channels,
+			                          dst_id, fresh);
+	}
+
+	if (channel && channel->ready())
+		return channel_call(*channel, dst_socket, dst.local_name(),
+		                    snd_msgbuf, rcv_msgbuf);
+
+	Channel_offer channel_offer(fresh);
+
 	Protocol_header &snd_header = snd_msgbuf.header<Protocol_header>();
-	snd_header.protocol_word = dst.local_name();
+	snd_header.protocol_word  = dst.local_name();
+	snd_header.channel_op     = channel_offer.valid() ? Protocol_header::CHANNEL_SETUP
+	                                                  : Protocol_header::CHANNEL_NONE;
+	snd_header.channel_cookie = 0;
 
 	Message snd_msg(snd_header.msg_start(),
 	                sizeof(Protocol_header) + snd_msgbuf.data_size());
@@ -410,11 +954,13 @@ Rpc_exception_code Genode::ipc_call(Native_capability dst,
 	/* marshal reply capability */
 	snd_msg.marshal_socket(reply_channel.remote_socket());
 
+	/* marshal reply socket of the offered channel */
+	if (channel_offer.valid())
+		snd_msg.marshal_socket(channel_offer.remote_socket());
+
 	/* marshal capabilities contained in 'snd_msgbuf' */
 	insert_sds_into_message(snd_msg, snd_header, snd_msgbuf);
 
-	int const dst_socket = Capability_space::ipc_cap_data(dst).dst.socket;
-
 	int const send_ret = lx_sendmsg(dst_socket, snd_msg.msg(), 0);
 	if (send_ret < 0) {
 		raw(Pid(), " lx_sendmsg to sd ", dst_socket,
@@ -423,9 +969,13 @@ Rpc_exception_code Genode::ipc_call(Native_capability dst,
 		throw Genode::Ipc_error();
 	}
 
+	if (channel_offer.valid())
+		channel_offer.sent();
+
 	/* receive reply */
 	Protocol_header &rcv_header = rcv_msgbuf.header<Protocol_header>();
-	rcv_header.protocol_word = 0;
+	rcv_header.protocol_word  = 0;
+	rcv_header.channel_cookie = 0;
 
 	Message rcv_msg(rcv_header.msg_start(),
 	                sizeof(Protocol_header) + rcv_msgbuf.capacity());
@@ -443,7 +993,15 @@ Rpc_exception_code Genode::ipc_call(Native_capability dst,
 		throw Genode::Ipc_error();
 	}
 
-	extract_sds_from_message(0, rcv_msg, rcv_header, rcv_msgbuf);
+	/* the server accepted the offered channel and sent its memory first */
+	unsigned start_index = 0;
+	if (fresh && rcv_header.channel_cookie && rcv_msg.num_sockets() > 0) {
+		channel_offer.accept(*channel, rcv_header.channel_cookie,
+		                     rcv_msg.socket_at_index(0));
+		start_index = 1;
+	}
+
+	extract_sds_from_message(start_index, rcv_msg, rcv_header, rcv_msgbuf);
 
 	return Rpc_exception_code(rcv_header.protocol_word);
 }
@@ -456,9 +1014,9 @@ Rpc_exception_code Genode::ipc_call(Native_capability dst,
 void Genode::ipc_reply(Native_capability caller, Rpc_exception_code exc,
                        Msgbuf_base &snd_msg)
 {
-	int const reply_socket = Capability_space::ipc_cap_data(caller).dst.socket;
+	Rpc_destination const dst = Capability_space::ipc_cap_data(caller).dst;
 
-	try { lx_reply(reply_socket, exc, snd_msg); } catch (Ipc_error) { }
+	try { lx_reply(dst, exc, snd_msg); } catch (Ipc_error) { }
 }
 
 
@@ -469,7 +1027,7 @@ Genode::Rpc_request Genode::ipc_reply_wait(Reply_capability const &last_caller,
 {
 	/* when first called, there was no request yet */
 	if (last_caller.valid() && exc.value != Rpc_exception_code::INVALID_OBJECT)
-		lx_reply(Capability_space::ipc_cap_data(last_caller).dst.socket, exc, reply_msg);
+		lx_reply(Capability_space::ipc_cap_data(last_caller).dst, exc, reply_msg);
 
 	/*
 	 * Block infinitely if called from the main thread. This may happen if the
@@ -490,6 +1048,7 @@ Genode::Rpc_request Genode::ipc_reply_wait(Reply_capability const &last_caller,
 		Native_thread &native_thread = Thread::myself()->native_thread();
 
 		request_msg.reset();
+		header.channel_op = Protocol_header::CHANNEL_NONE;
 		int const ret = lx_recvmsg(native_thread.socket_pair.server_sd, msg.msg(), 0);
 
 		/* system call got interrupted by a signal */
@@ -502,13 +1061,67 @@ Genode::Rpc_request Genode::ipc_reply_wait(Reply_capability const &last_caller,
 			continue;
 		}
 
+		/* request residing in the buffer of a shared-memory channel */
+		if (header.channel_op == Protocol_header::CHANNEL_CALL) {
+
+			/*
+			 * A wakeup carries no socket descriptors. Close any passed
+			 * along by a misbehaving client, which could otherwise
+			 * exhaust our file-descriptor table.
+			 */
+			for (unsigned i = 0; i < msg.num_sockets(); i++)
+				lx_close(msg.socket_at_index(i));
+
+			unsigned long const cookie = header.channel_cookie;
+			unsigned long       badge  = 0;
+			bool                valid  = false;
+
+			channel_registry().apply(cookie, [&] (Ipc_channel_buffer &buffer, int) {
+
+				if (channel_state(buffer) != Ipc_channel_buffer::REQUEST)
+					return;
+
+				size_t const size = min(min((size_t)buffer.data_size,
+				                            request_msg.capacity()),
+				                        (size_t)Ipc_channel_buffer::CAPACITY);
+
+				Genode::memcpy(request_msg.data(), buffer.data, size);
+
+				badge = buffer.protocol_word;
+				valid = true;
+			});
+
+			/* ignore wakeups for unknown channels */
+			if (!valid)
+				continue;
+
+			return Rpc_request(Capability_space::import(Rpc_destination(-1, cookie),
+			                                            Rpc_obj_key()), badge);
+		}
+
 		int           const reply_socket = msg.socket_at_index(0);
 		unsigned long const badge        = header.protocol_word;
 
 		/* start at offset 1 to skip the reply channel */
-		extract_sds_from_message(1, msg, header, request_msg);
+		unsigned start_index = 1;
+
+		/* create the channel offered by the client */
+		unsigned long cookie = 0;
+		if (header.channel_op == Protocol_header::CHANNEL_SETUP
+		 && msg.num_sockets() > 1) {
+
+			int const channel_sd = msg.socket_at_index(1);
+
+			cookie = channel_registry().create(channel_sd);
+			if (!cookie)
+				lx_close(channel_sd);
+
+			start_index = 2;
+		}
+
+		extract_sds_from_message(start_index, msg, header, request_msg);
 
-		return Rpc_request(Capability_space::import(Rpc_destination(reply_socket),
+		return Rpc_request(Capability_space::import(Rpc_destination(reply_socket, cookie),
 		                                            Rpc_obj_key()), badge);
 	}
 }
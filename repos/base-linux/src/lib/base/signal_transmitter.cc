@@ -0,0 +1,48 @@
+/*
+ * \brief  Linux-specific implementation of the signal transmitter
+ * \author agent
+ * \date   2026-10-19
+ *
+ * On Linux, the local name of a capability is the globally unique key of
+ * the RPC object. This allows for the detection of signal contexts managed
+ * by the transmitting component itself. Signals for such contexts are
+ * delivered directly instead of taking a round trip through core.
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+/* Genode includes */
+#include <base/env.h>
+#include <base/trace/events.h>
+#include <base/signal.h>
+
+/* base-internal includes */
+#include <base/internal/globals.h>
+
+using namespace Genode;
+
+static Pd_session *_pd;
+
+
+void Genode::init_signal_transmitter(Env &env) { _pd = &env.pd(); }
+
+
+void Signal_transmitter::submit(unsigned cnt)
+{
+	{
+		Trace::Signal_submit trace_event(cnt);
+	}
+
+	if (submit_local_signal(_context, cnt))
+		return;
+
+	if (_pd)
+		_pd->submit(_context, cnt);
+	else
+		warning("missing call of 'init_signal_submit'");
+}
@@ -132,6 +132,8 @@ void Thread::_deinit_platform_thread()
 		lx_nanosleep(&ts, 0);
 	}
 
+	release_ipc_channels(native_thread().ipc_channels);
+
 	/* inform core about the killed thread */
 	_cpu_session->kill_thread(_thread_cap);
 }
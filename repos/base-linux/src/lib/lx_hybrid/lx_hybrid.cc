@@ -555,6 +555,8 @@ Thread::~Thread()
 			        "with ", ret, " (errno=", errno, ")");
 	}
 
+	release_ipc_channels(native_thread().ipc_channels);
+
 	Thread_meta_data_created *meta_data =
 		dynamic_cast<Thread_meta_data_created *>(native_thread().meta_data);
 
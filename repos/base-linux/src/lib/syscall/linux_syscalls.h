@@ -174,6 +174,55 @@ inline int lx_getpeername(int sockfd, struct sockaddr *name, socklen_t *namelen)
 #endif /* SYS_socketcall */
 
 
+/*****************************************************
+ ** Functions used by the shared-memory IPC channel **
+ *****************************************************/
+
+enum {
+	LX_MFD_CLOEXEC       = 1,
+	LX_MFD_ALLOW_SEALING = 2,
+
+	LX_F_DUPFD_CLOEXEC = 1030,
+
+	LX_F_ADD_SEALS   = 1033,
+	LX_F_SEAL_SEAL   = 1,
+	LX_F_SEAL_SHRINK = 2,
+	LX_F_SEAL_GROW   = 4,
+};
+
+
+inline int lx_memfd_create(char const *name, unsigned flags)
+{
+#ifdef SYS_memfd_create
+	return lx_syscall(SYS_memfd_create, name, flags);
+#else
+	return -38; /* ENOSYS */
+#endif
+}
+
+
+inline int lx_ftruncate(int fd, unsigned long length)
+{
+	return lx_syscall(SYS_ftruncate, fd, length);
+}
+
+
+inline int lx_fcntl(int fd, int cmd, long arg)
+{
+	return lx_syscall(SYS_fcntl, fd, cmd, arg);
+}
+
+
+inline long lx_getrandom(void *buf, Genode::size_t len)
+{
+#ifdef SYS_getrandom
+	return lx_syscall(SYS_getrandom, buf, len, 0);
+#else
+	return -38; /* ENOSYS */
+#endif
+}
+
+
 /*******************************************
  ** Functions used by the process library **
  *******************************************/
@@ -351,6 +400,13 @@ inline int lx_futex(const int *uaddr, int op, int val)
 }
 
 
+inline int lx_futex_timed(const int *uaddr, int op, int val,
+                          struct timespec const *timeout)
+{
+	return lx_syscall(SYS_futex, uaddr, op, val, timeout, 0, 0);
+}
+
+
 /**
  * Signal set corrsponding to glibc's 'sigset_t'
  */
@@ -30,6 +30,15 @@ namespace Component
 	 */
 	Genode::size_t stack_size();
 
+	/**
+	 * Return size of the shared-memory ring for the component's LOG output
+	 *
+	 * If the size is zero or the LOG server does not support rings, each
+	 * line is written via RPC. The RAM quota for the ring is transferred
+	 * to the LOG server by a session upgrade.
+	 */
+	Genode::size_t log_ring_size();
+
 	/**
 	 * Construct component
 	 *
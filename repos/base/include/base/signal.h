@@ -100,6 +100,7 @@ class Genode::Signal
 		friend class Kernel::Signal_receiver;
 		friend class Signal_receiver;
 		friend class Signal_context;
+		friend class Signal_context_registry;
 
 		void _dec_ref_and_unlock();
 		void _inc_ref();
@@ -195,6 +196,11 @@ class Genode::Signal_context : Interface, Noncopyable
 		 */
 		List_element<Signal_context> _registry_le { this };
 
+		/**
+		 * List element in the registry's index of capability names
+		 */
+		List_element<Signal_context> _index_le { this };
+
 		/**
 		 * List element in deferred application signal list
 		 */
@@ -17,6 +17,9 @@
 #include <base/capability.h>
 #include <base/stdint.h>
 #include <base/rpc_args.h>
+#include <base/quota_guard.h>
+#include <base/signal.h>
+#include <dataspace/capability.h>
 #include <session/session.h>
 
 namespace Genode {
@@ -55,13 +58,38 @@ struct Genode::Log_session : Session
 	 */
 	virtual size_t write(String const &string) = 0;
 
+	/**
+	 * Request shared-memory ring for transferring messages
+	 *
+	 * \param size  requested size of the ring in bytes
+	 *
+	 * \throw Out_of_ram   session quota does not suffice for the ring
+	 * \throw Out_of_caps
+	 *
+	 * \return dataspace of the ring, or an invalid capability if the
+	 *         server does not support the ring
+	 *
+	 * Messages written via 'write' are output after all messages that
+	 * are pending in the ring.
+	 */
+	virtual Dataspace_capability ring(size_t) { return Dataspace_capability(); }
+
+	/**
+	 * Return signal handler to be notified about new messages in the ring
+	 */
+	virtual Signal_context_capability ring_sigh() {
+		return Signal_context_capability(); }
+
 
 	/*********************
 	 ** RPC declaration **
 	 *********************/
 
 	GENODE_RPC(Rpc_write, size_t, write, String const &);
-	GENODE_RPC_INTERFACE(Rpc_write);
+	GENODE_RPC_THROW(Rpc_ring, Dataspace_capability, ring,
+	                 GENODE_TYPE_LIST(Out_of_ram, Out_of_caps), size_t);
+	GENODE_RPC(Rpc_ring_sigh, Signal_context_capability, ring_sigh);
+	GENODE_RPC_INTERFACE(Rpc_write, Rpc_ring, Rpc_ring_sigh);
 };
 
 #endif /* _INCLUDE__LOG_SESSION__LOG_SESSION_H_ */
@@ -0,0 +1,205 @@
+/*
+ * \brief  Shared-memory ring for transferring log messages
+ * \author agent
+ * \date   2026-10-19
+ *
+ * The ring is located in a dataspace provided by the LOG server. The client
+ * is the only producer and the server is the only consumer. A message is
+ * stored as 16-bit length followed by the characters of the message. The
+ * consumer sets the 'waiting' flag before it goes to sleep. The producer
+ * notifies the consumer only if this flag is set, which batches the
+ * notifications of consecutive messages.
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+#ifndef _INCLUDE__LOG_SESSION__RING_H_
+#define _INCLUDE__LOG_SESSION__RING_H_
+
+#include <util/string.h>
+#include <cpu/atomic.h>
+#include <cpu/memory_barrier.h>
+#include <log_session/log_session.h>
+
+namespace Genode { class Log_ring; }
+
+
+class Genode::Log_ring
+{
+	public:
+
+		struct Header
+		{
+			unsigned volatile head;      /* written by the producer */
+			unsigned volatile tail;      /* written by the consumer */
+			int      volatile waiting;   /* consumer awaits a notification */
+		};
+
+		enum { LENGTH_BYTES = 2, MAX_STRING_LEN = Log_session::MAX_STRING_LEN };
+
+	private:
+
+		/*
+		 * Noncopyable
+		 */
+		Log_ring(Log_ring const &);
+		Log_ring &operator = (Log_ring const &);
+
+		Header     &_header;
+		char *const _data;
+		size_t const _size;
+
+		/* private copy of the consumer position, never read from the ring */
+		unsigned _tail = 0;
+
+		size_t _used(unsigned head, unsigned tail) const {
+			return (head + _size - tail) % _size; }
+
+		void _copy_in(unsigned pos, char const *src, size_t len)
+		{
+			for (size_t i = 0; i < len; i++)
+				_data[(pos + i) % _size] = src[i];
+		}
+
+		void _copy_out(unsigned pos, char *dst, size_t len) const
+		{
+			for (size_t i = 0; i < len; i++)
+				dst[i] = _data[(pos + i) % _size];
+		}
+
+	public:
+
+		/**
+		 * Constructor
+		 *
+		 * \param base  local address of the ring dataspace
+		 * \param size  size of the ring dataspace
+		 */
+		Log_ring(void *base, size_t size)
+		:
+			_header(*(Header *)base),
+			_data((char *)base + sizeof(Header)),
+			_size(size - sizeof(Header))
+		{ }
+
+		/**
+		 * Reset ring, called by the consumer before handing out the ring
+		 */
+		void reset()
+		{
+			_header.head = 0;
+			_header.tail = 0;
+			_header.waiting = 0;
+			_tail = 0;
+		}
+
+
+		/**************
+		 ** Producer **
+		 **************/
+
+		/**
+		 * Append message to the ring
+		 *
+		 * \return false if the message does not fit into the ring
+		 */
+		bool produce(char const *string, size_t len)
+		{
+			len = min(len, (size_t)MAX_STRING_LEN - 1);
+
+			unsigned const head = _header.head;
+			unsigned const tail = _header.tail;
+
+			if (head >= _size || tail >= _size)
+				return false;
+
+			size_t const needed = LENGTH_BYTES + len;
+			if (_size - 1 - _used(head, tail) < needed)
+				return false;
+
+			char const length[LENGTH_BYTES] { (char)(len & 0xff), (char)(len >> 8) };
+			_copy_in(head, length, LENGTH_BYTES);
+			_copy_in((head + LENGTH_BYTES) % _size, string, len);
+
+			/* make the message visible before publishing the new head */
+			memory_barrier();
+			_header.head = (head + needed) % _size;
+			return true;
+		}
+
+		/**
+		 * Return true if the consumer must be notified
+		 *
+		 * The call clears the 'waiting' flag. The atomic operation also acts
+		 * as memory barrier between the update of the head and the check.
+		 */
+		bool consumer_waiting() { return cmpxchg(&_header.waiting, 1, 0); }
+
+
+		/**************
+		 ** Consumer **
+		 **************/
+
+		/**
+		 * Call 'fn' with each pending message as null-terminated string
+		 *
+		 * The content of the ring is not trusted. On an inconsistency, the
+		 * pending messages are dropped.
+		 */
+		template <typename FN>
+		void consume(FN const &fn)
+		{
+			char buf[MAX_STRING_LEN];
+
+			for (;;) {
+				unsigned const head = _header.head;
+				if (head >= _size)
+					return;
+
+				size_t const used = _used(head, _tail);
+				if (used < LENGTH_BYTES)
+					return;
+
+				memory_barrier();
+
+				unsigned char length[LENGTH_BYTES];
+				_copy_out(_tail, (char *)length, LENGTH_BYTES);
+				size_t const len = length[0] | (length[1] << 8);
+
+				if (len >= MAX_STRING_LEN || LENGTH_BYTES + len > used) {
+					_tail = head;
+					_header.tail = _tail;
+					return;
+				}
+
+				_copy_out((_tail + LENGTH_BYTES) % _size, buf, len);
+				buf[len] = 0;
+
+				/* release the space only after the message got copied */
+				memory_barrier();
+				_tail = (_tail + LENGTH_BYTES + len) % _size;
+				_header.tail = _tail;
+
+				fn((char const *)buf);
+			}
+		}
+
+		/**
+		 * Request a notification for the next message
+		 *
+		 * \return false if messages arrived in the meantime, in this
+		 *         case, the consumer must call 'consume' again
+		 */
+		bool wait()
+		{
+			cmpxchg(&_header.waiting, 0, 1);
+			return _used(_header.head % _size, _tail) == 0;
+		}
+};
+
+#endif /* _INCLUDE__LOG_SESSION__RING_H_ */
@@ -24,8 +24,45 @@ namespace Genode {
 	 * \param size  number of bytes to copy
 	 *
 	 * \return      number of bytes not copied
+	 *
+	 * The bulk of the block is copied in 64-byte chunks via pairs of
+	 * general-purpose registers, leaving the SIMD registers untouched.
 	 */
-	inline size_t memcpy_cpu(void *, const void *, size_t size) { return size; }
+	inline size_t memcpy_cpu(void *dst, const void *src, size_t size)
+	{
+		unsigned char *d = (unsigned char *)dst, *s = (unsigned char *)src;
+
+		/* check 8 byte; alignment */
+		size_t d_align = (size_t)d & 0x7;
+		size_t s_align = (size_t)s & 0x7;
+
+		/* only same alignments work */
+		if (d_align != s_align)
+			return size;
+
+		/* copy to 8 byte alignment */
+		for (; (size > 0) && (s_align > 0) && (s_align < 8);
+		     s_align++, *d++ = *s++, size--);
+
+		/* copy 64 byte chunks */
+		for (; size >= 64; size -= 64) {
+			asm volatile ("ldp x2, x3, [%0, #0]  \n\t"
+			              "ldp x4, x5, [%0, #16] \n\t"
+			              "ldp x6, x7, [%0, #32] \n\t"
+			              "ldp x8, x9, [%0, #48] \n\t"
+			              "stp x2, x3, [%1, #0]  \n\t"
+			              "stp x4, x5, [%1, #16] \n\t"
+			              "stp x6, x7, [%1, #32] \n\t"
+			              "stp x8, x9, [%1, #48] \n\t"
+			              "add %0, %0, #64       \n\t"
+			              "add %1, %1, #64       \n\t"
+			              : "+r" (s), "+r" (d)
+			              :
+			              : "x2", "x3", "x4", "x5", "x6", "x7", "x8", "x9",
+			                "memory");
+		}
+		return size;
+	}
 }
 
 #endif /* _INCLUDE__SPEC__ARM_64__CPU__STRING_H_ */
@@ -24,8 +24,25 @@ namespace Genode {
 	 * \param size  number of bytes to copy
 	 *
 	 * \return      number of bytes not copied
+	 *
+	 * Larger blocks are copied via 'rep movsb', which modern CPUs execute
+	 * in cache-line-sized chunks (enhanced fast strings). We refrain from
+	 * using SSE/AVX registers because this code is also used by core and
+	 * the kernel, which do not preserve the FPU state of the caller.
 	 */
-	inline size_t memcpy_cpu(void *, const void *, size_t size) { return size; }
+	inline size_t memcpy_cpu(void *dst, const void *src, size_t size)
+	{
+		enum { MIN_SIZE = 64 };
+
+		if (size < MIN_SIZE)
+			return size;
+
+		asm volatile ("rep movsb"
+		              : "+D" (dst), "+S" (src), "+c" (size)
+		              :
+		              : "memory");
+		return size;
+	}
 }
 
 #endif /* _INCLUDE__SPEC__X86__CPU__STRING_H_ */
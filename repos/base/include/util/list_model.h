@@ -7,6 +7,11 @@
  * content. The XML information is imported according to an 'Update_policy',
  * which specifies how the elements of the data model are created, destroyed,
  * and updated. The elements are ordered according to the order of XML nodes.
+ *
+ * For models with many elements, the policy may derive from
+ * 'Keyed_update_policy'. In this case, XML nodes are matched with elements
+ * via hash lookups, which makes an update linear instead of quadratic in the
+ * number of elements.
  */
 
 /*
@@ -23,6 +28,7 @@
 #include <util/xml_node.h>
 #include <util/list.h>
 #include <base/log.h>
+#include <base/allocator.h>
 
 namespace Genode { template <typename> class List_model; }
 
@@ -30,13 +36,22 @@ namespace Genode { template <typename> class List_model; }
 template <typename ELEM>
 class Genode::List_model
 {
+	public:
+
+		struct Update_policy;
+		struct Keyed_update_policy;
+
 	private:
 
 		List<ELEM> _elements { };
 
-	public:
+		template <typename POLICY>
+		inline void _update_from_xml(POLICY &, Xml_node, void const *);
 
-		struct Update_policy;
+		template <typename POLICY>
+		inline void _update_from_xml(POLICY &, Xml_node, Keyed_update_policy const *);
+
+	public:
 
 		class Element : private List<ELEM>::Element
 		{
@@ -70,7 +85,11 @@ class Genode::List_model
 		 * \throw Unknown_element_type
 		 */
 		template <typename POLICY>
-		inline void update_from_xml(POLICY &policy, Xml_node node);
+		void update_from_xml(POLICY &policy, Xml_node node)
+		{
+			/* select keyed variant if 'POLICY' is a 'Keyed_update_policy' */
+			_update_from_xml(policy, node, &policy);
+		}
 
 		/**
 		 * Call functor 'fn' for each const element
@@ -137,7 +156,8 @@ class Genode::List_model
 
 template <typename ELEM>
 template <typename POLICY>
-void Genode::List_model<ELEM>::update_from_xml(POLICY &policy, Xml_node node)
+void Genode::List_model<ELEM>::_update_from_xml(POLICY &policy, Xml_node node,
+                                                void const *)
 {
 	typedef typename POLICY::Element Element;
 
@@ -193,6 +213,147 @@ void Genode::List_model<ELEM>::update_from_xml(POLICY &policy, Xml_node node)
 }
 
 
+template <typename ELEM>
+template <typename POLICY>
+void Genode::List_model<ELEM>::_update_from_xml(POLICY &policy, Xml_node node,
+                                                Keyed_update_policy const *)
+{
+	typedef typename POLICY::Element Element;
+
+	/*
+	 * Open-addressing hash table referring to the elements of the original
+	 * list and the elements of the updated list. Slots of consumed original
+	 * elements are turned into updated ones. Hence, the table is large
+	 * enough to hold all original elements plus all newly created ones.
+	 *
+	 * The original list is dissolved up front because an element cannot be
+	 * removed from the singly-linked list in constant time.
+	 */
+	struct Slot
+	{
+		unsigned long key;
+		Element      *elem;
+		bool          updated;
+	};
+
+	size_t num_elements = 0;
+	for (Element *e = _elements.first(); e; e = e->_next())
+		num_elements++;
+
+	node.for_each_sub_node([&] (Xml_node sub_node) {
+		if (policy.node_is_element(sub_node))
+			num_elements++; });
+
+	/* keep load factor below 1/2 */
+	size_t capacity = 16;
+	while (capacity < 2*num_elements)
+		capacity *= 2;
+
+	Allocator &alloc = static_cast<Keyed_update_policy &>(policy).key_alloc;
+
+	size_t const table_size = capacity*sizeof(Slot);
+	Slot * const table = (Slot *)alloc.alloc(table_size);
+	for (size_t i = 0; i < capacity; i++)
+		table[i] = Slot { 0, nullptr, false };
+
+	auto insert = [&] (unsigned long key, Element &elem, bool updated)
+	{
+		size_t i = key & (capacity - 1);
+		while (table[i].elem)
+			i = (i + 1) & (capacity - 1);
+
+		table[i] = Slot { key, &elem, updated };
+	};
+
+	for (Element *e = _elements.first(); e; e = e->_next())
+		insert(policy.element_key(*e), *e, false);
+
+	_elements = List<ELEM>();
+
+	List<Element> updated_list;
+
+	Element *last_updated = nullptr; /* used for appending to 'updated_list' */
+
+	auto append = [&] (Element &elem)
+	{
+		updated_list.insert(&elem, last_updated);
+		last_updated = &elem;
+	};
+
+	node.for_each_sub_node([&] (Xml_node sub_node) {
+
+		/* skip XML nodes that are unrelated to the data model */
+		if (!policy.node_is_element(sub_node))
+			return;
+
+		unsigned long const key = policy.xml_node_key(sub_node);
+
+		/*
+		 * Look up an updated element, which is a duplicate, or a
+		 * corresponding element of the original list
+		 */
+		Slot *orig = nullptr;
+		for (size_t i = key & (capacity - 1); table[i].elem;
+		     i = (i + 1) & (capacity - 1)) {
+
+			Slot &slot = table[i];
+
+			if (slot.key != key
+			 || !policy.element_matches_xml_node(*slot.elem, sub_node))
+				continue;
+
+			/* update existing element with information from later node */
+			if (slot.updated) {
+				policy.update_element(*slot.elem, sub_node);
+				return;
+			}
+
+			if (!orig)
+				orig = &slot;
+		}
+
+		/* consume existing element or create new one */
+		Element *curr = nullptr;
+		if (orig) {
+			curr = orig->elem;
+			orig->updated = true;
+		} else {
+			try {
+				/* \throw Unknown_element_type */
+				curr = &policy.create_element(sub_node);
+			}
+			catch (...) {
+
+				/* retain the not yet consumed original elements */
+				for (size_t i = 0; i < capacity; i++)
+					if (table[i].elem && !table[i].updated)
+						append(*table[i].elem);
+
+				_elements = updated_list;
+				alloc.free(table, table_size);
+				throw;
+			}
+			insert(key, *curr, true);
+		}
+
+		/* append current element to 'updated_list' */
+		append(*curr);
+
+		policy.update_element(*curr, sub_node);
+	});
+
+	/* remove stale elements */
+	for (size_t i = 0; i < capacity; i++)
+		if (table[i].elem && !table[i].updated)
+			policy.destroy_element(*table[i].elem);
+
+	alloc.free(table, table_size);
+
+	/* use 'updated_list' list new data model */
+	_elements = updated_list;
+}
+
+
 /**
  * Policy interface to be supplied to 'List_model::update_from_xml'
  *
@@ -245,4 +406,44 @@ struct Genode::List_model<ELEM>::Update_policy
 	static bool node_is_element(Xml_node) { return true; }
 };
 
+
+/**
+ * Base of policies that match elements and XML nodes by key
+ *
+ * A keyed policy must provide the following functions in addition to the
+ * 'Update_policy' interface:
+ *
+ * ! static unsigned long element_key(Element const &);
+ * ! static unsigned long xml_node_key(Xml_node);
+ *
+ * An element and a matching XML node must yield the same key. The key
+ * merely narrows the candidates, 'element_matches_xml_node' remains
+ * authoritative.
+ */
+template <typename ELEM>
+struct Genode::List_model<ELEM>::Keyed_update_policy
+{
+	/**
+	 * Allocator for the temporary hash table used during an update
+	 */
+	Allocator &key_alloc;
+
+	Keyed_update_policy(Allocator &alloc) : key_alloc(alloc) { }
+
+	/**
+	 * Return key of character string, e.g., a name attribute
+	 */
+	static unsigned long key(char const *s)
+	{
+		/* FNV-1a */
+		unsigned long h = 2166136261UL;
+		for (; *s; s++)
+			h = (h ^ (unsigned char)*s) * 16777619UL;
+		return h;
+	}
+
+	template <size_t N>
+	static unsigned long key(String<N> const &s) { return key(s.string()); }
+};
+
 #endif /* _INCLUDE__UTIL__LIST_MODEL_H_ */
@@ -112,13 +112,37 @@ namespace Genode {
 	 */
 	inline void *memmove(void *dst, const void *src, size_t size)
 	{
+		typedef unsigned long word_t __attribute__((may_alias));
+		enum { LEN = sizeof(word_t), MASK = LEN - 1 };
+
 		char *d = (char *)dst, *s = (char *)src;
-		size_t i;
 
-		if (s > d)
-			for (i = 0; i < size; i++, *d++ = *s++);
-		else
-			for (s += size - 1, d += size - 1, i = size; i-- > 0; *d-- = *s--);
+		/*
+		 * Copy word-sized chunks if both buffers share the same alignment.
+		 * The distance of overlapping buffers is a multiple of the word
+		 * size in this case, so copying words in the direction of the
+		 * move never overwrites source bytes not yet read.
+		 */
+		bool const words = !(((addr_t)d ^ (addr_t)s) & MASK);
+
+		if (s > d) {
+			if (words) {
+				for (; size && ((addr_t)d & MASK); size--, *d++ = *s++);
+				for (; size >= LEN; size -= LEN, d += LEN, s += LEN)
+					*(word_t *)d = *(word_t const *)s;
+			}
+			for (; size; size--, *d++ = *s++);
+		} else {
+			d += size; s += size;
+			if (words) {
+				for (; size && ((addr_t)d & MASK); size--, *--d = *--s);
+				for (; size >= LEN; size -= LEN) {
+					d -= LEN; s -= LEN;
+					*(word_t *)d = *(word_t const *)s;
+				}
+			}
+			for (; size; size--, *--d = *--s);
+		}
 
 		return dst;
 	}
@@ -148,18 +172,8 @@ namespace Genode {
 
 		d += i; s += i; size -= i;
 
-		/* copy eight byte chunks */
-		for (i = size >> 3; i > 0; i--, *d++ = *s++,
-		                                *d++ = *s++,
-		                                *d++ = *s++,
-		                                *d++ = *s++,
-		                                *d++ = *s++,
-		                                *d++ = *s++,
-		                                *d++ = *s++,
-		                                *d++ = *s++);
-
-		/* copy left over */
-		for (i = 0; i < (size & 0x7); i++, *d++ = *s++);
+		/* copy left over, word-wise if possible */
+		memmove(d, s, size);
 
 		return dst;
 	}
@@ -212,12 +226,24 @@ namespace Genode {
 	 */
 	inline int memcmp(const void *p0, const void *p1, size_t size)
 	{
+		typedef unsigned long word_t __attribute__((may_alias));
+		enum { LEN = sizeof(word_t), MASK = LEN - 1 };
+
 		const unsigned char *c0 = (const unsigned char *)p0;
 		const unsigned char *c1 = (const unsigned char *)p1;
 
-		size_t i;
-		for (i = 0; i < size; i++)
-			if (c0[i] != c1[i]) return c0[i] - c1[i];
+		/* skip equal words if both buffers share the same alignment */
+		if (!(((addr_t)c0 ^ (addr_t)c1) & MASK)) {
+			for (; size && ((addr_t)c0 & MASK); size--, c0++, c1++)
+				if (*c0 != *c1) return *c0 - *c1;
+
+			for (; size >= LEN && *(word_t const *)c0 == *(word_t const *)c1;
+			     size -= LEN, c0 += LEN, c1 += LEN);
+		}
+
+		/* locate the differing byte */
+		for (; size; size--, c0++, c1++)
+			if (*c0 != *c1) return *c0 - *c1;
 
 		return 0;
 	}
@@ -232,7 +258,26 @@ namespace Genode {
 	 */
 	inline void *memset(void *dst, int i, size_t size)
 	{
-		while (size--) ((char *)dst)[size] = i;
+		typedef unsigned long word_t __attribute__((may_alias));
+		enum { LEN = sizeof(word_t), MASK = LEN - 1 };
+
+		char *d = (char *)dst;
+
+		/* write until word aligned */
+		for (; size && ((addr_t)d & MASK); size--, *d++ = (char)i);
+
+		/* write word-sized chunks */
+		word_t word = (unsigned char)i;
+		word |= word << 8;
+		word |= word << 16;
+		word |= (word << 16) << 16;
+
+		for (; size >= LEN; size -= LEN, d += LEN)
+			*(word_t *)d = word;
+
+		/* write left over */
+		for (; size; size--, *d++ = (char)i);
+
 		return dst;
 	}
 
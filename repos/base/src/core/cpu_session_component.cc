@@ -66,7 +66,8 @@ Thread_capability Cpu_session_component::create_thread(Capability<Pd_session> pd
 				_priority, utcb);
 	};
 
-	try { _thread_ep.apply(pd_cap, create_thread_lambda); }
+	/* PD sessions are served by the entrypoint of the CPU sessions */
+	try { _session_ep.apply(pd_cap, create_thread_lambda); }
 	catch (Allocator::Out_of_memory)                    { throw Out_of_ram(); }
 	catch (Native_capability::Reference_count_overflow) { throw Thread_creation_failed(); }
 
@@ -42,3 +42,6 @@ Genode::Log &Genode::Log::log()
 
 
 void Genode::init_log(Parent &) { };
+
+
+void Genode::init_log_ring(Env &, size_t) { }
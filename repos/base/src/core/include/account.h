@@ -18,7 +18,21 @@
 #include <base/registry.h>
 #include <base/quota_guard.h>
 
-namespace Genode { template <typename> class Account; }
+namespace Genode {
+
+	template <typename> class Account;
+
+	/**
+	 * Lock that serializes the operations on all accounts
+	 *
+	 * The PD sessions owning the accounts are served by different
+	 * entrypoints. A transfer between two accounts or the adoption of
+	 * sub accounts touches the state of more than one account. The lock
+	 * also protects the quota guards of an account against concurrent
+	 * withdrawals by the owning PD session.
+	 */
+	Lock &account_lock();
+}
 
 
 template <typename UNIT>
@@ -56,8 +70,6 @@ class Genode::Account
 			return UNIT { _quota_guard.limit().value - _initial_limit.value };
 		}
 
-		Lock mutable _lock { };
-
 		/*
 		 * Reference account
 		 */
@@ -99,6 +111,7 @@ class Genode::Account
 			_quota_guard(quota_guard), _label(label),
 			_initial_limit(_quota_guard.limit())
 		{
+			Lock::Guard guard(account_lock());
 			ref_account._adopt(*this);
 		}
 
@@ -112,7 +125,7 @@ class Genode::Account
 		{
 			if (!_ref_account) return;
 
-			Lock::Guard guard(_lock);
+			Lock::Guard guard(account_lock());
 
 			if (_quota_guard.used().value > _initial_used.value) {
 				UNIT const dangling { _quota_guard.used().value - _initial_used.value };
@@ -138,44 +151,41 @@ class Genode::Account
 		 */
 		void transfer_quota(Account &other, UNIT amount)
 		{
-			{
-				Lock::Guard guard(_lock);
-
-				/* transfers are permitted only from/to the reference account */
-				if (_ref_account != &other && other._ref_account != this)
-					throw Unrelated_account();
-
-				/* make sure to stay within the initial limit */
-				if (amount.value > _transferrable_quota().value) {
-					error(_label, ": attempt to transfer initial quota");
-					throw Limit_exceeded();
-				}
-
-				/* downgrade from this account */
-				if (!_quota_guard.try_downgrade(amount))
-					throw Limit_exceeded();
+			Lock::Guard guard(account_lock());
+
+			/* transfers are permitted only from/to the reference account */
+			if (_ref_account != &other && other._ref_account != this)
+				throw Unrelated_account();
+
+			/* make sure to stay within the initial limit */
+			if (amount.value > _transferrable_quota().value) {
+				error(_label, ": attempt to transfer initial quota");
+				throw Limit_exceeded();
 			}
 
+			/* downgrade from this account */
+			if (!_quota_guard.try_downgrade(amount))
+				throw Limit_exceeded();
+
 			/* credit to 'other' */
-			Lock::Guard guard(other._lock);
 			other._quota_guard.upgrade(amount);
 		}
 
 		UNIT limit() const
 		{
-			Lock::Guard guard(_lock);
+			Lock::Guard guard(account_lock());
 			return _quota_guard.limit();
 		}
 
 		UNIT used() const
 		{
-			Lock::Guard guard(_lock);
+			Lock::Guard guard(account_lock());
 			return _quota_guard.used();
 		}
 
 		UNIT avail() const
 		{
-			Lock::Guard guard(_lock);
+			Lock::Guard guard(account_lock());
 			return _quota_guard.avail();
 		}
 
@@ -188,7 +198,7 @@ class Genode::Account
 		 */
 		void withdraw(UNIT amount)
 		{
-			Lock::Guard guard(_lock);
+			Lock::Guard guard(account_lock());
 			_quota_guard.withdraw(amount);
 		}
 
@@ -199,7 +209,7 @@ class Genode::Account
 		 */
 		void replenish(UNIT amount)
 		{
-			Lock::Guard guard(_lock);
+			Lock::Guard guard(account_lock());
 			_quota_guard.replenish(amount);
 		}
 
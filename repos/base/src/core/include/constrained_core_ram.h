@@ -17,6 +17,9 @@
 
 #include <base/allocator.h>
 
+/* core includes */
+#include <account.h>
+
 namespace Genode { class Constrained_core_ram; }
 
 class Genode::Constrained_core_ram : public Allocator
@@ -29,6 +32,19 @@ class Genode::Constrained_core_ram : public Allocator
 
 		uint64_t core_mem_allocated { 0 };
 
+		/*
+		 * The quota guards are shared with the accounts of the PD session,
+		 * which are accessed from other entrypoints.
+		 */
+		void _replenish(size_t const page_aligned_size)
+		{
+			Lock::Guard guard(account_lock());
+
+			_ram_guard.replenish(Ram_quota{page_aligned_size});
+			/* on some kernels we require a cap, on some not XXX */
+			_cap_guard.replenish(Cap_quota{1});
+		}
+
 	public:
 
 		Constrained_core_ram(Ram_quota_guard &ram_guard,
@@ -51,16 +67,22 @@ class Genode::Constrained_core_ram : public Allocator
 		{
 			size_t const page_aligned_size = align_addr(size, 12);
 
-			Ram_quota_guard::Reservation ram (_ram_guard,
-			                                  Ram_quota{page_aligned_size});
-			/* on some kernels we require a cap, on some not XXX */
-			Cap_quota_guard::Reservation caps(_cap_guard, Cap_quota{1});
+			{
+				Lock::Guard guard(account_lock());
 
-			if (!_core_mem.alloc(page_aligned_size, ptr))
-				return false;
+				Ram_quota_guard::Reservation ram (_ram_guard,
+				                                  Ram_quota{page_aligned_size});
+				/* on some kernels we require a cap, on some not XXX */
+				Cap_quota_guard::Reservation caps(_cap_guard, Cap_quota{1});
 
-			ram.acknowledge();
-			caps.acknowledge();
+				ram.acknowledge();
+				caps.acknowledge();
+			}
+
+			if (!_core_mem.alloc(page_aligned_size, ptr)) {
+				_replenish(page_aligned_size);
+				return false;
+			}
 
 			core_mem_allocated += page_aligned_size;
 
@@ -73,9 +95,7 @@ class Genode::Constrained_core_ram : public Allocator
 
 			_core_mem.free(ptr, page_aligned_size);
 
-			_ram_guard.replenish(Ram_quota{page_aligned_size});
-			/* on some kernels we require a cap, on some not XXX */
-			_cap_guard.replenish(Cap_quota{1});
+			_replenish(page_aligned_size);
 
 			core_mem_allocated -= page_aligned_size;
 		}
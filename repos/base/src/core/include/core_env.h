@@ -50,6 +50,20 @@ class Genode::Core_env : public Env_deprecated, Noncopyable
 		bool _stack_area_initialized = _init_stack_area();
 
 		Rpc_entrypoint       _entrypoint;
+
+		/*
+		 * Entrypoint serving the PD, CPU, and RM services
+		 *
+		 * The bulk of core's work on behalf of components, i.e., the
+		 * allocation of RAM dataspaces, the population of region maps, and
+		 * the creation of threads, is thereby decoupled from the
+		 * entrypoint that serves the parent interface of init, the
+		 * dataspaces, and the other services. The three services share
+		 * one entrypoint because their sessions look up each other by
+		 * capability.
+		 */
+		Rpc_entrypoint       _pd_ep;
+
 		Core_region_map      _region_map;
 		Pd_session_component _pd_session;
 		Synced_ram_allocator _synced_ram_allocator { _pd_session };
@@ -59,8 +73,10 @@ class Genode::Core_env : public Env_deprecated, Noncopyable
 		Core_env()
 		:
 			_entrypoint(nullptr, ENTRYPOINT_STACK_SIZE, "entrypoint"),
+			_pd_ep(nullptr, ENTRYPOINT_STACK_SIZE, "pd_entrypoint"),
 			_region_map(_entrypoint),
-			_pd_session(_entrypoint,
+			_pd_session(_pd_ep,
+			            _entrypoint,
 			            _entrypoint,
 			            Session::Resources {
 			                Ram_quota { platform().ram_alloc().avail() },
@@ -82,6 +98,7 @@ class Genode::Core_env : public Env_deprecated, Noncopyable
 		~Core_env() { parent()->exit(0); }
 
 		Rpc_entrypoint &entrypoint()    { return _entrypoint; }
+		Rpc_entrypoint &pd_ep()         { return _pd_ep; }
 		Ram_allocator  &ram_allocator() { return _synced_ram_allocator; }
 		Region_map     &local_rm()      { return _region_map; }
 
@@ -157,7 +157,11 @@ class Genode::Cpu_session_component : public  Rpc_object<Cpu_session>,
 		/**
 		 * Register quota donation at allocator guard
 		 */
-		void upgrade_ram_quota(size_t ram_quota) { _md_alloc.upgrade(ram_quota); }
+		void upgrade_ram_quota(size_t ram_quota)
+		{
+			Lock::Guard lock_guard(_thread_alloc_lock);
+			_md_alloc.upgrade(ram_quota);
+		}
 
 
 		/***************************
@@ -30,6 +30,7 @@ class Genode::Pd_root : public Genode::Root_component<Genode::Pd_session_compone
 	private:
 
 		Rpc_entrypoint   &_ep;
+		Rpc_entrypoint   &_ds_ep;
 		Rpc_entrypoint   &_signal_ep;
 		Pager_entrypoint &_pager_ep;
 		Range_allocator  &_phys_alloc;
@@ -63,6 +64,7 @@ class Genode::Pd_root : public Genode::Root_component<Genode::Pd_session_compone
 		{
 			return new (md_alloc())
 				Pd_session_component(_ep,
+				                     _ds_ep,
 				                     _signal_ep,
 				                     session_resources_from_args(args),
 				                     session_label_from_args(args),
@@ -76,16 +78,19 @@ class Genode::Pd_root : public Genode::Root_component<Genode::Pd_session_compone
 
 		void _upgrade_session(Pd_session_component *pd, const char *args) override
 		{
-			pd->upgrade(ram_quota_from_args(args));
-			pd->upgrade(cap_quota_from_args(args));
+			pd->upgrade(ram_quota_from_args(args), cap_quota_from_args(args));
 		}
 
 	public:
 
 		/**
 		 * Constructor
+		 *
+		 * \param ep     entrypoint that serves the PD sessions
+		 * \param ds_ep  entrypoint that manages the RAM dataspaces
 		 */
 		Pd_root(Rpc_entrypoint   &ep,
+		        Rpc_entrypoint   &ds_ep,
 		        Rpc_entrypoint   &signal_ep,
 		        Pager_entrypoint &pager_ep,
 		        Range_allocator  &phys_alloc,
@@ -94,7 +99,7 @@ class Genode::Pd_root : public Genode::Root_component<Genode::Pd_session_compone
 		        Range_allocator  &core_mem)
 		:
 			Root_component<Pd_session_component>(&ep, &md_alloc),
-			_ep(ep), _signal_ep(signal_ep), _pager_ep(pager_ep),
+			_ep(ep), _ds_ep(ds_ep), _signal_ep(signal_ep), _pager_ep(pager_ep),
 			_phys_alloc(phys_alloc), _local_rm(local_rm), _core_mem(core_mem)
 		{ }
 };
@@ -46,8 +46,54 @@ class Genode::Pd_session_component : public Session_object<Pd_session>
 {
 	private:
 
+		/*
+		 * Allocator for the meta data of the session
+		 *
+		 * In contrast to 'Constrained_ram_allocator', the quota is withdrawn
+		 * with the account lock held because the quota guards are also
+		 * modified by the accounts of other PD sessions.
+		 */
+		class Md_ram_allocator : public Ram_allocator
+		{
+			private:
+
+				Pd_session_component &_pd;
+
+			public:
+
+				Md_ram_allocator(Pd_session_component &pd) : _pd(pd) { }
+
+				Ram_dataspace_capability alloc(size_t size, Cache_attribute cached) override
+				{
+					Ram_quota const ram { align_addr(size, 12) };
+
+					/* may throw 'Out_of_ram' or 'Out_of_caps' */
+					_pd._withdraw(ram, Cap_quota{1});
+
+					try { return _pd.alloc(ram.value, cached); }
+					catch (...) {
+						_pd._replenish(ram, Cap_quota{1});
+						throw;
+					}
+				}
+
+				void free(Ram_dataspace_capability ds) override
+				{
+					Ram_quota const ram { _pd.dataspace_size(ds) };
+
+					_pd.free(ds);
+					_pd._replenish(ram, Cap_quota{1});
+				}
+
+				size_t dataspace_size(Ram_dataspace_capability ds) const override
+				{
+					return _pd.dataspace_size(ds);
+				}
+		};
+
 		Rpc_entrypoint            &_ep;
-		Constrained_ram_allocator  _constrained_md_ram_alloc;
+		Rpc_entrypoint            &_ds_ep;
+		Md_ram_allocator           _constrained_md_ram_alloc { *this };
 		Constrained_core_ram       _constrained_core_ram_alloc;
 		Sliced_heap                _sliced_heap;
 		Capability<Parent>         _parent { };
@@ -68,6 +114,30 @@ class Genode::Pd_session_component : public Session_object<Pd_session>
 		friend class Native_pd_component;
 
 
+		/*
+		 * Withdraw quota from the quota guards of the session
+		 *
+		 * \throw Out_of_ram
+		 * \throw Out_of_caps
+		 */
+		void _withdraw(Ram_quota ram, Cap_quota caps)
+		{
+			Lock::Guard guard(account_lock());
+
+			Ram_quota_guard::Reservation ram_costs(_ram_quota_guard(), ram);
+			withdraw(caps);
+			ram_costs.acknowledge();
+		}
+
+		void _replenish(Ram_quota ram, Cap_quota caps)
+		{
+			Lock::Guard guard(account_lock());
+
+			replenish(ram);
+			replenish(caps);
+		}
+
+
 		/*****************************************
 		 ** Utilities for capability accounting **
 		 *****************************************/
@@ -90,7 +160,10 @@ class Genode::Pd_session_component : public Session_object<Pd_session>
 		 */
 		void _consume_cap(Cap_type type)
 		{
-			try { withdraw(Cap_quota{1}); }
+			try {
+				Lock::Guard guard(account_lock());
+				withdraw(Cap_quota{1});
+			}
 			catch (Out_of_caps) {
 				diag("out of caps while consuming ", _name(type), " cap "
 				     "(", _cap_account, ")");
@@ -99,7 +172,11 @@ class Genode::Pd_session_component : public Session_object<Pd_session>
 			diag("consumed ", _name(type), " cap (", _cap_account, ")");
 		}
 
-		void _released_cap_silent() { replenish(Cap_quota{1}); }
+		void _released_cap_silent()
+		{
+			Lock::Guard guard(account_lock());
+			replenish(Cap_quota{1});
+		}
 
 		void _released_cap(Cap_type type)
 		{
@@ -114,8 +191,13 @@ class Genode::Pd_session_component : public Session_object<Pd_session>
 
 		/**
 		 * Constructor
+		 *
+		 * \param ep     entrypoint that serves the session and its region
+		 *               maps
+		 * \param ds_ep  entrypoint that manages the RAM dataspaces
 		 */
 		Pd_session_component(Rpc_entrypoint   &ep,
+		                     Rpc_entrypoint   &ds_ep,
 		                     Rpc_entrypoint   &signal_ep,
 		                     Resources         resources,
 		                     Label      const &label,
@@ -129,19 +211,20 @@ class Genode::Pd_session_component : public Session_object<Pd_session>
 		                     Range_allocator  &core_mem)
 		:
 			Session_object(ep, resources, label, diag),
-			_ep(ep),
-			_constrained_md_ram_alloc(*this, _ram_quota_guard(), _cap_quota_guard()),
+			_ep(ep), _ds_ep(ds_ep),
 			_constrained_core_ram_alloc(_ram_quota_guard(), _cap_quota_guard(), core_mem),
 			_sliced_heap(_constrained_md_ram_alloc, local_rm),
-			_ram_ds_factory(ep, phys_alloc, phys_range, local_rm,
+			_ram_ds_factory(ds_ep, phys_alloc, phys_range, local_rm,
 			                _constrained_core_ram_alloc),
 			_signal_broker(_sliced_heap, signal_ep, signal_ep),
 			_rpc_cap_factory(_sliced_heap),
 			_native_pd(*this, args),
-			_address_space(ep, _sliced_heap, pager_ep,
+			_address_space(ep, ds_ep, _sliced_heap, pager_ep,
 			               virt_range.start, virt_range.size, diag),
-			_stack_area (ep, _sliced_heap, pager_ep, 0, stack_area_virtual_size(), diag),
-			_linker_area(ep, _sliced_heap, pager_ep, 0, LINKER_AREA_SIZE, diag)
+			_stack_area (ep, ds_ep, _sliced_heap, pager_ep, 0,
+			             stack_area_virtual_size(), diag),
+			_linker_area(ep, ds_ep, _sliced_heap, pager_ep, 0,
+			             LINKER_AREA_SIZE, diag)
 		{
 			if (platform().core_needs_platform_pd() || label != "core") {
 				_pd.construct(_sliced_heap, _label.string());
@@ -161,6 +244,17 @@ class Genode::Pd_session_component : public Session_object<Pd_session>
 			_ram_account.construct(_ram_quota_guard(), _label);
 		}
 
+		/**
+		 * Extend the session quota by the amount donated by the client
+		 */
+		void upgrade(Ram_quota ram, Cap_quota caps)
+		{
+			Lock::Guard guard(account_lock());
+
+			Session_object::upgrade(ram);
+			Session_object::upgrade(caps);
+		}
+
 		/**
 		 * Associate thread with PD
 		 *
@@ -215,18 +309,17 @@ class Genode::Pd_session_component : public Session_object<Pd_session>
 		Signal_context_capability
 		alloc_context(Signal_source_capability sig_rec_cap, unsigned long imprint) override
 		{
-			Cap_quota_guard::Reservation cap_costs(_cap_quota_guard(), Cap_quota{1});
-			try {
-				/* may throw 'Out_of_ram' or 'Invalid_signal_source' */
-				Signal_context_capability cap =
-					_signal_broker.alloc_context(sig_rec_cap, imprint);
+			/* may throw 'Out_of_caps' */
+			_consume_cap(SIG_CONTEXT_CAP);
 
-				cap_costs.acknowledge();
-				diag("consumed signal-context cap (", _cap_account, ")");
-				return cap;
-			}
+			/* may throw 'Out_of_ram' or 'Invalid_signal_source' */
+			try { return _signal_broker.alloc_context(sig_rec_cap, imprint); }
 			catch (Signal_broker::Invalid_signal_source) {
+				_released_cap_silent();
 				throw Pd_session::Invalid_signal_source(); }
+			catch (...) {
+				_released_cap_silent();
+				throw; }
 		}
 
 		void free_context(Signal_context_capability cap) override
@@ -57,6 +57,15 @@ class Genode::Ram_dataspace_factory : public Ram_allocator,
 
 		Tslab<Dataspace_component, SLAB_BLOCK_SIZE> _ds_slab;
 
+		/*
+		 * Lock for '_ds_slab'
+		 *
+		 * The factory of core's PD session is used by all entrypoints of
+		 * core. The lock is not held while clearing or exporting the
+		 * dataspace.
+		 */
+		Lock _ds_slab_lock { };
+
 
 		/********************************************
 		 ** Platform-implemented support functions **
@@ -95,9 +104,19 @@ class Genode::Ram_dataspace_factory : public Ram_allocator,
 
 		~Ram_dataspace_factory()
 		{
-			while (Dataspace_component *ds = _ds_slab.first_object())
-				free(static_cap_cast<Ram_dataspace>(
-				       static_cap_cast<Dataspace>(ds->cap())));
+			for (;;) {
+				Dataspace_capability cap;
+				{
+					Lock::Guard guard(_ds_slab_lock);
+
+					Dataspace_component *ds = _ds_slab.first_object();
+					if (!ds)
+						break;
+
+					cap = ds->cap();
+				}
+				free(static_cap_cast<Ram_dataspace>(cap));
+			}
 		}
 
 
@@ -371,9 +371,15 @@ class Genode::Region_map_component : private Weak_object<Region_map_component>,
 		/**
 		 * Constructor
 		 *
+		 * \param ep     entrypoint that serves the region map, which must be
+		 *               the entrypoint of the nested region maps and of the
+		 *               CPU sessions of the region-map clients
+		 * \param ds_ep  entrypoint that manages the attached dataspaces
+		 *
 		 * The object calls 'ep.manage' for itself on construction.
 		 */
 		Region_map_component(Rpc_entrypoint   &ep,
+		                     Rpc_entrypoint   &ds_ep,
 		                     Allocator        &md_alloc,
 		                     Pager_entrypoint &pager_ep,
 		                     addr_t            vm_start,
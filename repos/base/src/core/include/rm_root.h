@@ -28,6 +28,7 @@ class Genode::Rm_root : public Root_component<Rm_session_component>
 {
 	private:
 
+		Rpc_entrypoint   &_ds_ep;
 		Pager_entrypoint &_pager_ep;
 
 	protected:
@@ -37,7 +38,8 @@ class Genode::Rm_root : public Root_component<Rm_session_component>
 			size_t ram_quota = Arg_string::find_arg(args, "ram_quota").ulong_value(0);
 
 			return new (md_alloc())
-			       Rm_session_component(*this->ep(), *md_alloc(), _pager_ep, ram_quota);
+			       Rm_session_component(*this->ep(), _ds_ep, *md_alloc(),
+			                            _pager_ep, ram_quota);
 		}
 
 		void _upgrade_session(Rm_session_component *rm, const char *args) override
@@ -52,15 +54,17 @@ class Genode::Rm_root : public Root_component<Rm_session_component>
 		 * Constructor
 		 *
 		 * \param session_ep   entry point for managing RM session objects
+		 * \param ds_ep        entry point for managing dataspaces
 		 * \param md_alloc     meta data allocator to be used by root component
 		 * \param pager_ep     pager entrypoint
 		 */
 		Rm_root(Rpc_entrypoint   &session_ep,
+		        Rpc_entrypoint   &ds_ep,
 		        Allocator        &md_alloc,
 		        Pager_entrypoint &pager_ep)
 		:
 			Root_component<Rm_session_component>(&session_ep, &md_alloc),
-			_pager_ep(pager_ep)
+			_ds_ep(ds_ep), _pager_ep(pager_ep)
 		{ }
 };
 
@@ -30,6 +30,7 @@ class Genode::Rm_session_component : public Rpc_object<Rm_session>
 	private:
 
 		Rpc_entrypoint   &_ep;
+		Rpc_entrypoint   &_ds_ep;
 		Allocator_guard   _md_alloc;
 		Pager_entrypoint &_pager_ep;
 
@@ -42,11 +43,13 @@ class Genode::Rm_session_component : public Rpc_object<Rm_session>
 		 * Constructor
 		 */
 		Rm_session_component(Rpc_entrypoint   &ep,
+		                     Rpc_entrypoint   &ds_ep,
 		                     Allocator        &md_alloc,
 		                     Pager_entrypoint &pager_ep,
 		                     size_t            ram_quota)
 		:
-			_ep(ep), _md_alloc(&md_alloc, ram_quota), _pager_ep(pager_ep)
+			_ep(ep), _ds_ep(ds_ep), _md_alloc(&md_alloc, ram_quota),
+			_pager_ep(pager_ep)
 		{ }
 
 		~Rm_session_component()
@@ -61,8 +64,15 @@ class Genode::Rm_session_component : public Rpc_object<Rm_session>
 
 		/**
 		 * Register quota donation at allocator guard
+		 *
+		 * The upgrade is issued by core's entrypoint whereas the session
+		 * is served by the entrypoint of the RM service.
 		 */
-		void upgrade_ram_quota(size_t ram_quota) { _md_alloc.upgrade(ram_quota); }
+		void upgrade_ram_quota(size_t ram_quota)
+		{
+			Lock::Guard guard(_region_maps_lock);
+			_md_alloc.upgrade(ram_quota);
+		}
 
 
 		/**************************
@@ -76,8 +86,8 @@ class Genode::Rm_session_component : public Rpc_object<Rm_session>
 			try {
 				Region_map_component *rm =
 					new (_md_alloc)
-						Region_map_component(_ep, _md_alloc, _pager_ep, 0, size,
-						                     Diag{false});
+						Region_map_component(_ep, _ds_ep, _md_alloc, _pager_ep,
+						                     0, size, Diag{false});
 
 				_region_maps.insert(rm);
 
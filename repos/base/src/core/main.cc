@@ -231,6 +231,7 @@ int main()
 	static Trace::Policy_registry trace_policies;
 
 	static Rpc_entrypoint &ep              =  core_env().entrypoint();
+	static Rpc_entrypoint &pd_ep           =  core_env().pd_ep();
 	static Ram_allocator  &core_ram_alloc  =  core_env().ram_allocator();
 	static Region_map     &local_rm        =  core_env().local_rm();
 	Pd_session            &core_pd         = *core_env().pd_session();
@@ -251,15 +252,24 @@ int main()
 
 	static Pager_entrypoint pager_ep(rpc_cap_factory);
 
+	/*
+	 * The PD, CPU, and RM sessions are served by a dedicated entrypoint so
+	 * that the creation of components and their allocation of memory do not
+	 * contend with the handling of ROM sessions, dataspaces, and the parent
+	 * interface of init. The LOG sessions, which are used by many components
+	 * concurrently at startup, have an entrypoint of their own.
+	 */
+	static Rpc_entrypoint log_ep(nullptr, 4*1024*sizeof(long), "log_entrypoint");
+
 	static Rom_root    rom_root    (ep, ep, platform().rom_fs(), sliced_heap);
-	static Rm_root     rm_root     (ep, sliced_heap, pager_ep);
-	static Cpu_root    cpu_root    (core_ram_alloc, local_rm, ep, ep, pager_ep,
+	static Rm_root     rm_root     (pd_ep, ep, sliced_heap, pager_ep);
+	static Cpu_root    cpu_root    (core_ram_alloc, local_rm, pd_ep, ep, pager_ep,
 	                                sliced_heap, Trace::sources());
-	static Pd_root     pd_root     (ep, core_env().signal_ep(), pager_ep,
+	static Pd_root     pd_root     (pd_ep, ep, core_env().signal_ep(), pager_ep,
 	                                platform().ram_alloc(),
 	                                local_rm, sliced_heap,
 	                                platform_specific().core_mem_alloc());
-	static Log_root    log_root    (ep, sliced_heap);
+	static Log_root    log_root    (log_ep, sliced_heap);
 	static Io_mem_root io_mem_root (ep, ep, platform().io_mem_alloc(),
 	                                platform().ram_alloc(), sliced_heap);
 	static Irq_root    irq_root    (*core_env().pd_session(),
@@ -300,9 +310,9 @@ int main()
 
 	/* CPU session representing core */
 	static Cpu_session_component
-		core_cpu(core_ram_alloc, local_rm, ep, ep, pager_ep, sliced_heap, Trace::sources(),
+		core_cpu(core_ram_alloc, local_rm, pd_ep, ep, pager_ep, sliced_heap, Trace::sources(),
 		         "label=\"core\"", Affinity(), Cpu_session::QUOTA_LIMIT);
-	Cpu_session_capability core_cpu_cap = ep.manage(&core_cpu);
+	Cpu_session_capability core_cpu_cap = pd_ep.manage(&core_cpu);
 
 	log("", init_ram_quota.value / (1024*1024), " MiB RAM and ", init_cap_quota, " caps "
 	    "assigned to init");
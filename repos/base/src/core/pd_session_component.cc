@@ -20,6 +20,13 @@
 using namespace Genode;
 
 
+Lock &Genode::account_lock()
+{
+	static Lock lock;
+	return lock;
+}
+
+
 Ram_dataspace_capability
 Pd_session_component::alloc(size_t ds_size, Cache_attribute cached)
 {
@@ -32,29 +39,35 @@ Pd_session_component::alloc(size_t ds_size, Cache_attribute cached)
 	/*
 	 * Track quota usage
 	 *
-	 * We use a guard to roll back the withdrawal of the quota whenever
-	 * we leave the method scope via an exception. The withdrawal is
-	 * acknowledge just before successfully leaving the method.
-	 */
-	Ram_quota_guard::Reservation
-		dataspace_ram_costs(_ram_quota_guard(), Ram_quota{ds_size});
-
-	/*
-	 * In the worst case, we need to allocate a new slab block for the
-	 * meta data of the dataspace to be created. Therefore, we temporarily
-	 * withdraw the slab block size here to trigger an exception if the
-	 * account does not have enough room for the meta data.
+	 * The quota is withdrawn with the account lock held. The lock must not
+	 * be held during the allocation of the dataspace, which accesses the
+	 * quota guards for its meta data. Hence, we roll back the withdrawal
+	 * explicitly whenever the allocation fails.
 	 */
 	{
-		Ram_quota const overhead { Ram_dataspace_factory::SLAB_BLOCK_SIZE };
-		Ram_quota_guard::Reservation sbs_ram_costs(_ram_quota_guard(), overhead);
-	}
+		Lock::Guard guard(account_lock());
+
+		Ram_quota_guard::Reservation
+			dataspace_ram_costs(_ram_quota_guard(), Ram_quota{ds_size});
+
+		/*
+		 * In the worst case, we need to allocate a new slab block for the
+		 * meta data of the dataspace to be created. Therefore, we temporarily
+		 * withdraw the slab block size here to trigger an exception if the
+		 * account does not have enough room for the meta data.
+		 */
+		{
+			Ram_quota const overhead { Ram_dataspace_factory::SLAB_BLOCK_SIZE };
+			Ram_quota_guard::Reservation sbs_ram_costs(_ram_quota_guard(), overhead);
+		}
 
-	/*
-	 * Each dataspace is an RPC object and thereby consumes a capability.
-	 */
-	Cap_quota_guard::Reservation
-		dataspace_cap_costs(_cap_quota_guard(), Cap_quota{1});
+		/*
+		 * Each dataspace is an RPC object and thereby consumes a capability.
+		 */
+		withdraw(Cap_quota{1});
+
+		dataspace_ram_costs.acknowledge();
+	}
 
 	/*
 	 * Allocate physical dataspace
@@ -62,15 +75,11 @@ Pd_session_component::alloc(size_t ds_size, Cache_attribute cached)
 	 * \throw Out_of_ram
 	 * \throw Out_of_caps
 	 */
-	Ram_dataspace_capability ram_ds = _ram_ds_factory.alloc(ds_size, cached);
-
-	/*
-	 * We returned from '_ram_ds_factory.alloc' with a valid dataspace.
-	 */
-	dataspace_ram_costs.acknowledge();
-	dataspace_cap_costs.acknowledge();
-
-	return ram_ds;
+	try { return _ram_ds_factory.alloc(ds_size, cached); }
+	catch (...) {
+		_replenish(Ram_quota{ds_size}, Cap_quota{1});
+		throw;
+	}
 }
 
 
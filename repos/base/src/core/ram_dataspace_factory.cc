@@ -115,8 +115,13 @@ Ram_dataspace_factory::alloc(size_t ds_size, Cache_attribute cached)
 	 * \throw Out_of_ram
 	 * \throw Out_of_caps
 	 */
-	Dataspace_component &ds = *new (_ds_slab)
-		Dataspace_component(ds_size, (addr_t)ds_addr, cached, true, this);
+	Dataspace_component *ds_ptr = nullptr;
+	{
+		Lock::Guard guard(_ds_slab_lock);
+		ds_ptr = new (_ds_slab)
+			Dataspace_component(ds_size, (addr_t)ds_addr, cached, true, this);
+	}
+	Dataspace_component &ds = *ds_ptr;
 
 	/* create native shared memory representation of dataspace */
 	try { _export_ram_ds(ds); }
@@ -124,6 +129,7 @@ Ram_dataspace_factory::alloc(size_t ds_size, Cache_attribute cached)
 		warning("could not export RAM dataspace of size ", ds.size());
 
 		/* cleanup unneeded resources */
+		Lock::Guard guard(_ds_slab_lock);
 		destroy(_ds_slab, &ds);
 		throw Out_of_ram();
 	}
@@ -151,26 +157,34 @@ void Ram_dataspace_factory::free(Ram_dataspace_capability ds_cap)
 		if (!c) return;
 		if (!c->owner(*this)) return;
 
-		ds = c;
+		/* the dataspace is already being freed by another entrypoint */
+		if (!c->cap().valid()) return;
 
-		size_t const ds_size = ds->size();
+		ds = c;
 
 		/* tell entry point to forget the dataspace */
 		_ep.dissolve(ds);
+	});
 
-		/* remove dataspace from all RM sessions */
-		ds->detach_from_rm_sessions();
+	if (!ds)
+		return;
 
-		/* destroy native shared memory representation */
-		_revoke_ram_ds(*ds);
+	/*
+	 * Detach the dataspace outside of 'apply'. A region map that is
+	 * concurrently attaching the dataspace at another entrypoint holds its
+	 * lock while looking up the dataspace.
+	 */
+	ds->detach_from_rm_sessions();
 
-		/* free physical memory that was backing the dataspace */
-		_phys_alloc.free((void *)ds->phys_addr(), ds_size);
-	});
+	/* destroy native shared memory representation */
+	_revoke_ram_ds(*ds);
+
+	/* free physical memory that was backing the dataspace */
+	_phys_alloc.free((void *)ds->phys_addr(), ds->size());
 
 	/* call dataspace destructor and free memory */
-	if (ds)
-		destroy(_ds_slab, ds);
+	Lock::Guard guard(_ds_slab_lock);
+	destroy(_ds_slab, ds);
 }
 
 
@@ -643,13 +643,14 @@ _type_deduction_helper(Dataspace_capability cap) { return cap; }
 
 
 Region_map_component::Region_map_component(Rpc_entrypoint   &ep,
+                                           Rpc_entrypoint   &ds_ep,
                                            Allocator        &md_alloc,
                                            Pager_entrypoint &pager_ep,
                                            addr_t            vm_start,
                                            size_t            vm_size,
                                            Session::Diag     diag)
 :
-	_diag(diag), _ds_ep(ep), _thread_ep(ep), _session_ep(ep),
+	_diag(diag), _ds_ep(ds_ep), _thread_ep(ep), _session_ep(ep),
 	_md_alloc(md_alloc),
 	_map(&_md_alloc), _pager_ep(pager_ep),
 	_ds(align_addr(vm_size, get_page_size_log2())),
@@ -674,7 +675,7 @@ Region_map_component::~Region_map_component()
 	 * there capabilities before it gets dissolved in the next step.
 	 */
 	_ds.detach_from_rm_sessions();
-	_ds_ep.dissolve(this);
+	_session_ep.dissolve(this);
 
 	/* dissolve all clients from pager entrypoint */
 	Rm_client *cl = nullptr;
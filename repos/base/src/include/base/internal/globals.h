@@ -37,6 +37,7 @@ namespace Genode {
 	void init_root_proxy(Env &);
 	void init_tracing(Env &);
 	void init_log(Parent &);
+	void init_log_ring(Env &, size_t);
 	void init_exit(Parent &);
 	void init_parent_resource_requests(Env &);
 	void init_heartbeat_monitoring(Env &);
@@ -45,6 +46,13 @@ namespace Genode {
 
 	void destroy_signal_thread();
 
+	/**
+	 * Deliver signal to a context managed by the calling component
+	 *
+	 * \return false if the context is managed by another component
+	 */
+	bool submit_local_signal(Signal_context_capability, unsigned cnt);
+
 	void cxx_demangle(char const*, char*, size_t);
 	void cxx_current_exception(char *out, size_t size);
 
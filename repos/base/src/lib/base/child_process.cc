@@ -19,6 +19,7 @@
 
 /* base-internal includes */
 #include <base/internal/elf.h>
+#include <base/internal/page_size.h>
 #include <base/internal/parent_cap.h>
 
 using namespace Genode;
@@ -88,9 +89,22 @@ Child::Process::Loaded_executable::Loaded_executable(Type type,
 			catch (Out_of_ram) {
 				error("allocation of read-write segment failed"); throw; };
 
+			/*
+			 * Attach only the file-backed part of the dataspace. RAM
+			 * dataspaces are handed out zero-initialized, so the part
+			 * corresponding to '.bss' needs no local mapping and must not
+			 * be touched. For segments with a large '.bss', this spares
+			 * the parent from faulting in memory that the child may never
+			 * use.
+			 */
+			size_t const local_size =
+				min(max(align_addr(seg.file_size(), get_page_size_log2()),
+				        get_page_size()),
+				    align_addr(size, get_page_size_log2()));
+
 			/* attach dataspace */
 			void *base;
-			try { base = local_rm.attach(ds_cap); }
+			try { base = local_rm.attach(ds_cap, local_size); }
 			catch (Region_map::Invalid_dataspace) {
 				error("attempt to attach invalid segment dataspace"); throw; }
 			catch (Region_map::Region_conflict) {
@@ -99,11 +113,8 @@ Child::Process::Loaded_executable::Loaded_executable(Type type,
 			void * const ptr = base;
 			addr_t const laddr = elf_addr + seg.file_offset();
 
-			/* copy contents and fill with zeros */
+			/* copy contents, the remainder is already zero */
 			memcpy(ptr, (void *)laddr, seg.file_size());
-			if (size > seg.file_size())
-				memset((void *)((addr_t)ptr + seg.file_size()),
-				       0, size - seg.file_size());
 
 			/*
 			 * We store the parent information at the beginning of the first
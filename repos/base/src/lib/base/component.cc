@@ -232,6 +232,10 @@ Genode::size_t Component::stack_size() __attribute__((weak));
 Genode::size_t Component::stack_size() { return 64*1024; }
 
 
+Genode::size_t Component::log_ring_size() __attribute__((weak));
+Genode::size_t Component::log_ring_size() { return 0; }
+
+
 /*
  * We need to execute the constructor of the main entrypoint from a
  * class called 'Startup' as 'Startup' is a friend of 'Entrypoint'.
@@ -16,7 +16,11 @@
 #include <base/log.h>
 #include <base/buffered_output.h>
 #include <base/sleep.h>
+#include <base/env.h>
+#include <base/signal.h>
+#include <dataspace/client.h>
 #include <log_session/client.h>
+#include <log_session/ring.h>
 
 /* base-internal includes */
 #include <base/internal/globals.h>
@@ -37,10 +41,48 @@ namespace {
 		static Session_capability _cap(Parent &parent) {
 			return parent.session_cap(Parent::Env::log()); }
 
+		Constructible<Log_ring>   _ring { };
+		Signal_context_capability _ring_sigh { };
+
 		Back_end(Parent &parent)
 		: _client(reinterpret_cap_cast<Log_session>(_cap(parent))) { }
 
-		void write(char const *string) { (void)_client.write(string); }
+		void write(char const *string)
+		{
+			if (_ring.constructed()) {
+				if (_ring->produce(string, strlen(string))) {
+					if (_ring->consumer_waiting())
+						Signal_transmitter(_ring_sigh).submit();
+					return;
+				}
+
+				/* if the ring is full, the server drains it before the RPC */
+			}
+			(void)_client.write(string);
+		}
+
+		/**
+		 * Switch to the shared-memory ring if supported by the server
+		 */
+		void enable_ring(Env &env, size_t size)
+		{
+			Dataspace_capability ds;
+			try {
+				try { ds = _client.ring(size); }
+				catch (Out_of_ram) {
+					env.upgrade(Parent::Env::log(),
+					            String<64>("ram_quota=", size).string());
+					ds = _client.ring(size);
+				}
+			}
+			catch (...) { return; }
+
+			if (!ds.valid())
+				return;
+
+			_ring_sigh = _client.ring_sigh();
+			_ring.construct(env.rm().attach(ds), Dataspace_client(ds).size());
+		}
 	};
 }
 
@@ -97,3 +139,10 @@ void Genode::init_log(Parent &parent)
 	log_ptr = unmanaged_singleton<Log>(*buffered_log_output);
 }
 
+
+void Genode::init_log_ring(Env &env, size_t size)
+{
+	if (size && back_end_ptr)
+		back_end_ptr->enable_ring(env, size);
+}
+
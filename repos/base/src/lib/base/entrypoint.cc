@@ -299,6 +299,9 @@ namespace {
 			Genode::init_signal_transmitter(env);
 			Genode::init_tracing(env);
 
+			/* signalling is needed for notifying the LOG server */
+			Genode::init_log_ring(env, Component::log_ring_size());
+
 			/*
 			 * Now, as signaling is available, initialize the asynchronous
 			 * parent resource mechanism
@@ -139,6 +139,17 @@ namespace Genode {
 			Lock mutable                        _lock { };
 			List<List_element<Signal_context> > _list { };
 
+			/*
+			 * Contexts with a valid capability, hashed by the local name of
+			 * the capability, for the lookup by 'submit_local'
+			 */
+			enum { INDEX_SIZE = 64 };
+
+			List<List_element<Signal_context> > _index[INDEX_SIZE];
+
+			static unsigned _bucket(long local_name) {
+				return (unsigned long)local_name % INDEX_SIZE; }
+
 		public:
 
 			void insert(List_element<Signal_context> *le)
@@ -147,10 +158,26 @@ namespace Genode {
 				_list.insert(le);
 			}
 
+			/**
+			 * Make context available for the lookup by 'submit_local'
+			 *
+			 * Must be called once the context has obtained its capability.
+			 */
+			void index(Signal_context &context)
+			{
+				Lock::Guard guard(_lock);
+				if (context._cap.valid())
+					_index[_bucket(context._cap.local_name())].insert(&context._index_le);
+			}
+
 			void remove(List_element<Signal_context> *le)
 			{
 				Lock::Guard guard(_lock);
 				_list.remove(le);
+
+				Signal_context &context = *le->object();
+				if (context._cap.valid())
+					_index[_bucket(context._cap.local_name())].remove(&context._index_le);
 			}
 
 			bool test_and_lock(Signal_context *context) const
@@ -169,6 +196,39 @@ namespace Genode {
 				}
 				return false;
 			}
+
+			/**
+			 * Submit signal to the context referred to by 'cap'
+			 *
+			 * \return false if the context is not managed by this component
+			 *
+			 * The lookup relies on 'Native_capability::local_name' to be
+			 * unique for each signal context, which is not the case on all
+			 * platforms.
+			 */
+			bool submit_local(Signal_context_capability cap, unsigned cnt) const
+			{
+				Lock::Guard guard(_lock);
+
+				List_element<Signal_context> const *le =
+					_index[_bucket(cap.local_name())].first();
+
+				for ( ; le; le = le->next()) {
+
+					Signal_context &context = *le->object();
+
+					if (context._cap.local_name() != cap.local_name())
+						continue;
+
+					Lock::Guard context_guard(context._lock);
+
+					if (context._receiver)
+						context._receiver->local_submit(Signal::Data(&context, cnt));
+
+					return true;
+				}
+				return false;
+			}
 	};
 }
 
@@ -226,6 +286,8 @@ Signal_context_capability Signal_receiver::manage(Signal_context *context)
 		                                                "cap_quota=", cap_upgrade).string());
 	}
 
+	signal_context_registry()->index(*context);
+
 	return context->_cap;
 }
 
@@ -298,6 +360,12 @@ void Signal_receiver::local_submit(Signal::Data ns)
 }
 
 
+bool Genode::submit_local_signal(Signal_context_capability cap, unsigned cnt)
+{
+	return cap.valid() && signal_context_registry()->submit_local(cap, cnt);
+}
+
+
 void Signal_receiver::dispatch_signals(Signal_source *signal_source)
 {
 	for (;;) {
@@ -275,12 +275,13 @@ struct Linker::Elf_file : File
 		ram_cap[nr] = env.ram().alloc(p.p_memsz);
 		Region_map::r()->attach_at(ram_cap[nr], dst);
 
+		/*
+		 * The remainder of the segment ('.bss') needs no clearing because
+		 * RAM dataspaces are zero-initialized. Leaving it untouched avoids
+		 * faulting in pages that are never used.
+		 */
 		memcpy((void*)dst, src, p.p_filesz);
 
-		/* clear if file size < memory size */
-		if (p.p_filesz < p.p_memsz)
-			memset((void *)(dst + p.p_filesz), 0, p.p_memsz - p.p_filesz);
-
 		env.rm().detach(src);
 	}
 
@@ -415,6 +415,10 @@ struct Linker::Binary : private Root_object, public Elf_object
 			Thread::myself()->stack_size(stack_size);
 		}
 
+		/* apply the component-provided size of the LOG ring */
+		if (Elf::Addr addr = lookup_symbol("_ZN9Component13log_ring_sizeEv"))
+			init_log_ring(env, ((size_t(*)())addr)());
+
 		/* call 'Component::construct' function if present */
 		if (Elf::Addr addr = lookup_symbol("_ZN9Component9constructERN6Genode3EnvE")) {
 			((void(*)(Env &))addr)(env);
@@ -0,0 +1,187 @@
+/*
+ * \brief  Test and scaling benchmark for the list model
+ * \author agent
+ * \date   2026-10-19
+ *
+ * The test imports XML models of growing size into a list model using a
+ * plain and a keyed update policy. Both models must end up with the same
+ * elements. The consumed time stamp-counter cycles of each update are
+ * printed for comparison.
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+#include <base/component.h>
+#include <base/attached_ram_dataspace.h>
+#include <base/heap.h>
+#include <base/log.h>
+#include <trace/timestamp.h>
+#include <util/list_model.h>
+#include <util/xml_generator.h>
+
+namespace Test {
+	using namespace Genode;
+
+	struct Item;
+	struct Plain_policy;
+	struct Keyed_policy;
+	struct Main;
+
+	typedef String<32> Name;
+}
+
+
+struct Test::Item : List_model<Item>::Element
+{
+	Name const name;
+
+	unsigned version = 0;
+
+	Item(Name const &name) : name(name) { }
+
+	static Name name_of(Xml_node node) {
+		return node.attribute_value("name", Name()); }
+};
+
+
+struct Test::Plain_policy
+{
+	typedef Item Element;
+
+	Allocator &_alloc;
+
+	Plain_policy(Allocator &alloc) : _alloc(alloc) { }
+
+	void destroy_element(Item &item) { destroy(_alloc, &item); }
+
+	Item &create_element(Xml_node node) {
+		return *new (_alloc) Item(Item::name_of(node)); }
+
+	void update_element(Item &item, Xml_node node) {
+		item.version = node.attribute_value("version", 0U); }
+
+	static bool element_matches_xml_node(Item const &item, Xml_node node) {
+		return item.name == Item::name_of(node); }
+
+	static bool node_is_element(Xml_node) { return true; }
+};
+
+
+struct Test::Keyed_policy : Plain_policy, List_model<Item>::Keyed_update_policy
+{
+	Keyed_policy(Allocator &alloc)
+	: Plain_policy(alloc), Keyed_update_policy(alloc) { }
+
+	static unsigned long element_key(Item const &item) {
+		return key(item.name); }
+
+	static unsigned long xml_node_key(Xml_node node) {
+		return key(Item::name_of(node)); }
+};
+
+
+struct Test::Main
+{
+	Env &_env;
+
+	Heap _heap { _env.ram(), _env.rm() };
+
+	enum { MAX_ITEMS = 10000 };
+
+	Attached_ram_dataspace _xml_ds { _env.ram(), _env.rm(), MAX_ITEMS*64 };
+
+	List_model<Item> _plain_model { };
+	List_model<Item> _keyed_model { };
+
+	Plain_policy _plain_policy { _heap };
+	Keyed_policy _keyed_policy { _heap };
+
+	/**
+	 * Generate model with 'count' items, starting at item 'first'
+	 */
+	Xml_node _generate(unsigned first, unsigned count, unsigned version)
+	{
+		Xml_generator xml(_xml_ds.local_addr<char>(), _xml_ds.size(), "items", [&] () {
+			for (unsigned i = first; i < first + count; i++)
+				xml.node("item", [&] () {
+					xml.attribute("name", String<32>("item-", i));
+					xml.attribute("version", version); }); });
+
+		return Xml_node(_xml_ds.local_addr<char>(), _xml_ds.size());
+	}
+
+	template <typename POLICY>
+	Trace::Timestamp _update(List_model<Item> &model, POLICY &policy, Xml_node node)
+	{
+		Trace::Timestamp const start = Trace::timestamp();
+		model.update_from_xml(policy, node);
+		return Trace::timestamp() - start;
+	}
+
+	void _compare(unsigned first, unsigned count, unsigned version)
+	{
+		auto check = [&] (List_model<Item> const &model, char const *type)
+		{
+			unsigned i = first;
+			model.for_each([&] (Item const &item) {
+				if (item.name != Name("item-", i) || item.version != version) {
+					error(type, " model: unexpected item ", item.name);
+					throw Exception();
+				}
+				i++;
+			});
+
+			if (i != first + count) {
+				error(type, " model: ", i - first, " items, expected ", count);
+				throw Exception();
+			}
+		};
+		check(_plain_model, "plain");
+		check(_keyed_model, "keyed");
+	}
+
+	void _step(char const *what, unsigned first, unsigned count, unsigned version)
+	{
+		Xml_node const node = _generate(first, count, version);
+
+		Trace::Timestamp const plain = _update(_plain_model, _plain_policy, node);
+		Trace::Timestamp const keyed = _update(_keyed_model, _keyed_policy, node);
+
+		_compare(first, count, version);
+
+		log(count, " items ", what, ": plain ", plain, " keyed ", keyed, " cycles");
+	}
+
+	Main(Env &env) : _env(env)
+	{
+		unsigned const sizes[] = { 100, 1000, MAX_ITEMS };
+
+		for (unsigned const size : sizes) {
+
+			/* populate empty model */
+			_step("created", 0, size, 1);
+
+			/* update all items without structural change */
+			_step("updated", 0, size, 2);
+
+			/* drop the first tenth of the items, append as many new ones */
+			_step("rotated", size/10, size, 3);
+
+			/* remove all items */
+			_step("cleared", 0, 0, 4);
+		}
+
+		_plain_model.destroy_all_elements(_plain_policy);
+		_keyed_model.destroy_all_elements(_keyed_policy);
+
+		log("Test done.");
+	}
+};
+
+
+void Component::construct(Genode::Env &env) { static Test::Main main(env); }
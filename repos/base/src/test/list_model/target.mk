@@ -0,0 +1,3 @@
+TARGET = test-list_model
+SRC_CC = main.cc
+LIBS   = base
@@ -0,0 +1,262 @@
+/*
+ * \brief  RPC latency and throughput benchmark
+ * \author agent
+ * \date   2026-10-19
+ *
+ * The benchmark measures the round-trip time of RPCs to an entrypoint of
+ * the component itself and to core, with and without payload and with a
+ * capability argument. It also measures the throughput achieved by several
+ * client threads calling the same entrypoint concurrently, and the
+ * aggregate throughput of independent caller-callee pairs, one pair per
+ * CPU, which reveals how the kernel's IPC path scales with the number of
+ * CPUs.
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+#include <base/component.h>
+#include <base/rpc_server.h>
+#include <base/rpc_client.h>
+#include <base/semaphore.h>
+#include <base/thread.h>
+#include <base/heap.h>
+#include <base/log.h>
+#include <timer_session/connection.h>
+#include <trace/timestamp.h>
+
+namespace Test {
+
+	using namespace Genode;
+
+	struct Ping;
+	struct Ping_component;
+	struct Ping_client;
+	struct Caller;
+	struct Cpu_pair;
+	struct Main;
+}
+
+
+struct Test::Ping : Interface
+{
+	typedef Rpc_in_buffer<1024> Payload;
+
+	GENODE_RPC(Rpc_ping, unsigned long, ping, unsigned long);
+	GENODE_RPC(Rpc_payload, size_t, payload, Payload const &);
+	GENODE_RPC(Rpc_echo_cap, Native_capability, echo_cap, Native_capability);
+	GENODE_RPC_INTERFACE(Rpc_ping, Rpc_payload, Rpc_echo_cap);
+};
+
+
+struct Test::Ping_component : Rpc_object<Ping, Ping_component>
+{
+	unsigned long ping(unsigned long value) { return value + 1; }
+
+	size_t payload(Payload const &payload) { return payload.size(); }
+
+	Native_capability echo_cap(Native_capability cap) { return cap; }
+};
+
+
+struct Test::Ping_client : Rpc_client<Ping>
+{
+	Ping_client(Capability<Ping> cap) : Rpc_client<Ping>(cap) { }
+
+	unsigned long ping(unsigned long value) { return call<Rpc_ping>(value); }
+
+	size_t payload(Payload const &payload) { return call<Rpc_payload>(payload); }
+
+	Native_capability echo_cap(Native_capability cap) {
+		return call<Rpc_echo_cap>(cap); }
+};
+
+
+/**
+ * Thread issuing a number of RPCs to the ping entrypoint
+ */
+struct Test::Caller : Thread
+{
+	Ping_client &_client;
+	unsigned     _rounds;
+	Semaphore   &_done;
+
+	Caller(Env &env, Ping_client &client, unsigned rounds, Semaphore &done,
+	       Affinity::Location location = Affinity::Location())
+	:
+		Thread(env, "caller", 16*1024, location, Weight(), env.cpu()),
+		_client(client), _rounds(rounds), _done(done)
+	{ }
+
+	void entry() override
+	{
+		for (unsigned i = 0; i < _rounds; i++)
+			_client.ping(i);
+
+		_done.up();
+	}
+};
+
+
+/**
+ * Entrypoint and caller thread located at the same CPU
+ */
+struct Test::Cpu_pair
+{
+	enum { STACK_SIZE = 4*1024*sizeof(long) };
+
+	Entrypoint     _ep;
+	Ping_component _component { };
+	Ping_client    _client { _ep.manage(_component) };
+	Caller         _caller;
+
+	Cpu_pair(Env &env, Affinity::Location location, unsigned rounds,
+	         Semaphore &done)
+	:
+		_ep(env, STACK_SIZE, "pair_ep", location),
+		_caller(env, _client, rounds, done, location)
+	{ }
+
+	~Cpu_pair() { _ep.dissolve(_component); }
+
+	void start() { _caller.start(); }
+};
+
+
+struct Test::Main
+{
+	enum { STACK_SIZE = 4*1024*sizeof(long) };
+
+	enum { ROUNDS = 20000, NUM_CALLERS = 4, MAX_CPUS = 64 };
+
+	Env &_env;
+
+	Heap _heap { _env.ram(), _env.rm() };
+
+	Timer::Connection _timer { _env };
+
+	Entrypoint _ping_ep { _env, STACK_SIZE, "ping_ep", Affinity::Location() };
+
+	Ping_component _ping_component { };
+
+	Ping_client _ping { _ping_ep.manage(_ping_component) };
+
+	template <typename FN>
+	void _measure(char const *name, unsigned rounds, FN const &fn)
+	{
+		/* warm up, e.g., to establish the connection to the entrypoint */
+		fn();
+
+		uint64_t         const start_us = _timer.elapsed_us();
+		Trace::Timestamp const start    = Trace::timestamp();
+
+		for (unsigned i = 0; i < rounds; i++)
+			fn();
+
+		Trace::Timestamp const cycles = Trace::timestamp() - start;
+		uint64_t         const us     = _timer.elapsed_us() - start_us;
+
+		log(name, ": ", rounds, " calls in ", us, " us, ",
+		    cycles/rounds, " cycles/call, ", us ? rounds*1000000ULL/us : 0,
+		    " calls/s");
+	}
+
+	void _measure_throughput()
+	{
+		Semaphore done { 0 };
+
+		Caller *callers[NUM_CALLERS];
+
+		uint64_t const start_us = _timer.elapsed_us();
+
+		for (unsigned i = 0; i < NUM_CALLERS; i++) {
+			callers[i] = new (_heap) Caller(_env, _ping, ROUNDS, done);
+			callers[i]->start();
+		}
+
+		for (unsigned i = 0; i < NUM_CALLERS; i++)
+			done.down();
+
+		uint64_t const us = _timer.elapsed_us() - start_us;
+
+		for (unsigned i = 0; i < NUM_CALLERS; i++)
+			destroy(_heap, callers[i]);
+
+		unsigned long const calls = NUM_CALLERS*ROUNDS;
+
+		log("throughput with ", (unsigned)NUM_CALLERS, " callers: ",
+		    calls, " calls in ", us, " us, ", us ? calls*1000000ULL/us : 0,
+		    " calls/s");
+	}
+
+	void _measure_cpu_scaling(unsigned num_cpus)
+	{
+		Affinity::Space space = _env.cpu().affinity_space();
+
+		Semaphore done { 0 };
+
+		Cpu_pair *pairs[MAX_CPUS];
+
+		for (unsigned i = 0; i < num_cpus; i++)
+			pairs[i] = new (_heap)
+				Cpu_pair(_env, space.location_of_index(i), ROUNDS, done);
+
+		uint64_t const start_us = _timer.elapsed_us();
+
+		for (unsigned i = 0; i < num_cpus; i++)
+			pairs[i]->start();
+
+		for (unsigned i = 0; i < num_cpus; i++)
+			done.down();
+
+		uint64_t const us = _timer.elapsed_us() - start_us;
+
+		for (unsigned i = 0; i < num_cpus; i++)
+			destroy(_heap, pairs[i]);
+
+		unsigned long const calls = num_cpus*ROUNDS;
+
+		log("throughput with ", num_cpus, " CPU(s): ",
+		    calls, " calls in ", us, " us, ", us ? calls*1000000ULL/us : 0,
+		    " calls/s");
+	}
+
+	Main(Env &env) : _env(env)
+	{
+		log("--- RPC benchmark started ---");
+
+		_measure("local ping", ROUNDS, [&] () { _ping.ping(1); });
+
+		char buf[Ping::Payload::MAX_SIZE];
+		memset(buf, 'x', sizeof(buf));
+		Ping::Payload const payload(buf, sizeof(buf));
+
+		_measure("local payload", ROUNDS, [&] () { _ping.payload(payload); });
+
+		Native_capability const cap = _ping_component.cap();
+		_measure("local capability", ROUNDS, [&] () { _ping.echo_cap(cap); });
+
+		_measure("core ping", ROUNDS, [&] () { _env.pd().avail_ram(); });
+
+		_measure_throughput();
+
+		unsigned const num_cpus = min(_env.cpu().affinity_space().total(),
+		                              (unsigned)MAX_CPUS);
+		for (unsigned n = 1; n <= num_cpus; n *= 2)
+			_measure_cpu_scaling(n);
+
+		if (num_cpus & (num_cpus - 1))
+			_measure_cpu_scaling(num_cpus);
+
+		_ping_ep.dissolve(_ping_component);
+
+		log("--- RPC benchmark finished ---");
+	}
+};
+
+
+void Component::construct(Genode::Env &env) { static Test::Main main(env); }
@@ -31,6 +31,8 @@ namespace Lx {
 	class Task;
 }
 
+namespace Lx_kit { class Scheduler; }
+
 /**
  * Allows pseudo-parallel execution of functions
  */
@@ -69,11 +71,19 @@ class Lx::Task : public Lx_kit::List<Lx::Task>::Element
 
 	private:
 
+		friend class Lx_kit::Scheduler;
+
 		bool verbose = false;
 
 		State _state = STATE_INIT;
 
-		/* sub-classes may overwrite the runnable condition */
+		/*
+		 * Sub-classes may overwrite the runnable condition
+		 *
+		 * The scheduler keeps only runnable tasks in its run queues. Hence,
+		 * a changed condition must be reported via '_set_state' or
+		 * 'Scheduler::runnable_changed'.
+		 */
 		virtual bool _runnable() const
 		{
 			switch (_state) {
@@ -105,6 +115,21 @@ class Lx::Task : public Lx_kit::List<Lx::Task>::Element
 		List_element  _wait_le { this };
 		bool          _wait_le_enqueued { false };
 
+		/* links of the scheduler's run queue of the task's priority */
+		Task *_run_prev     { nullptr };
+		Task *_run_next     { nullptr };
+		bool  _run_enqueued { false };
+
+		void _set_state(State state)
+		{
+			bool const was_runnable = _runnable();
+
+			_state = state;
+
+			if (_runnable() != was_runnable)
+				_scheduler.runnable_changed(this);
+		}
+
 	public:
 
 		Task(void (*func)(void*), void *arg, char const *name,
@@ -114,6 +139,7 @@ class Lx::Task : public Lx_kit::List<Lx::Task>::Element
 
 		State    state()    const { return _state;    }
 		Priority priority() const { return _priority; }
+		bool     runnable() const { return _runnable(); }
 
 		void wait_enqueue(List *list)
 		{
@@ -153,21 +179,21 @@ class Lx::Task : public Lx_kit::List<Lx::Task>::Element
 		void block()
 		{
 			if (_state == STATE_RUNNING) {
-				_state = STATE_BLOCKED;
+				_set_state(STATE_BLOCKED);
 			}
 		}
 
 		void unblock()
 		{
 			if (_state == STATE_BLOCKED) {
-				_state = STATE_RUNNING;
+				_set_state(STATE_RUNNING);
 			}
 		}
 
 		void mutex_block(List *list)
 		{
 			if (_state == STATE_RUNNING) {
-				_state = STATE_MUTEX_BLOCKED;
+				_set_state(STATE_MUTEX_BLOCKED);
 				list->append(&_mutex_le);
 			}
 		}
@@ -175,7 +201,7 @@ class Lx::Task : public Lx_kit::List<Lx::Task>::Element
 		void mutex_unblock(List *list)
 		{
 			if (_state == STATE_MUTEX_BLOCKED) {
-				_state = STATE_RUNNING;
+				_set_state(STATE_RUNNING);
 				list->remove(&_mutex_le);
 			}
 		}
@@ -0,0 +1,244 @@
+/*
+ * \brief  Timer contexts indexed by timer object and ordered by timeout
+ * \author agent
+ * \date   2026-10-19
+ *
+ * Network stacks and USB drivers operate thousands of Linux timers under
+ * load. Each timer object is looked up via a hash table and the scheduled
+ * timers are kept in a binary min heap. So 'mod_timer' and friends have
+ * logarithmic instead of linear costs.
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is distributed under the terms of the GNU General Public License
+ * version 2.
+ */
+
+#ifndef _LX_KIT__INTERNAL__TIMER_QUEUE_H_
+#define _LX_KIT__INTERNAL__TIMER_QUEUE_H_
+
+/* Genode includes */
+#include <base/allocator.h>
+#include <util/string.h>
+
+namespace Lx_kit { template <typename> class Timer_queue; }
+
+
+/**
+ * Queue of timer contexts
+ *
+ * \param CONTEXT  context type, must inherit 'Timer_queue<CONTEXT>::Element'
+ *                 and provide the members 'timer' (pointer to the Linux
+ *                 timer object) and 'timeout' (absolute in jiffies)
+ */
+template <typename CONTEXT>
+class Lx_kit::Timer_queue
+{
+	public:
+
+		class Element
+		{
+			private:
+
+				friend class Timer_queue;
+
+				enum { NOT_SCHEDULED = ~0U };
+
+				CONTEXT      *_hash_next  = nullptr;
+				unsigned      _heap_index = NOT_SCHEDULED;
+				unsigned long _seq        = 0;
+		};
+
+	private:
+
+		/*
+		 * Noncopyable
+		 */
+		Timer_queue(Timer_queue const &);
+		Timer_queue &operator = (Timer_queue const &);
+
+		enum { NUM_BUCKETS = 1024, INITIAL_CAPACITY = 64 };
+
+		Genode::Allocator &_alloc;
+
+		CONTEXT *_buckets[NUM_BUCKETS] { };
+
+		CONTEXT **_heap     = nullptr;
+		unsigned  _count    = 0;
+		unsigned  _capacity = 0;
+
+		/* order of scheduling, used to break ties between equal timeouts */
+		unsigned long _seq = 0;
+
+		static unsigned _bucket(void const *timer)
+		{
+			Genode::addr_t const addr = (Genode::addr_t)timer;
+			return ((addr >> 4) ^ (addr >> 14)) % NUM_BUCKETS;
+		}
+
+		/*
+		 * Timers with equal timeouts fire in the reverse order of their
+		 * scheduling, which matches the former sorted-list implementation.
+		 */
+		static bool _earlier(CONTEXT const *a, CONTEXT const *b)
+		{
+			if (a->timeout != b->timeout)
+				return a->timeout < b->timeout;
+
+			return a->_seq > b->_seq;
+		}
+
+		void _place(unsigned i, CONTEXT *ctx)
+		{
+			_heap[i] = ctx;
+			ctx->_heap_index = i;
+		}
+
+		void _sift_up(unsigned i)
+		{
+			CONTEXT * const ctx = _heap[i];
+
+			for (unsigned parent; i > 0; i = parent) {
+				parent = (i - 1)/2;
+				if (!_earlier(ctx, _heap[parent]))
+					break;
+				_place(i, _heap[parent]);
+			}
+			_place(i, ctx);
+		}
+
+		void _sift_down(unsigned i)
+		{
+			CONTEXT * const ctx = _heap[i];
+
+			for (;;) {
+				unsigned child = 2*i + 1;
+				if (child >= _count)
+					break;
+
+				if (child + 1 < _count && _earlier(_heap[child + 1], _heap[child]))
+					child++;
+
+				if (!_earlier(_heap[child], ctx))
+					break;
+
+				_place(i, _heap[child]);
+				i = child;
+			}
+			_place(i, ctx);
+		}
+
+		void _grow()
+		{
+			unsigned const capacity = _capacity ? 2*_capacity
+			                                    : (unsigned)INITIAL_CAPACITY;
+
+			CONTEXT **heap = (CONTEXT **)_alloc.alloc(capacity*sizeof(CONTEXT *));
+
+			if (_heap) {
+				Genode::memcpy(heap, _heap, _count*sizeof(CONTEXT *));
+				_alloc.free(_heap, _capacity*sizeof(CONTEXT *));
+			}
+
+			_heap     = heap;
+			_capacity = capacity;
+		}
+
+		void _unschedule(CONTEXT &ctx)
+		{
+			unsigned const i = ctx._heap_index;
+			if (i == Element::NOT_SCHEDULED)
+				return;
+
+			ctx._heap_index = Element::NOT_SCHEDULED;
+
+			if (i == --_count)
+				return;
+
+			_place(i, _heap[_count]);
+			_sift_down(i);
+			_sift_up(_heap[i]->_heap_index);
+		}
+
+	public:
+
+		Timer_queue(Genode::Allocator &alloc) : _alloc(alloc) { }
+
+		~Timer_queue()
+		{
+			if (_heap)
+				_alloc.free(_heap, _capacity*sizeof(CONTEXT *));
+		}
+
+		/**
+		 * Return context of 'timer' or nullptr if unknown
+		 */
+		CONTEXT *lookup(void const *timer) const
+		{
+			for (CONTEXT *c = _buckets[_bucket(timer)]; c; c = c->_hash_next)
+				if (c->timer == timer)
+					return c;
+
+			return nullptr;
+		}
+
+		/**
+		 * Make context known without scheduling it
+		 */
+		void insert(CONTEXT &ctx)
+		{
+			CONTEXT *&head = _buckets[_bucket(ctx.timer)];
+
+			ctx._hash_next = head;
+			head = &ctx;
+		}
+
+		/**
+		 * Unschedule and forget context
+		 */
+		void remove(CONTEXT &ctx)
+		{
+			_unschedule(ctx);
+
+			for (CONTEXT **c = &_buckets[_bucket(ctx.timer)]; *c; c = &(*c)->_hash_next) {
+				if (*c == &ctx) {
+					*c = ctx._hash_next;
+					break;
+				}
+			}
+			ctx._hash_next = nullptr;
+		}
+
+		/**
+		 * Position context according to its current 'timeout'
+		 *
+		 * \throw Out_of_ram
+		 * \throw Out_of_caps
+		 */
+		void schedule(CONTEXT &ctx)
+		{
+			ctx._seq = ++_seq;
+
+			unsigned const i = ctx._heap_index;
+			if (i != Element::NOT_SCHEDULED) {
+				_sift_down(i);
+				_sift_up(ctx._heap_index);
+				return;
+			}
+
+			if (_count == _capacity)
+				_grow();
+
+			_place(_count, &ctx);
+			_sift_up(_count++);
+		}
+
+		/**
+		 * Return scheduled context with the earliest timeout
+		 */
+		CONTEXT *first() const { return _count ? _heap[0] : nullptr; }
+};
+
+#endif /* _LX_KIT__INTERNAL__TIMER_QUEUE_H_ */
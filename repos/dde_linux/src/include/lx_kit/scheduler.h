@@ -57,6 +57,13 @@ class Lx::Scheduler
 		 */
 		virtual void remove(Task *task) = 0;
 
+		/**
+		 * Account for a changed runnable condition of 'task'
+		 *
+		 * Called by the task whenever it enters or leaves a runnable state.
+		 */
+		virtual void runnable_changed(Task *task) = 0;
+
 		/**
 		 * Schedule all present tasks
 		 *
@@ -31,14 +31,22 @@ static int driver_net_open(struct net_device *dev)
 }
 
 
+static void copy_skb(void *dst, void *skb)
+{
+	/* also copies the fragments of scatter-gather sk_buffs */
+	skb_copy_bits(skb, 0, dst, ((struct sk_buff *)skb)->len);
+}
+
+
 static int driver_net_xmit(struct sk_buff *skb, struct net_device *dev)
 {
 	struct net_device_stats *stats = (struct net_device_stats*) netdev_priv(dev);
 	int len                        = skb->len;
-	void* addr                     = skb->data;
+	int checksum_partial           = skb->ip_summed == CHECKSUM_PARTIAL;
+	unsigned segment_size          = skb_is_gso(skb) ? skb_shinfo(skb)->gso_size : 0;
 
 	/* transmit to nic-session */
-	if (net_tx(addr, len)) {
+	if (net_tx(len, checksum_partial, segment_size, copy_skb, skb)) {
 		/* tx queue is  full, could not enqueue packet */
 		pr_debug("TX packet dropped\n");
 		return NETDEV_TX_BUSY;
@@ -75,6 +83,7 @@ static int driver_init(void)
 {
 	struct net_device *dev;
 	int err = -ENODEV;
+	unsigned offload = net_offload();
 
 	dev = alloc_etherdev(0);
 
@@ -83,6 +92,13 @@ static int driver_init(void)
 
 	dev->netdev_ops = &driver_net_ops;
 
+	/* let the Nic server calculate checksums and split large segments */
+	if (offload & NET_OFFLOAD_CHECKSUM)
+		dev->hw_features |= NETIF_F_IP_CSUM | NETIF_F_SG;
+	if (offload & NET_OFFLOAD_LARGE)
+		dev->hw_features |= NETIF_F_TSO;
+	dev->features |= dev->hw_features;
+
 	/* set MAC */
 	net_mac(dev->dev_addr, ETH_ALEN);
 
@@ -105,8 +121,18 @@ module_init(driver_init);
 
 /**
  * Called by Nic_client when a packet was received
+ *
+ * If 'page' is not NULL, it refers to the memory of the received packet. In
+ * this case, only the headers are copied into the linear part of the skb
+ * and the remaining payload is attached as page fragment. The fragment takes
+ * its own reference of the page.
+ *
+ * A packet with a partial checksum comes from a local sender that left the
+ * checksum to the receiver. Its data never crossed a wire, so the checksum
+ * is not verified. All other packets are verified by Linux.
  */
-void net_driver_rx(void *addr, unsigned long size)
+void net_driver_rx(void *addr, unsigned long size, struct page *page,
+                   int checksum_partial, unsigned segment_size)
 {
 	struct net_device_stats *stats;
 
@@ -117,21 +143,38 @@ void net_driver_rx(void *addr, unsigned long size)
 
 	/* allocate skb */
 	enum {
-		ADDITIONAL_HEADROOM = 4, /* smallest value found by trial & error */
+		ADDITIONAL_HEADROOM = 4,   /* smallest value found by trial & error */
+		LINEAR_HEADER_SIZE  = 128, /* covers ethernet, IP, and TCP headers */
 	};
-	struct sk_buff *skb = dev_alloc_skb(size + ADDITIONAL_HEADROOM);
+	unsigned long const linear = page && size > LINEAR_HEADER_SIZE
+	                           ? LINEAR_HEADER_SIZE : size;
+
+	struct sk_buff *skb = dev_alloc_skb(linear + ADDITIONAL_HEADROOM);
 	if (!skb) {
 		printk(KERN_NOTICE "genode_net_rx: low on mem - packet dropped!\n");
 		stats->rx_dropped++;
 		return;
 	}
 
-	/* copy packet */
-	memcpy(skb_put(skb, size), addr, size);
+	/* copy packet or only its headers */
+	memcpy(skb_put(skb, linear), addr, linear);
+
+	/* reference payload in place */
+	if (linear < size) {
+		get_page(page);
+		skb_add_rx_frag(skb, 0, page, linear, size - linear, size - linear);
+	}
 
 	skb->dev       = _dev;
 	skb->protocol  = eth_type_trans(skb, _dev);
-	skb->ip_summed = CHECKSUM_NONE;
+	skb->ip_summed = checksum_partial ? CHECKSUM_UNNECESSARY : CHECKSUM_NONE;
+
+	/* large segment, like those merged by GRO */
+	if (segment_size) {
+		skb_shinfo(skb)->gso_size = segment_size;
+		skb_shinfo(skb)->gso_type = SKB_GSO_TCPV4;
+		skb_shinfo(skb)->gso_segs = DIV_ROUND_UP(size, segment_size);
+	}
 
 	netif_receive_skb(skb);
 
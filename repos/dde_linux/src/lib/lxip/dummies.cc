@@ -256,7 +256,6 @@ DUMMY(-1, get_net_ns_by_pid)
 DUMMY(-1, getnstimeofday)
 DUMMY(-1, get_nulls_value)
 DUMMY(-1, get_options)
-DUMMY(-1, get_page)
 DUMMY(-1, gfp_pfmemalloc_allowed)
 DUMMY(-1, gid_lte)
 DUMMY(-1, hash32_ptr)
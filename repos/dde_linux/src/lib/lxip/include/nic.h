@@ -18,9 +18,37 @@
 extern "C" {
 #endif
 
+struct page;
+
+enum {
+	NET_OFFLOAD_CHECKSUM = 1 << 0, /* TCP/UDP checksums are left to the Nic server */
+	NET_OFFLOAD_LARGE    = 1 << 1, /* TCP segments may exceed the MTU */
+};
+
+/**
+ * Return offload features enabled for the Nic session
+ */
+unsigned net_offload(void);
+
 void net_mac(void* mac, unsigned long size);
-int  net_tx(void* addr, unsigned long len);
-void net_driver_rx(void *addr, unsigned long size);
+
+/**
+ * Transmit packet
+ *
+ * \param len               packet size
+ * \param checksum_partial  TCP/UDP checksum is incomplete
+ * \param segment_size      TCP payload size of the segments a large
+ *                          segment stands for, or 0
+ * \param copy              function that writes the packet to 'dst'
+ * \param arg               argument passed to 'copy'
+ *
+ * \return 0 on success, 1 if the tx queue is full
+ */
+int  net_tx(unsigned long len, int checksum_partial, unsigned segment_size,
+            void (*copy)(void *dst, void *arg), void *arg);
+
+void net_driver_rx(void *addr, unsigned long size, struct page *page,
+                   int checksum_partial, unsigned segment_size);
 
 #ifdef __cplusplus
 }
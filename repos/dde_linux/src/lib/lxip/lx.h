@@ -20,11 +20,26 @@
 
 namespace Lx_kit { class Env; }
 
+struct page;
+
 namespace Lx {
 
+	/**
+	 * \param offload  negotiate offload features with the Nic server
+	 */
 	void nic_client_init(Genode::Env &env,
 	                     Genode::Allocator &alloc,
-	                     void (*ticker)());
+	                     void (*ticker)(),
+	                     bool offload);
+
+	/**
+	 * Acknowledge the received packet referenced by 'page'
+	 *
+	 * Called when the last reference to the page is gone.
+	 *
+	 * \return false if 'page' does not refer to a received packet
+	 */
+	bool nic_client_release_page(struct page *page);
 
 	void timer_init(Genode::Entrypoint &ep,
 	                Genode::Timeout_scheduler &scheduler,
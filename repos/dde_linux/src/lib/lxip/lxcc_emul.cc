@@ -406,11 +406,21 @@ struct page *virt_to_head_page(const void *x)
 }
 
 
+void get_page(struct page *page)
+{
+	atomic_inc(&page->_count);
+}
+
+
 void put_page(struct page *page)
 {
 	if (!atomic_dec_and_test(&page->_count))
 		return;
 
+	/* page refers to a received Nic packet */
+	if (Lx::nic_client_release_page(page))
+		return;
+
 	lx_log(DEBUG_SLAB, "put_page: %p", page);
 	Avl_page *p = tree.first()->find_by_address((Genode::addr_t)page->addr);
 
@@ -21,6 +21,7 @@
 /* local includes */
 #include <lx.h>
 #include <nic.h>
+#include <lx_emul.h>
 
 bool ic_link_state = false;
 
@@ -36,6 +37,7 @@ class Nic_client
 
 		Nic::Packet_allocator _tx_block_alloc;
 		Nic::Connection       _nic;
+		Nic::Offload          _offload { 0 };
 
 		Genode::Io_signal_handler<Nic_client> _sink_ack;
 		Genode::Io_signal_handler<Nic_client> _sink_submit;
@@ -44,6 +46,59 @@ class Nic_client
 
 		void (*_tick)();
 
+		/*
+		 * Received packets referenced by sk_buffs
+		 *
+		 * The payload of a received packet is attached to its sk_buff as
+		 * fragment of an emulated page that points into the rx bulk buffer.
+		 * The packet is acknowledged when the last reference to the page is
+		 * released, e.g., after the application consumed the data. At most
+		 * half of the rx queue is held that way so that unread sockets
+		 * cannot stall the reception. Beyond this limit and for small
+		 * packets, the content is copied into the sk_buff.
+		 */
+		enum {
+			MAX_RX_PACKETS = Nic::Session::QUEUE_SIZE / 2,
+			RX_COPY_BREAK  = 256,
+		};
+
+		struct Rx_packet
+		{
+			struct page            page { };
+			Nic::Packet_descriptor packet { };
+			Rx_packet             *next_free = nullptr;
+		};
+
+		Rx_packet  _rx_packets[MAX_RX_PACKETS];
+		Rx_packet *_free_rx_packets = nullptr;
+
+		/* released packets not yet acknowledged because of a full ack queue */
+		Nic::Packet_descriptor _unacked[MAX_RX_PACKETS];
+		unsigned               _num_unacked = 0;
+
+		Rx_packet *_alloc_rx_packet(Nic::Packet_descriptor packet, void *content)
+		{
+			if (packet.size() <= RX_COPY_BREAK || !_free_rx_packets || _num_unacked)
+				return nullptr;
+
+			Rx_packet &rx = *_free_rx_packets;
+			_free_rx_packets = rx.next_free;
+
+			rx.packet    = packet;
+			rx.page.addr = content;
+			atomic_set(&rx.page._count, 1);
+
+			return &rx;
+		}
+
+		void _flush_unacked()
+		{
+			while (_num_unacked && _nic.rx()->try_ack_packet(_unacked[_num_unacked - 1]))
+				_num_unacked--;
+
+			_nic.rx()->wakeup();
+		}
+
 		void _link_state()
 		{
 			bool const link_state = _nic.link_state();
@@ -68,13 +123,29 @@ class Nic_client
 			/* process a batch of only MAX_PACKETS in one run */
 			enum { MAX_PACKETS = 20 };
 
+			_flush_unacked();
+
 			int count = 0;
 			while (_nic.rx()->packet_avail() &&
 			       _nic.rx()->ready_to_ack() &&
 			       count++ < MAX_PACKETS)
 			{
 				Nic::Packet_descriptor p = _nic.rx()->get_packet();
-				try { net_driver_rx(_nic.rx()->packet_content(p), p.size()); }
+				try {
+					void * const content = _nic.rx()->packet_content(p);
+
+					Rx_packet * const rx = _alloc_rx_packet(p, content);
+
+					net_driver_rx(content, p.size(), rx ? &rx->page : nullptr,
+					              p.checksum() == Nic::Packet_descriptor::CHECKSUM_PARTIAL,
+					              p.segment_size());
+
+					/* drop our reference, acknowledges the unused packet */
+					if (rx) {
+						put_page(&rx->page);
+						continue;
+					}
+				}
 				catch (Genode::Packet_descriptor::Invalid_packet) {
 					Genode::error("received invalid Nic packet"); }
 				_nic.rx()->acknowledge_packet(p);
@@ -112,7 +183,8 @@ class Nic_client
 
 		Nic_client(Genode::Env &env,
 		           Genode::Allocator &alloc,
-		           void (*ticker)())
+		           void (*ticker)(),
+		           bool offload)
 		:
 			_tx_block_alloc(&alloc),
 			_nic(env, &_tx_block_alloc, BUF_SIZE, BUF_SIZE),
@@ -122,6 +194,17 @@ class Nic_client
 			_link_state_change(env.ep(), *this, &Nic_client::_link_state),
 			_tick(ticker)
 		{
+			for (unsigned i = 0; i < MAX_RX_PACKETS; i++) {
+				_rx_packets[i].next_free = _free_rx_packets;
+				_free_rx_packets = &_rx_packets[i];
+			}
+
+			if (offload)
+				_offload = _nic.offload(Nic::Offload { Nic::Offload::TX_CHECKSUM |
+				                                       Nic::Offload::RX_CHECKSUM |
+				                                       Nic::Offload::TX_LARGE    |
+				                                       Nic::Offload::RX_LARGE });
+
 			ic_link_state = _nic.link_state();
 
 			_nic.rx_channel()->sigh_ready_to_ack(_sink_ack);
@@ -132,6 +215,29 @@ class Nic_client
 		}
 
 		Nic::Connection *nic() { return &_nic; }
+
+		Nic::Offload offload() const { return _offload; }
+
+		bool release_page(struct page *page)
+		{
+			Genode::addr_t const offset = (Genode::addr_t)page
+			                            - (Genode::addr_t)_rx_packets;
+
+			if (offset >= sizeof(_rx_packets))
+				return false;
+
+			Rx_packet &rx = _rx_packets[offset / sizeof(Rx_packet)];
+
+			if (_nic.rx()->try_ack_packet(rx.packet))
+				_nic.rx()->wakeup();
+			else
+				_unacked[_num_unacked++] = rx.packet;
+
+			rx.next_free = _free_rx_packets;
+			_free_rx_packets = &rx;
+
+			return true;
+		}
 };
 
 
@@ -140,13 +246,20 @@ static Nic_client *_nic_client;
 
 void Lx::nic_client_init(Genode::Env &env,
 	                       Genode::Allocator &alloc,
-	                       void (*ticker)())
+	                       void (*ticker)(),
+	                       bool offload)
 {
-	static Nic_client _inst(env, alloc, ticker);
+	static Nic_client _inst(env, alloc, ticker, offload);
 	_nic_client = &_inst;
 }
 
 
+bool Lx::nic_client_release_page(struct page *page)
+{
+	return _nic_client && _nic_client->release_page(page);
+}
+
+
 /**
  * Call by back-end driver while initializing
  */
@@ -172,16 +285,40 @@ void net_mac(void* mac, unsigned long size)
 }
 
 
+/**
+ * Call by back-end driver while initializing
+ */
+unsigned net_offload(void)
+{
+	using Nic::Offload;
+
+	Offload const offload = _nic_client->offload();
+
+	/* Linux supports TSO only with checksum offloading */
+	if (!offload.has(Offload::TX_CHECKSUM | Offload::RX_CHECKSUM))
+		return 0;
+
+	return NET_OFFLOAD_CHECKSUM
+	     | (offload.has(Offload::TX_LARGE) ? NET_OFFLOAD_LARGE : 0);
+}
+
+
 /**
  * Call by back-end driver when a packet should be sent
  */
-int net_tx(void* addr, unsigned long len)
+int net_tx(unsigned long len, int checksum_partial, unsigned segment_size,
+           void (*copy)(void *dst, void *arg), void *arg)
 {
 	try {
 		Nic::Packet_descriptor packet = _nic_client->nic()->tx()->alloc_packet(len);
 		void* content                 = _nic_client->nic()->tx()->packet_content(packet);
 
-		Genode::memcpy((char *)content, addr, len);
+		copy(content, arg);
+
+		if (checksum_partial)
+			packet.checksum(Nic::Packet_descriptor::CHECKSUM_PARTIAL);
+		packet.segment_size(segment_size);
+
 		_nic_client->nic()->tx()->submit_packet(packet);
 
 		return 0;
@@ -21,7 +21,7 @@
 #include <util/reconstructible.h>
 
 /* Linux kit includes */
-#include <lx_kit/internal/list.h>
+#include <lx_kit/internal/timer_queue.h>
 
 /* local includes */
 #include <lx_emul.h>
@@ -48,7 +48,7 @@ class Lx::Timer
 		/**
 		 * Context encapsulates a regular linux timer_list
 		 */
-		struct Context : public Lx_kit::List<Context>::Element
+		struct Context : public Lx_kit::Timer_queue<Context>::Element
 		{
 			enum { INVALID_TIMEOUT = ~0UL };
 			enum Type { LIST };
@@ -94,7 +94,7 @@ class Lx::Timer
 		::Timer::One_shot_timeout<Lx::Timer>         _wait_one_shot {
 			_scheduler, *this, &Lx::Timer::_handle_wait };
 
-		Lx_kit::List<Context>                        _list;
+		Lx_kit::Timer_queue<Context>                 _queue;
 		Genode::Tslab<Context, 32 * sizeof(Context)> _timer_alloc;
 
 		void (*_tick)();
@@ -106,23 +106,11 @@ class Lx::Timer
 	private:
 
 		/**
-		 * Lookup local timer
-		 */
-		Context *_find_context(void const *timer)
-		{
-			for (Context *c = _list.first(); c; c = c->next())
-				if (c->timer == timer)
-					return c;
-
-			return 0;
-		}
-
-		/**
-		 * Program the first timer in the list
+		 * Program the first timer in the queue
 		 */
 		void _program_first_timer()
 		{
-			Context *ctx = _list.first();
+			Context *ctx = _queue.first();
 			if (!ctx)
 				return;
 
@@ -135,13 +123,11 @@ class Lx::Timer
 		/**
 		 * Schedule timer
 		 *
-		 * Add the context to the scheduling list depending on its timeout
-		 * and reprogram the first timer.
+		 * Position the context in the queue depending on its timeout and
+		 * reprogram the first timer.
 		 */
 		void _schedule_timer(Context *ctx, unsigned long expires)
 		{
-			_list.remove(ctx);
-
 			ctx->timeout    = expires;
 			ctx->pending    = true;
 
@@ -152,11 +138,7 @@ class Lx::Timer
 			 */
 			ctx->expires(expires);
 
-			Context *c;
-			for (c = _list.first(); c; c = c->next())
-				if (ctx->timeout <= c->timeout)
-					break;
-			_list.insert_before(ctx, c);
+			_queue.schedule(*ctx);
 
 			_program_first_timer();
 		}
@@ -177,7 +159,7 @@ class Lx::Timer
 		{
 			_upate_jiffies(dur);
 
-			while (Lx::Timer::Context *ctx = _list.first()) {
+			while (Lx::Timer::Context *ctx = _queue.first()) {
 				if (ctx->timeout > jiffies)
 					break;
 
@@ -206,6 +188,7 @@ class Lx::Timer
 		:
 			_ep(ep),
 			_scheduler(scheduler),
+			_queue(alloc),
 			_timer_alloc(&alloc),
 			_tick(tick)
 		{
@@ -219,7 +202,7 @@ class Lx::Timer
 		void add(TIMER *timer)
 		{
 			Context *t = new (&_timer_alloc) Context(timer);
-			_list.append(t);
+			_queue.insert(*t);
 		}
 
 		/**
@@ -227,7 +210,7 @@ class Lx::Timer
 		 */
 		int del(void *timer)
 		{
-			Context *ctx = _find_context(timer);
+			Context *ctx = _queue.lookup(timer);
 
 			/**
 			 * If the timer expired it was already cleaned up after its
@@ -238,7 +221,7 @@ class Lx::Timer
 
 			int rv = ctx->pending ? 1 : 0;
 
-			_list.remove(ctx);
+			_queue.remove(*ctx);
 			destroy(&_timer_alloc, ctx);
 
 			return rv;
@@ -249,7 +232,7 @@ class Lx::Timer
 		 */
 		int schedule(void *timer, unsigned long expires)
 		{
-			Context *ctx = _find_context(timer);
+			Context *ctx = _queue.lookup(timer);
 			if (!ctx) {
 				Genode::error("schedule unknown timer ", timer);
 				return -1; /* XXX better use 0 as rv? */
@@ -276,7 +259,7 @@ class Lx::Timer
 		 */
 		bool pending(void const *timer)
 		{
-			Context *ctx = _find_context(timer);
+			Context *ctx = _queue.lookup(timer);
 			if (!ctx) {
 				return false;
 			}
@@ -285,7 +268,7 @@ class Lx::Timer
 		}
 
 		Context *find(struct timer_list const *timer) {
-			return _find_context(timer); }
+			return _queue.lookup(timer); }
 
 		/**
 		 * Update jiffie counter
@@ -302,7 +285,7 @@ class Lx::Timer
 		/**
 		 * Get first timer context
 		 */
-		Context* first() { return _list.first(); }
+		Context* first() { return _queue.first(); }
 
 		void wait(unsigned long timeo = 0)
 		{
@@ -1947,7 +1947,8 @@ struct Lxip_factory : Vfs::File_system_factory
 		Timer::Connection timer;
 
 		Init(Genode::Env       &env,
-		     Genode::Allocator &alloc)
+		     Genode::Allocator &alloc,
+		     Genode::Xml_node   config)
 		: timer(env, "vfs_lxip")
 		{
 			Lx_kit::Env &lx_env = Lx_kit::construct_env(env);
@@ -1955,7 +1956,8 @@ struct Lxip_factory : Vfs::File_system_factory
 			Lx::lxcc_emul_init(lx_env);
 			Lx::malloc_init(env, lx_env.heap());
 			Lx::timer_init(env.ep(), timer, lx_env.heap(), &poll_all);
-			Lx::nic_client_init(env, lx_env.heap(), &poll_all);
+			Lx::nic_client_init(env, lx_env.heap(), &poll_all,
+			                    config.attribute_value("offload", true));
 
 			lxip_init();
 		}
@@ -1963,7 +1965,7 @@ struct Lxip_factory : Vfs::File_system_factory
 
 	Vfs::File_system *create(Vfs::Env &env, Genode::Xml_node config) override
 	{
-		static Init inst(env.env(), env.alloc());
+		static Init inst(env.env(), env.alloc(), config);
 		return new (env.alloc()) Vfs::Lxip_file_system(env, config);
 	}
 };
@@ -43,7 +43,75 @@ class Lx_kit::Scheduler : public Lx::Scheduler
 
 		Lx::Task *_current = nullptr; /* currently scheduled task */
 
-		bool _run_task(Lx::Task *);
+		/*
+		 * Runnable tasks, one doubly-linked queue per priority
+		 *
+		 * Tasks are appended when becoming runnable and stay at their
+		 * position as long as they remain runnable. Hence, picking the next
+		 * task and the transitions between blocked and runnable states have
+		 * constant costs regardless of the number of present tasks.
+		 */
+		struct Run_queue
+		{
+			Lx::Task *head = nullptr;
+			Lx::Task *tail = nullptr;
+		};
+
+		enum { NUM_PRIORITIES = Lx::Task::PRIORITY_3 + 1 };
+
+		Run_queue _run_queue[NUM_PRIORITIES];
+
+		void _enqueue(Lx::Task *task)
+		{
+			if (task->_run_enqueued)
+				return;
+
+			Run_queue &queue = _run_queue[task->priority()];
+
+			task->_run_prev = queue.tail;
+			task->_run_next = nullptr;
+
+			if (queue.tail)
+				queue.tail->_run_next = task;
+			else
+				queue.head = task;
+
+			queue.tail = task;
+			task->_run_enqueued = true;
+		}
+
+		void _dequeue(Lx::Task *task)
+		{
+			if (!task->_run_enqueued)
+				return;
+
+			Run_queue &queue = _run_queue[task->priority()];
+
+			if (task->_run_prev)
+				task->_run_prev->_run_next = task->_run_next;
+			else
+				queue.head = task->_run_next;
+
+			if (task->_run_next)
+				task->_run_next->_run_prev = task->_run_prev;
+			else
+				queue.tail = task->_run_prev;
+
+			task->_run_prev = task->_run_next = nullptr;
+			task->_run_enqueued = false;
+		}
+
+		/**
+		 * Return first runnable task of the highest priority
+		 */
+		Lx::Task *_next()
+		{
+			for (int prio = NUM_PRIORITIES - 1; prio >= 0; prio--)
+				if (_run_queue[prio].head)
+					return _run_queue[prio].head;
+
+			return nullptr;
+		}
 
 		/*
 		 * Support for logging
@@ -130,42 +198,48 @@ class Lx_kit::Scheduler : public Lx::Scheduler
 			}
 			if (!p)
 				_present_list.append(task);
+
+			if (task->runnable())
+				_enqueue(task);
 		}
 
 		void remove(Lx::Task *task) override
 		{
+			_dequeue(task);
 			_present_list.remove(task);
 		}
 
+		void runnable_changed(Lx::Task *task) override
+		{
+			if (task->runnable())
+				_enqueue(task);
+			else
+				_dequeue(task);
+		}
+
 		void schedule() override
 		{
 			bool at_least_one = false;
 
 			/*
-			 * Iterate over all tasks and run first runnable.
-			 *
-			 * (1) If one runnable tasks was run start over from beginning of
-			 *     list.
-			 *
-			 * (2) If no task is runnable quit scheduling (break endless
-			 *     loop).
+			 * Run the first task of the highest-priority run queue until no
+			 * task is runnable anymore.
 			 */
 			while (true) {
 				/* update jiffies before running task */
 				Lx::timer_update_jiffies();
 
-				bool was_run = false;
-				for (Lx::Task *t = _present_list.first(); t; t = t->next()) {
-					/* update current before running task */
-					_current = t;
-
-					if ((was_run = t->run())) {
-						at_least_one = true;
-						break;
-					}
-				}
-				if (!was_run)
+				Lx::Task *t = _next();
+				if (!t)
 					break;
+
+				/* update current before running task */
+				_current = t;
+
+				if (t->run())
+					at_least_one = true;
+				else
+					_dequeue(t); /* runnable condition changed unnoticed */
 			}
 
 			if (!at_least_one) {
@@ -18,7 +18,7 @@
 #include <timer_session/connection.h>
 
 /* Linux kit includes */
-#include <lx_kit/internal/list.h>
+#include <lx_kit/internal/timer_queue.h>
 #include <lx_kit/scheduler.h>
 
 /* Linux emulation environment includes */
@@ -36,7 +36,7 @@ class Lx_kit::Timer : public Lx::Timer
 		/**
 		 * Context encapsulates a regular linux timer_list
 		 */
-		struct Context : public Lx_kit::List<Context>::Element
+		struct Context : public Lx_kit::Timer_queue<Context>::Element
 		{
 			enum { INVALID_TIMEOUT = ~0UL };
 
@@ -87,29 +87,17 @@ class Lx_kit::Timer : public Lx::Timer
 		unsigned long                               &_jiffies;
 		::Timer::Connection                          _timer_conn;
 		::Timer::Connection                          _timer_conn_modern;
-		Lx_kit::List<Context>                        _list;
+		Lx_kit::Timer_queue<Context>                 _queue;
 		Lx::Task                                     _timer_task;
 		Genode::Signal_handler<Lx_kit::Timer>        _dispatcher;
 		Genode::Tslab<Context, 32 * sizeof(Context)> _timer_alloc;
 
 		/**
-		 * Lookup local timer
-		 */
-		Context *_find_context(void const *timer)
-		{
-			for (Context *c = _list.first(); c; c = c->next())
-				if (c->timer == timer)
-					return c;
-
-			return 0;
-		}
-
-		/**
-		 * Program the first timer in the list
+		 * Program the first timer in the queue
 		 */
 		void _program_first_timer()
 		{
-			Context *ctx = _list.first();
+			Context *ctx = _queue.first();
 			if (!ctx)
 				return;
 
@@ -122,13 +110,11 @@ class Lx_kit::Timer : public Lx::Timer
 		/**
 		 * Schedule timer
 		 *
-		 * Add the context to the scheduling list depending on its timeout
-		 * and reprogram the first timer.
+		 * Position the context in the queue depending on its timeout and
+		 * reprogram the first timer.
 		 */
 		void _schedule_timer(Context *ctx, unsigned long expires)
 		{
-			_list.remove(ctx);
-
 			ctx->timeout    = expires;
 			ctx->pending    = true;
 
@@ -139,11 +125,7 @@ class Lx_kit::Timer : public Lx::Timer
 			 */
 			ctx->expires(expires);
 
-			Context *c;
-			for (c = _list.first(); c; c = c->next())
-				if (ctx->timeout <= c->timeout)
-					break;
-			_list.insert_before(ctx, c);
+			_queue.schedule(*ctx);
 
 			_program_first_timer();
 		}
@@ -169,6 +151,7 @@ class Lx_kit::Timer : public Lx::Timer
 			_jiffies(jiffies),
 			_timer_conn(env),
 			_timer_conn_modern(env),
+			_queue(alloc),
 			_timer_task(Timer::run_timer, reinterpret_cast<void*>(this),
 			            "timer", Lx::Task::PRIORITY_2, Lx::scheduler()),
 			_dispatcher(ep, *this, &Lx_kit::Timer::_handle),
@@ -178,7 +161,7 @@ class Lx_kit::Timer : public Lx::Timer
 			update_jiffies();
 		}
 
-		Context* first() { return _list.first(); }
+		Context* first() { return _queue.first(); }
 
 		unsigned long jiffies() const { return _jiffies; }
 
@@ -219,12 +202,12 @@ class Lx_kit::Timer : public Lx::Timer
 			else
 				t = new (&_timer_alloc) Context(static_cast<timer_list *>(timer));
 
-			_list.append(t);
+			_queue.insert(*t);
 		}
 
 		int del(void *timer)
 		{
-			Context *ctx = _find_context(timer);
+			Context *ctx = _queue.lookup(timer);
 
 			/**
 			 * If the timer expired it was already cleaned up after its
@@ -235,7 +218,7 @@ class Lx_kit::Timer : public Lx::Timer
 
 			int rv = ctx->pending ? 1 : 0;
 
-			_list.remove(ctx);
+			_queue.remove(*ctx);
 			destroy(&_timer_alloc, ctx);
 
 			return rv;
@@ -243,7 +226,7 @@ class Lx_kit::Timer : public Lx::Timer
 
 		int schedule(void *timer, unsigned long expires)
 		{
-			Context *ctx = _find_context(timer);
+			Context *ctx = _queue.lookup(timer);
 			if (!ctx) {
 				Genode::error("schedule unknown timer ", timer);
 				return -1; /* XXX better use 0 as rv? */
@@ -267,7 +250,7 @@ class Lx_kit::Timer : public Lx::Timer
 		 */
 		bool pending(void const *timer)
 		{
-			Context *ctx = _find_context(timer);
+			Context *ctx = _queue.lookup(timer);
 			if (!ctx) {
 				return false;
 			}
@@ -275,14 +258,8 @@ class Lx_kit::Timer : public Lx::Timer
 			return ctx->pending;
 		}
 
-		bool find(void const *timer) const
-		{
-			for (Context const *c = _list.first(); c; c = c->next())
-				if (c->timer == timer)
-					return true;
-
-			return false;
-		}
+		bool find(void const *timer) const {
+			return _queue.lookup(timer) != nullptr; }
 
 		void update_jiffies()
 		{
@@ -17,13 +17,14 @@
 
 using namespace Depot_deploy;
 
-static void forward_to_log(Genode::uint64_t const sec,
-                           Genode::uint64_t const ms,
-                           char      const *const base,
-                           char      const *const end)
+static void forward_to_log(Genode::uint64_t const  sec,
+                           Genode::uint64_t const  ms,
+                           Child::Name      const &name,
+                           char      const *const  base,
+                           char      const *const  end)
 {
 	log(sec, ".", ms < 10 ? "00" : ms < 100 ? "0" : "", ms, " ",
-	    Cstring(base, end - base));
+	    name, name.valid() ? " " : "", Cstring(base, end - base));
 }
 
 
@@ -33,14 +34,7 @@ void Child::gen_start_node(Xml_generator          &xml,
                            Depot_rom_server const &uncached_depot_rom)
 {
 	if (_state != UNFINISHED) {
-		while (Timeout_event *event = _timeout_events.first()) {
-			_timeout_events.remove(event);
-			destroy(_alloc, event);
-		}
-		while (Log_event *event = _log_events.first()) {
-			_log_events.remove(event);
-			destroy(_alloc, event);
-		}
+		_destroy_events();
 		return;
 	}
 
@@ -66,29 +60,16 @@ void Child::gen_start_node(Xml_generator          &xml,
 		return;
 	}
 
-	if (!_configured() || _condition == UNSATISFIED)
-		return;
-
-	if (_defined_by_launcher() && !_launcher_xml.constructed())
+	if (!startable())
 		return;
 
-	if (!_pkg_xml->xml().has_sub_node("runtime")) {
-		warning("blueprint for '", _name, "' lacks runtime information");
-		return;
-	}
-
 	Xml_node const runtime = _pkg_xml->xml().sub_node("runtime");
 
 	xml.node("start", [&] () {
 
 		xml.attribute("name", _name);
 
-		unsigned long caps = _pkg_cap_quota;
-		if (_defined_by_launcher())
-			caps = _launcher_xml->xml().attribute_value("caps", caps);
-		caps = _start_xml->xml().attribute_value("caps", caps);
-
-		xml.attribute("caps", caps);
+		xml.attribute("caps", _cap_quota());
 
 		typedef String<64> Version;
 		Version const version = _start_xml->xml().attribute_value("version", Version());
@@ -97,14 +78,9 @@ void Child::gen_start_node(Xml_generator          &xml,
 
 		xml.node("binary", [&] () { xml.attribute("name", _binary_name); });
 
-		Number_of_bytes ram = _pkg_ram_quota;
-		if (_defined_by_launcher())
-			ram = _launcher_xml->xml().attribute_value("ram", ram);
-		ram = _start_xml->xml().attribute_value("ram", ram);
-
 		xml.node("resource", [&] () {
 			xml.attribute("name", "RAM");
-			xml.attribute("quantum", String<32>(ram));
+			xml.attribute("quantum", String<32>(_ram_quota()));
 		});
 
 		/*
@@ -170,6 +146,7 @@ void Child::gen_start_node(Xml_generator          &xml,
 		});
 	}
 	catch (...) { }
+	_log_matcher.construct(_alloc, _log_events);
 	log("");
 	log("--- Run \"", _name, "\" (max ", max_timeout_sec, " sec) ---");
 	log("");
@@ -341,6 +318,46 @@ bool Child::_configured() const
 }
 
 
+bool Child::startable() const
+{
+	if (!_configured() || _condition == UNSATISFIED)
+		return false;
+
+	if (_defined_by_launcher() && !_launcher_xml.constructed())
+		return false;
+
+	return _pkg_xml->xml().has_sub_node("runtime");
+}
+
+
+Number_of_bytes Child::_ram_quota() const
+{
+	Number_of_bytes ram = _pkg_ram_quota;
+	if (_defined_by_launcher() && _launcher_xml.constructed())
+		ram = _launcher_xml->xml().attribute_value("ram", ram);
+
+	return _start_xml->xml().attribute_value("ram", ram);
+}
+
+
+unsigned long Child::_cap_quota() const
+{
+	unsigned long caps = _pkg_cap_quota;
+	if (_defined_by_launcher() && _launcher_xml.constructed())
+		caps = _launcher_xml->xml().attribute_value("caps", caps);
+
+	return _start_xml->xml().attribute_value("caps", caps);
+}
+
+
+void Child::_destroy_events()
+{
+	_log_matcher.destruct();
+	_timeout_events.destroy_each(_alloc);
+	_log_events.destroy_each(_alloc);
+}
+
+
 void Child::_gen_provides_sub_node(Xml_generator        &xml,
                                    Xml_node              service,
                                    Xml_node::Type const &node_type,
@@ -371,6 +388,7 @@ Child::Child(Allocator                       &alloc,
              Signal_context_capability const &config_handler)
 :
 	_skip           { start_node.attribute_value("skip", false) },
+	_exclusive      { start_node.attribute_value("exclusive", false) },
 	_alloc          { alloc },
 	_start_xml      { _alloc, start_node },
 	_name           { _start_xml->xml().attribute_value("name", Name()) },
@@ -379,20 +397,11 @@ Child::Child(Allocator                       &alloc,
 { }
 
 
-Child::~Child()
-{
-	while (Timeout_event *event = _timeout_events.first()) {
-		_timeout_events.remove(event);
-		destroy(_alloc, event);
-	}
-	while (Log_event *event = _log_events.first()) {
-		_log_events.remove(event);
-		destroy(_alloc, event);
-	}
-}
+Child::~Child() { _destroy_events(); }
 
 
-void Child::log_session_write(Log_event::Line const &log_line)
+void Child::log_session_write(Log_event::Line const &log_line,
+                              bool                   name_prefix)
 {
 	if (_skip) {
 		return; }
@@ -401,20 +410,11 @@ void Child::log_session_write(Log_event::Line const &log_line)
 	enum { ASCII_LF  = 10 };
 	enum { ASCII_TAB = 9 };
 
-	struct Break : Exception { };
-
-	
 	struct Skip_escape_sequence
 	{
 		char const * const base;
 		size_t       const size;
 	};
-	struct Replace_ampersend_sequence
-	{
-		char const * const base;
-		size_t       const size;
-		char         const by;
-	};
 	static Skip_escape_sequence skip_esc_seq[5]
 	{
 		{ "[0m", 3 },
@@ -423,12 +423,6 @@ void Child::log_session_write(Log_event::Line const &log_line)
 		{ "[33m", 4 },
 		{ "[34m", 4 },
 	};
-	static Replace_ampersend_sequence replace_amp_seq[3]
-	{
-		{ "lt;", 3, '<' },
-		{ "amp;", 4, '&' },
-		{ "#42;", 4, '*' }
-	};
 
 	/* calculate timestamp that prefixes*/
 	Genode::uint64_t const time_us  { _timer.curr_time().trunc_to_plain_us().value - init_time_us };
@@ -438,159 +432,55 @@ void Child::log_session_write(Log_event::Line const &log_line)
 
 	char const *const log_base { log_line.string() };
 	char const *const log_end  { log_base + strlen(log_base) };
-	try {
-		char const *log_print { log_base };
-		_log_events.for_each([&] (Log_event &log_event) {
-
-			bool        match        { false };
-			char const *pattern_end  { log_event.remaining_end() };
-			char const *pattern_curr { log_event.remaining_base() };
-			char const *log_curr     { log_base };
-
-			for (;;) {
-
-				/* handle end of pattern */
-				if (pattern_curr == pattern_end) {
-					match = true;
-					log_event.remaining_base() = log_event.base();
-					log_event.reset_to()       = log_event.base();
-					log_event.reset_retry()    = false;
-					break;
-				}
-				/* skip irrelevant characters in the pattern */
-				if (*pattern_curr == ASCII_LF || *pattern_curr == ASCII_TAB) {
-					pattern_curr++;
-					continue;
-				}
-				if (*pattern_curr == '*') {
-					pattern_curr++;
-					log_event.reset_to()    = pattern_curr;
-					log_event.reset_retry() = false;
-					continue;
-				}
-				/* handle end of log line */
-				if (log_curr == log_end) {
-					log_event.remaining_base() = pattern_curr;
-					break;
-				}
-				/* skip irrelevant characters in the log line */
-				if (*log_curr == ASCII_LF) {
-
-					/* forward to our log session a complete line */
-					if (log_print < log_curr) {
-						forward_to_log(time_sec, time_ms, log_print, log_curr);
-						log_print = log_curr + 1;
-					}
-					log_curr++;
-					continue;
-				}
-				if (*log_curr == ASCII_TAB) {
-					log_curr++;
-					continue;
-				}
-				/* skip irrelevant escape sequences in the log line */
-				if (*log_curr == ASCII_ESC) {
-
-					bool seq_match { false };
-
-					for (unsigned i = 0; i < sizeof(skip_esc_seq)/sizeof(skip_esc_seq[0]); i++) {
-
-						char const *seq_curr { skip_esc_seq[i].base };
-						char const *seq_end  { seq_curr + skip_esc_seq[i].size };
-
-						for (char const *log_seq_curr { log_curr + 1 } ; ; log_seq_curr++, seq_curr++) {
-
-							if (seq_curr == seq_end) {
-								seq_match = true;
-								log_curr  = log_seq_curr;
-								break;
-							}
-							if (log_seq_curr == log_end) {
-								break; }
-
-							if (*log_seq_curr != *seq_curr) {
-								break; }
-						}
-						if (seq_match) {
-							break; }
-					}
-					if (seq_match) {
-						continue; }
-				}
-				char   pattern_curr_san    = *pattern_curr;
-				size_t pattern_curr_san_sz = 1;
 
-				/* replace ampersend sequences in the pattern */
-				if (*pattern_curr == '&') {
+	/* forward to our log session each non-empty line */
+	for (char const *line = log_base; line < log_end; ) {
 
-					bool seq_match { false };
+		char const *line_end = line;
+		for (; line_end < log_end && *line_end != ASCII_LF; line_end++) ;
 
-					for (unsigned i = 0; i < sizeof(replace_amp_seq)/sizeof(replace_amp_seq[0]); i++) {
+		if (line < line_end)
+			forward_to_log(time_sec, time_ms, name_prefix ? _name : Name(),
+			               line, line_end);
 
-						char const *seq_curr { replace_amp_seq[i].base };
-						char const *seq_end  { seq_curr + replace_amp_seq[i].size };
+		line = line_end + 1;
+	}
 
-						for (char const *pattern_seq_curr { pattern_curr + 1 } ; ; pattern_seq_curr++, seq_curr++) {
+	if (!_log_matcher.constructed()) {
+		return; }
 
-							if (seq_curr == seq_end) {
-								seq_match = true;
-								pattern_curr_san    = replace_amp_seq[i].by;
-								pattern_curr_san_sz = replace_amp_seq[i].size + 1;
-								break;
-							}
-							if (pattern_seq_curr == pattern_end) {
-								break; }
+	/*
+	 * Feed the log line to the matcher, tabs, newlines, and irrelevant
+	 * escape sequences are ignored
+	 */
+	Log_event *event = _log_matcher->empty_match();
+	for (char const *curr = log_base; curr < log_end && !event; curr++) {
 
-							if (*pattern_seq_curr != *seq_curr) {
-								break; }
-						}
-						if (seq_match) {
-							break;
-						}
-					}
-				}
-				/* check if log keeps matching pattern */
-				if (*log_curr != pattern_curr_san) {
-					pattern_curr = log_event.reset_to();
-					if (!log_event.reset_retry()) {
-
-						log_curr++; }
-					else {
-						log_event.reset_retry() = false; }
-				} else {
-					pattern_curr += pattern_curr_san_sz;
-					log_curr++;
-					log_event.reset_retry() = true;
-				}
-			}
-			/* forward to our log session what is left */
-			if (log_print < log_curr) {
-				for (;; log_curr++) {
-
-					if (log_curr == log_end) {
-
-						forward_to_log(time_sec, time_ms, log_print, log_curr);
-						log_print = log_curr;
-						break;
-					}
-					if (*log_curr == ASCII_LF) {
-
-						forward_to_log(time_sec, time_ms, log_print, log_curr);
-						log_print = log_curr + 1;
-						break;
-					}
+		if (*curr == ASCII_LF || *curr == ASCII_TAB) {
+			continue; }
+
+		if (*curr == ASCII_ESC) {
+
+			bool seq_match { false };
+			for (Skip_escape_sequence const &seq : skip_esc_seq) {
+
+				if ((size_t)(log_end - curr - 1) >= seq.size &&
+				    !strcmp(curr + 1, seq.base, seq.size))
+				{
+					curr     += seq.size;
+					seq_match = true;
+					break;
 				}
 			}
-			/* check if log line finished a match with the pattern */
-			if (!match) {
-				return; }
-
-			/* execute event handler and stop trying further events */
-			event_occured(log_event, time_us);
-			throw Break();
-		});
+			if (seq_match) {
+				continue; }
+		}
+		event = _log_matcher->consume(*curr);
 	}
-	catch (...) { }
+
+	/* execute event handler of the first pattern that matched */
+	if (event) {
+		event_occured(*event, time_us); }
 }
 
 
@@ -893,12 +783,9 @@ static size_t xml_content_size(Xml_node node)
 
 Log_event::Log_event(Xml_node const &xml)
 :
-	Event           { xml, Type::LOG },
-	_base           { xml_content_base(xml) },
-	_size           { xml_content_size(xml) },
-	_remaining_base { xml_content_base(xml) },
-	_remaining_end  { _remaining_base + xml_content_size(xml) },
-	_reset_to       { xml_content_base(xml) }
+	Event { xml, Type::LOG },
+	_base { xml_content_base(xml) },
+	_size { xml_content_size(xml) }
 { }
 
 
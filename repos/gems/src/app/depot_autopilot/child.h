@@ -26,6 +26,7 @@
 
 /* local includes */
 #include <list.h>
+#include <log_matcher.h>
 
 namespace Depot_deploy {
 
@@ -89,10 +90,6 @@ class Depot_deploy::Log_event : public Event,
 
 		char           const *_base;
 		Genode::size_t const  _size;
-		char           const *_remaining_base;
-		char           const *_remaining_end;
-		bool                  _reset_retry { false };
-		char           const *_reset_to;
 
 	public:
 
@@ -105,10 +102,6 @@ class Depot_deploy::Log_event : public Event,
 
 		Genode::size_t size() const { return _size; }
 		char  const *  base() const { return _base; }
-		char  const * &reset_to() { return _reset_to; }
-		bool          &reset_retry() { return _reset_retry; }
-		char  const * &remaining_base() { return _remaining_base; }
-		char  const * &remaining_end() { return _remaining_end; }
 };
 
 
@@ -164,6 +157,7 @@ class Depot_deploy::Child : public List_model<Child>::Element
 		enum State     { UNFINISHED, SUCCEEDED, FAILED, SKIPPED };
 
 		bool                    const  _skip;
+		bool                    const  _exclusive;
 		Allocator                     &_alloc;
 		Reconstructible<Buffered_xml>  _start_xml;
 		Constructible<Buffered_xml>    _launcher_xml       { };
@@ -178,6 +172,7 @@ class Depot_deploy::Child : public List_model<Child>::Element
 		bool                           _pkg_incomplete     { false };
 		List<Timeout_event>            _timeout_events     { };
 		List<Log_event>                _log_events         { };
+		Constructible<Log_matcher>     _log_matcher        { };
 		Timer::Connection             &_timer;
 		State                          _state              { UNFINISHED };
 		Signal_transmitter             _config_handler;
@@ -192,6 +187,12 @@ class Depot_deploy::Child : public List_model<Child>::Element
 
 		bool _configured() const;
 
+		Number_of_bytes _ram_quota() const;
+
+		unsigned long _cap_quota() const;
+
+		void _destroy_events();
+
 		void _gen_routes(Xml_generator          &,
 		                 Xml_node                ,
 		                 Depot_rom_server const &,
@@ -223,7 +224,13 @@ class Depot_deploy::Child : public List_model<Child>::Element
 
 		~Child();
 
-		void log_session_write(Log_event::Line const &log_line);
+		/**
+		 * Match and forward LOG output of the test
+		 *
+		 * \param name_prefix  prefix forwarded lines with the test name
+		 */
+		void log_session_write(Log_event::Line const &log_line,
+		                       bool                   name_prefix);
 
 		void print_conclusion();
 
@@ -266,6 +273,17 @@ class Depot_deploy::Child : public List_model<Child>::Element
 		                    Depot_rom_server const &cached_depot_rom,
 		                    Depot_rom_server const &uncached_depot_rom);
 
+		/**
+		 * Return true if the start node of the child can be generated
+		 *
+		 * Once started, the child consumes 'ram_quota' and 'cap_quota' of
+		 * the runtime until it is finished.
+		 */
+		bool startable() const;
+
+		Number_of_bytes ram_quota() const { return _ram_quota(); }
+		unsigned long   cap_quota() const { return _cap_quota(); }
+
 		/**
 		 * Generate installation entry needed for the completion of the child
 		 */
@@ -315,6 +333,7 @@ class Depot_deploy::Child : public List_model<Child>::Element
 		Name name()           const { return _name; }
 		bool pkg_incomplete() const { return _pkg_incomplete; }
 		bool running()        const { return _running; }
+		bool exclusive()      const { return _exclusive; }
 		bool finished()       const { return _state != UNFINISHED; }
 };
 
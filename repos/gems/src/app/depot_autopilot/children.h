@@ -22,7 +22,6 @@
 
 /* local includes */
 #include "child.h"
-#include <pointer.h>
 
 namespace Depot_deploy { class Children; }
 
@@ -34,7 +33,14 @@ class Depot_deploy::Children
 		Genode::Allocator                       &_alloc;
 		Timer::Connection                       &_timer;
 		Genode::Signal_context_capability const &_config_handler;
-		Local::Const_pointer<Child>              _curr_child { };
+
+		/*
+		 * Number of tests executed concurrently and the resources available
+		 * to them, a budget of zero stands for no limit
+		 */
+		unsigned        _max_parallel { 1 };
+		Number_of_bytes _ram_budget   { 0 };
+		unsigned long   _cap_budget   { 0 };
 
 		List_model<Child> _children { };
 
@@ -88,9 +94,15 @@ class Depot_deploy::Children
 
 		void apply_config(Xml_node config)
 		{
+			_max_parallel = max(config.attribute_value("parallel", 1U), 1U);
+			_ram_budget   = config.attribute_value("ram", Number_of_bytes(0));
+			_cap_budget   = config.attribute_value("caps", 0UL);
+
 			_children.update_from_xml(_model_update_policy, config);
 		}
 
+		unsigned max_parallel() const { return _max_parallel; }
+
 		void apply_launcher(Child::Launcher_name const &name, Xml_node launcher)
 		{
 			_children.for_each([&] (Child &child) {
@@ -137,24 +149,81 @@ class Depot_deploy::Children
 				child.reset_incomplete(); });
 		}
 
+		/**
+		 * Generate start nodes of the running tests and of the tests to start
+		 *
+		 * Tests are started in the order of the list as long as less than
+		 * '_max_parallel' tests are executed and the quotas of the running
+		 * tests fit into the budget. A test that waits for its blueprint
+		 * occupies a slot already. A test marked as exclusive is executed
+		 * alone.
+		 *
+		 * \return true if all tests are finished
+		 */
 		bool gen_start_nodes(Xml_generator &xml, Xml_node common,
 		                     Child::Depot_rom_server const &cached_depot_rom,
 		                     Child::Depot_rom_server const &uncached_depot_rom)
 		{
-			struct Break : Exception { };
+			unsigned      num_slots   = 0;
+			unsigned      num_running = 0;
+			size_t        ram         = 0;
+			unsigned long caps        = 0;
+			bool          admit       = true;
+
+			auto account = [&] (Child const &child) {
+				num_running++;
+				ram   += child.ram_quota();
+				caps  += child.cap_quota();
+				admit &= !child.exclusive();
+			};
+
+			_children.for_each([&] (Child const &child) {
+				if (child.running()) {
+					num_slots++;
+					account(child);
+				}
+			});
+
+			auto fits = [&] (Child const &child) {
+
+				if (num_running == 0)
+					return true;
+
+				if (child.exclusive())
+					return false;
+
+				return (!_ram_budget || ram  + child.ram_quota() <= _ram_budget)
+				    && (!_cap_budget || caps + child.cap_quota() <= _cap_budget);
+			};
+
 			bool finished = true;
-			try {
-				_children.for_each([&] (Child &child) {
+			_children.for_each([&] (Child &child) {
 
+				if (child.finished() || child.running()) {
 					child.gen_start_node(xml, common, cached_depot_rom, uncached_depot_rom);
+					finished &= child.finished();
+					return;
+				}
 
-					if (!child.finished()) {
-						finished = false;
-						throw Break();
-					}
-				});
-			}
-			catch (Break) { }
+				/* do not let tests overtake each other */
+				if (num_slots >= _max_parallel || (child.startable() && !fits(child)))
+					admit = false;
+
+				if (!admit) {
+					finished = false;
+					return;
+				}
+
+				child.gen_start_node(xml, common, cached_depot_rom, uncached_depot_rom);
+
+				if (child.running())
+					account(child);
+
+				if (!child.finished()) {
+					num_slots++;
+					finished = false;
+				}
+			});
 			return finished;
 		}
 
@@ -172,26 +241,20 @@ class Depot_deploy::Children
 			});
 		}
 
+		/**
+		 * Generate blueprint queries for the tests that are executed next
+		 */
 		void gen_queries(Xml_generator &xml)
 		{
-			try {
-				Child const &child = _curr_child();
-				if (child.finished()) {
-					throw Local::Const_pointer<Child>::Invalid(); }
+			unsigned num_queried = 0;
+			_children.for_each([&] (Child const &child) {
+
+				if (child.finished() || num_queried >= _max_parallel)
+					return;
 
 				child.gen_query(xml);
-			}
-			catch (Local::Const_pointer<Child>::Invalid) {
-				struct Break : Exception { };
-				try {
-					_children.for_each([&] (Child const &child) {
-						if (child.gen_query(xml)) {
-							_curr_child = child;
-							throw Break();
-						}
-					});
-				} catch (Break) { }
-			}
+				num_queried++;
+			});
 		}
 
 		void gen_installation_entries(Xml_generator &xml) const
@@ -0,0 +1,248 @@
+/*
+ * \brief  Matcher of the log patterns of a test against its LOG output
+ * \author agent
+ * \date   2026-10-19
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+/* local includes */
+#include <log_matcher.h>
+#include <child.h>
+
+using namespace Depot_deploy;
+
+
+/**
+ * Call 'fn' for each literal segment of the pattern of 'event'
+ *
+ * Tabs and newlines are ignored, the escape sequences "&lt;", "&amp;", and
+ * "&#42;" are replaced by the characters they stand for. The segment is
+ * decoded to 'buf', which must be as large as the pattern.
+ */
+template <typename FN>
+static void for_each_segment(Log_event const &event, char *buf, FN const &fn)
+{
+	enum { ASCII_LF = 10, ASCII_TAB = 9 };
+
+	struct Replace_ampersend_sequence
+	{
+		char const * const base;
+		size_t       const size;
+		char         const by;
+	};
+	static Replace_ampersend_sequence replace_amp_seq[3]
+	{
+		{ "lt;", 3, '<' },
+		{ "amp;", 4, '&' },
+		{ "#42;", 4, '*' }
+	};
+
+	char const *curr = event.base();
+	char const *end  = curr + event.size();
+	size_t      len  = 0;
+
+	auto flush = [&] () {
+		if (len)
+			fn(buf, len);
+		len = 0;
+	};
+
+	while (curr < end) {
+
+		if (*curr == ASCII_LF || *curr == ASCII_TAB) {
+			curr++;
+			continue;
+		}
+		if (*curr == '*') {
+			flush();
+			curr++;
+			continue;
+		}
+		char   c    = *curr;
+		size_t size = 1;
+
+		if (c == '&') {
+			for (Replace_ampersend_sequence const &seq : replace_amp_seq) {
+				if ((size_t)(end - curr - 1) >= seq.size &&
+				    !strcmp(curr + 1, seq.base, seq.size))
+				{
+					c    = seq.by;
+					size = seq.size + 1;
+					break;
+				}
+			}
+		}
+		buf[len++] = c;
+		curr += size;
+	}
+	flush();
+}
+
+
+Log_matcher::Node &Log_matcher::_new_node(char c)
+{
+	Node &node = _nodes[_num_nodes++];
+	node = Node { c, nullptr, nullptr, nullptr, nullptr, nullptr };
+	return node;
+}
+
+
+Log_matcher::Node *Log_matcher::_child(Node &node, char c)
+{
+	for (Node *child = node.first_child; child; child = child->next_sibling)
+		if (child->c == c)
+			return child;
+
+	return nullptr;
+}
+
+
+void Log_matcher::_add_segment(unsigned pattern, unsigned segment,
+                               char const *chars, size_t length)
+{
+	Node *node = &_root();
+	for (size_t i = 0; i < length; i++) {
+
+		Node *child = _child(*node, chars[i]);
+		if (!child) {
+			child = &_new_node(chars[i]);
+			child->next_sibling = node->first_child;
+			node->first_child   = child;
+		}
+		node = child;
+	}
+	Segment_end &end = _ends[_num_ends++];
+	end = Segment_end { pattern, segment, length, node->ends };
+	node->ends = &end;
+}
+
+
+void Log_matcher::_add_pattern(unsigned index, Log_event &event)
+{
+	Pattern &pattern = _patterns[index];
+	pattern = Pattern { &event, 0, 0, 0 };
+
+	if (!event.size())
+		return;
+
+	char *buf = (char *)_alloc.alloc(event.size());
+
+	for_each_segment(event, buf, [&] (char const *chars, size_t length) {
+		_add_segment(index, pattern.num_segments++, chars, length); });
+
+	_alloc.free(buf, event.size());
+}
+
+
+void Log_matcher::_link()
+{
+	/* determine fail and output links in breadth-first order */
+	Node **queue = (Node **)_alloc.alloc(_num_nodes * sizeof(Node *));
+	size_t head = 0, tail = 0;
+
+	queue[tail++] = &_root();
+	while (head < tail) {
+
+		Node &node = *queue[head++];
+
+		for (Node *child = node.first_child; child; child = child->next_sibling) {
+
+			Node *fail = node.fail;
+			while (fail && !_child(*fail, child->c))
+				fail = fail->fail;
+
+			child->fail   = fail ? _child(*fail, child->c) : &_root();
+			child->output = child->fail->ends ? child->fail : child->fail->output;
+
+			queue[tail++] = child;
+		}
+	}
+	_alloc.free(queue, _num_nodes * sizeof(Node *));
+}
+
+
+Log_matcher::Log_matcher(Allocator &alloc, List<Log_event> &events)
+:
+	_alloc(alloc)
+{
+	/* each character of a pattern adds at most one node and one segment */
+	events.for_each([&] (Log_event &event) {
+		_max_nodes    += event.size();
+		_max_segments += event.size();
+		_num_patterns++;
+	});
+	_max_nodes++;
+
+	_nodes    = (Node *)       _alloc.alloc(_max_nodes * sizeof(Node));
+	_ends     = (Segment_end *)_alloc.alloc(max(_max_segments, (size_t)1) * sizeof(Segment_end));
+	_patterns = (Pattern *)    _alloc.alloc(max(_num_patterns, 1U) * sizeof(Pattern));
+
+	_curr = &_new_node(0);
+
+	unsigned index = 0;
+	events.for_each([&] (Log_event &event) { _add_pattern(index++, event); });
+
+	_link();
+}
+
+
+Log_matcher::~Log_matcher()
+{
+	_alloc.free(_nodes,    _max_nodes * sizeof(Node));
+	_alloc.free(_ends,     max(_max_segments, (size_t)1) * sizeof(Segment_end));
+	_alloc.free(_patterns, max(_num_patterns, 1U) * sizeof(Pattern));
+}
+
+
+Log_event *Log_matcher::empty_match()
+{
+	for (unsigned i = 0; i < _num_patterns; i++)
+		if (!_patterns[i].num_segments)
+			return _patterns[i].event;
+
+	return nullptr;
+}
+
+
+Log_event *Log_matcher::consume(char c)
+{
+	Node *node = _curr;
+	while (node != &_root() && !_child(*node, c))
+		node = node->fail;
+
+	Node *const next = _child(*node, c);
+	_curr = next ? next : &_root();
+	_position++;
+
+	/*
+	 * Visit all segments that end with the character. The pass is not
+	 * stopped at a completed pattern so that the other patterns advance.
+	 */
+	Log_event *completed = nullptr;
+	for (Node *n = _curr->ends ? _curr : _curr->output; n; n = n->output) {
+		for (Segment_end const *end = n->ends; end; end = end->next) {
+
+			Pattern &pattern = _patterns[end->pattern];
+
+			if (pattern.next_segment != end->segment)
+				continue;
+
+			/* segments of a pattern must not overlap */
+			if (_position - end->length < pattern.start_min)
+				continue;
+
+			pattern.next_segment++;
+			pattern.start_min = _position;
+
+			if (pattern.next_segment == pattern.num_segments && !completed)
+				completed = pattern.event;
+		}
+	}
+	return completed;
+}
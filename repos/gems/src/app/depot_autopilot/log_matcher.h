@@ -0,0 +1,132 @@
+/*
+ * \brief  Matcher of the log patterns of a test against its LOG output
+ * \author agent
+ * \date   2026-10-19
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+#ifndef _LOG_MATCHER_H_
+#define _LOG_MATCHER_H_
+
+/* Genode includes */
+#include <base/allocator.h>
+
+/* local includes */
+#include <list.h>
+
+namespace Depot_deploy {
+
+	class Log_event;
+	class Log_matcher;
+}
+
+
+/**
+ * Automaton that matches all log patterns of a test at once
+ *
+ * A log pattern is a sequence of literal segments separated by the
+ * non-greedy wildcard '*'. A pattern matches as soon as its segments
+ * occurred one after another in the LOG output. The segments of all patterns
+ * are compiled into one Aho-Corasick automaton. Hence, each character of the
+ * LOG output is processed in constant amortized time, independent of the
+ * number and the size of the patterns.
+ */
+class Depot_deploy::Log_matcher
+{
+	private:
+
+		/*
+		 * Noncopyable
+		 */
+		Log_matcher(Log_matcher const &);
+		Log_matcher &operator = (Log_matcher const &);
+
+		/**
+		 * Segment of a pattern that ends at a node
+		 */
+		struct Segment_end
+		{
+			unsigned       pattern;   /* index of pattern */
+			unsigned       segment;   /* index of segment within pattern */
+			Genode::size_t length;
+			Segment_end   *next;
+		};
+
+		struct Node
+		{
+			char         c;
+			Node        *first_child;
+			Node        *next_sibling;
+			Node        *fail;       /* longest proper suffix in the trie */
+			Node        *output;     /* next suffix that ends segments */
+			Segment_end *ends;
+		};
+
+		struct Pattern
+		{
+			Log_event        *event;
+			unsigned          num_segments;
+			unsigned          next_segment;
+
+			/* stream position where the next segment may start earliest */
+			Genode::uint64_t  start_min;
+		};
+
+		Genode::Allocator &_alloc;
+
+		Genode::size_t _max_nodes    { 0 };
+		Genode::size_t _max_segments { 0 };
+		unsigned       _num_patterns { 0 };
+
+		Node           *_nodes     { nullptr };
+		Segment_end    *_ends      { nullptr };
+		Pattern        *_patterns  { nullptr };
+		Genode::size_t  _num_nodes { 0 };
+		Genode::size_t  _num_ends  { 0 };
+
+		Node *_curr { nullptr };
+
+		/* number of characters consumed so far */
+		Genode::uint64_t _position { 0 };
+
+		Node &_root() { return _nodes[0]; }
+
+		Node &_new_node(char c);
+
+		static Node *_child(Node &node, char c);
+
+		void _add_segment(unsigned pattern, unsigned segment,
+		                  char const *chars, Genode::size_t length);
+
+		void _add_pattern(unsigned index, Log_event &event);
+
+		void _link();
+
+	public:
+
+		Log_matcher(Genode::Allocator &alloc, List<Log_event> &events);
+
+		~Log_matcher();
+
+		/**
+		 * Return event of a pattern that matches without any LOG output
+		 */
+		Log_event *empty_match();
+
+		/**
+		 * Consume next character of the LOG output
+		 *
+		 * \return event of the pattern that got completed by the character,
+		 *         or nullptr. If the character completes several
+		 *         patterns, the event of the first one is returned.
+		 */
+		Log_event *consume(char c);
+};
+
+#endif /* _LOG_MATCHER_H_ */
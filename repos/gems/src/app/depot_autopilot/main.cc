@@ -17,6 +17,7 @@
 #include <base/attached_rom_dataspace.h>
 #include <base/heap.h>
 #include <os/reporter.h>
+#include <os/log_ring_buffer.h>
 #include <root/component.h>
 
 /* local includes */
@@ -30,31 +31,64 @@ namespace Depot_deploy {
 }
 
 
-class Depot_deploy::Log_session_component : public Rpc_object<Log_session>
+class Depot_deploy::Log_session_component : public Rpc_object<Log_session>,
+                                             private Log_ring_buffer::Output
 {
 	private:
 
 		Session_label const  _child_label;
 		Child               &_child;
+		bool          const  _name_prefix;
+		Log_ring_buffer      _ring;
+
+		void _output(char const *line)
+		{
+			if (_child.finished()) {
+				return; }
+
+			Log_event::Line line_labeled{ "[", _child_label.string(), "] ", line };
+			_child.log_session_write(line_labeled, _name_prefix);
+		}
+
+		/**
+		 * Log_ring_buffer::Output interface
+		 */
+		void output_from_ring(char const *line) override { _output(line); }
 
 	public:
 
-		Log_session_component(Session_label const &child_label,
-		                      Child               &child)
+		Log_session_component(Env                 &env,
+		                      Session_label const &child_label,
+		                      Child               &child,
+		                      bool                 name_prefix)
 		:
 			_child_label(child_label),
-			_child(child)
+			_child(child),
+			_name_prefix(name_prefix),
+			_ring(env.ram(), env.rm(), env.ep(), *this)
 		{ }
 
+		~Log_session_component() { _ring.drain(); }
+
+		void upgrade(size_t ram_quota) { _ring.upgrade(ram_quota); }
+
 		size_t write(String const &line) override
 		{
+			/* output the lines of the ring first to retain the order */
+			_ring.drain();
+
 			if (_child.finished()) {
 				return 0; }
 
-			Log_event::Line line_labeled{ "[", _child_label.string(), "] ", line.string() };
-			_child.log_session_write(line_labeled);
+			_output(line.string());
 			return strlen(line.string());
 		}
+
+		Dataspace_capability ring(size_t size) override {
+			return _ring.dataspace(size); }
+
+		Signal_context_capability ring_sigh() override {
+			return _ring.sigh(); }
 };
 
 
@@ -62,15 +96,17 @@ class Depot_deploy::Log_root : public Root_component<Log_session_component>
 {
 	public:
 
+		Env                 &_env;
 		Children            &_children;
 		Session_label const &_children_label_prefix;
 
-		Log_root(Entrypoint          &ep,
+		Log_root(Env                 &env,
 		         Allocator           &md_alloc,
 		         Children            &children,
 		         Session_label const &children_label_prefix)
 		:
-			Root_component         { ep, md_alloc },
+			Root_component         { env.ep(), md_alloc },
+			_env                   { env },
 			_children              { children },
 			_children_label_prefix { children_label_prefix }
 		{ }
@@ -97,16 +133,25 @@ class Depot_deploy::Log_root : public Root_component<Log_session_component>
 			Child::Name       name       { Cstring(name_base, name_len) };
 			char const *const label_base { name_base + name_len };
 
+			/* distinguish the output of tests executed in parallel */
+			bool const name_prefix = _children.max_parallel() > 1;
+
 			try {
 				return new (md_alloc())
-					Log_session_component(Session_label("init", label_base),
-					                      _children.find_by_name(name));
+					Log_session_component(_env, Session_label("init", label_base),
+					                      _children.find_by_name(name),
+					                      name_prefix);
 			}
 			catch (Children::No_match) {
 				warning("Cannot find child by LOG session label");
 				throw Service_denied();
 			}
 		}
+
+		void _upgrade_session(Log_session_component *s, const char *args) override
+		{
+			s->upgrade(Arg_string::find_arg(args, "ram_quota").ulong_value(0));
+		}
 };
 
 
@@ -231,7 +276,7 @@ struct Depot_deploy::Main
 	Signal_handler<Main>         _repeat_handler { _env.ep(), *this, &Main::_handle_repeat };
 	Heap                         _heap           { _env.ram(), _env.rm() };
 	Reconstructible<Repeatable>  _repeatable     { _env, _repeat_handler, _heap };
-	Log_root                     _log_root       { _env.ep(), _heap, _repeatable->_children, *_repeatable->_children_label_prefix };
+	Log_root                     _log_root       { _env, _heap, _repeatable->_children, *_repeatable->_children_label_prefix };
 
 	void _handle_repeat()
 	{
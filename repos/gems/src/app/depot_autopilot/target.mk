@@ -1,5 +1,5 @@
 TARGET = depot_autopilot
-SRC_CC = main.cc child.cc
+SRC_CC = main.cc child.cc log_matcher.cc
 INC_DIR += $(PRG_DIR)
 LIBS  += base
 CONFIG_XSD = config.xsd
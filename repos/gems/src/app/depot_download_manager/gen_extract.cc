@@ -16,8 +16,11 @@
 void Depot_download_manager::gen_extract_start_content(Xml_generator       &xml,
                                                        Import        const &import,
                                                        Path          const &user_path,
-                                                       Archive::User const &user)
+                                                       Archive::User const &user,
+                                                       Extract_version      version)
 {
+	xml.attribute("version", version.value);
+
 	gen_common_start_content(xml, "extract",
 	                         Cap_quota{200}, Ram_quota{12*1024*1024});
 
@@ -51,7 +54,7 @@ void Depot_download_manager::gen_extract_start_content(Xml_generator       &xml,
 			});
 		});
 
-		import.for_each_verified_archive([&] (Archive::Path const &path) {
+		import.for_each_extracting_archive([&] (Archive::Path const &path) {
 
 			typedef String<160> Path;
 
@@ -24,6 +24,10 @@ void Depot_download_manager::gen_fetchurl_start_content(Xml_generator &xml,
 	                         Cap_quota{500}, Ram_quota{8*1024*1024});
 
 	xml.node("config", [&] () {
+
+		/* download several archives at once over reused connections */
+		xml.attribute("parallel", 4);
+
 		xml.node("libc", [&] () {
 			xml.attribute("stdout", "/dev/log");
 			xml.attribute("stderr", "/dev/log");
@@ -42,17 +42,18 @@ class Depot_download_manager::Import
 				typedef String<32> Bytes;
 				Bytes total, now;
 
-				bool complete() const
-				{
-					/* fetchurl has not yet determined the file size */
-					if (total == "0.0")
-						return false;
+				/* fetchurl has written and closed the file */
+				bool finished;
 
-					return now == total;
-				}
+				bool complete() const { return finished; }
 			};
 
 			virtual Info download_progress(Archive::Path const &) const = 0;
+
+			/**
+			 * Return progress of the download of the archive's signature
+			 */
+			virtual Info signature_progress(Archive::Path const &) const = 0;
 		};
 
 	private:
@@ -69,6 +70,7 @@ class Depot_download_manager::Import
 			             VERIFICATION_IN_PROGRESS,
 			             VERIFIED,
 			             VERIFICATION_FAILED,
+			             EXTRACTION_IN_PROGRESS,
 			             UNPACKED };
 
 			State state = DOWNLOAD_IN_PROGRESS;
@@ -78,7 +80,8 @@ class Depot_download_manager::Import
 				return state == DOWNLOAD_IN_PROGRESS
 				    || state == DOWNLOAD_COMPLETE
 				    || state == VERIFICATION_IN_PROGRESS
-				    || state == VERIFIED;
+				    || state == VERIFIED
+				    || state == EXTRACTION_IN_PROGRESS;
 			}
 
 			Item(Registry<Item> &registry, Archive::Path const &path)
@@ -95,6 +98,7 @@ class Depot_download_manager::Import
 				case VERIFICATION_IN_PROGRESS: return "verify";
 				case VERIFIED:                 return "extract";
 				case VERIFICATION_FAILED:      return "corrupted";
+				case EXTRACTION_IN_PROGRESS:   return "extract";
 				case UNPACKED:                 return "done";
 				};
 				return "";
@@ -186,6 +190,11 @@ class Depot_download_manager::Import
 			return _item_state_exists(Item::VERIFIED);
 		}
 
+		bool extraction_in_progress() const
+		{
+			return _item_state_exists(Item::EXTRACTION_IN_PROGRESS);
+		}
+
 		template <typename FN>
 		void for_each_download(FN const &fn) const
 		{
@@ -199,9 +208,9 @@ class Depot_download_manager::Import
 		}
 
 		template <typename FN>
-		void for_each_verified_archive(FN const &fn) const
+		void for_each_extracting_archive(FN const &fn) const
 		{
-			_for_each_item(Item::VERIFIED, fn);
+			_for_each_item(Item::EXTRACTION_IN_PROGRESS, fn);
 		}
 
 		template <typename FN>
@@ -236,7 +245,8 @@ class Depot_download_manager::Import
 			_items.for_each([&] (Item &item) {
 
 				if (item.state == Item::DOWNLOAD_IN_PROGRESS
-				 && progress.download_progress(item.path).complete()) {
+				 && progress.download_progress(item.path).complete()
+				 && progress.signature_progress(item.path).complete()) {
 
 					item.state = Item::DOWNLOAD_COMPLETE;
 				}
@@ -266,10 +276,20 @@ class Depot_download_manager::Import
 						item.state = Item::VERIFICATION_FAILED; });
 		}
 
-		void all_verified_archives_extracted()
+		/**
+		 * Hand all verified archives to the next extraction
+		 */
+		void extract_all_verified_archives()
 		{
 			_items.for_each([&] (Item &item) {
 				if (item.state == Item::VERIFIED)
+					item.state = Item::EXTRACTION_IN_PROGRESS; });
+		}
+
+		void all_extracting_archives_extracted()
+		{
+			_items.for_each([&] (Item &item) {
+				if (item.state == Item::EXTRACTION_IN_PROGRESS)
 					item.state = Item::UNPACKED; });
 		}
 
@@ -35,13 +35,14 @@ struct Depot_download_manager::Job : List_model<Job>::Element
 
 	Job(Archive::Path const &path) : path(path) { }
 
-	struct Update_policy
+	struct Update_policy : List_model<Job>::Keyed_update_policy
 	{
 		typedef Job Element;
 
 		Allocator &_alloc;
 
-		Update_policy(Allocator &alloc) : _alloc(alloc) { }
+		Update_policy(Allocator &alloc)
+		: Keyed_update_policy(alloc), _alloc(alloc) { }
 
 		void destroy_element(Job &elem) { destroy(_alloc, &elem); }
 
@@ -59,6 +60,12 @@ struct Depot_download_manager::Job : List_model<Job>::Element
 		}
 
 		static bool node_is_element(Xml_node) { return true; }
+
+		static unsigned long element_key(Job const &job) {
+			return key(job.path); }
+
+		static unsigned long xml_node_key(Xml_node node) {
+			return key(node.attribute_value("path", Archive::Path())); }
 	};
 };
 
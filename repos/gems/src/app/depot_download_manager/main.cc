@@ -35,11 +35,22 @@ struct Depot_download_manager::Child_exit_state
 	int  code   = 0;
 
 	typedef String<64> Name;
+	typedef String<16> Version;
 
-	Child_exit_state(Xml_node init_state, Name const &name)
+	/**
+	 * Constructor
+	 *
+	 * \param version  if valid, consider the child only if its version
+	 *                 matches, which prevents the misinterpretation of the
+	 *                 state of a previous instance
+	 */
+	Child_exit_state(Xml_node init_state, Name const &name,
+	                 Version const &version = Version())
 	{
 		init_state.for_each_sub_node("child", [&] (Xml_node child) {
-			if (child.attribute_value("name", Name()) == name) {
+			if (child.attribute_value("name", Name()) == name
+			 && (!version.valid()
+			  || child.attribute_value("version", Version()) == version)) {
 				exists = true;
 				if (child.has_attribute("exited")) {
 					exited = true;
@@ -100,6 +111,7 @@ struct Depot_download_manager::Main : Import::Download_progress
 	 */
 	Depot_query_version _depot_query_count { 1 };
 	Fetchurl_version    _fetchurl_count    { 1 };
+	Extract_version     _extract_count     { 1 };
 
 	unsigned const _fetchurl_max_attempts = 3;
 	unsigned       _fetchurl_attempt      = 0;
@@ -111,24 +123,42 @@ struct Depot_download_manager::Main : Import::Download_progress
 	Constructible<Import> _import { };
 
 	/**
-	 * Download_progress interface
+	 * Return progress of the fetch of 'path' with the given file suffix
 	 */
-	Info download_progress(Archive::Path const &path) const override
+	Info _fetch_progress(Archive::Path const &path, char const *suffix) const
 	{
-		Info result { Info::Bytes(), Info::Bytes() };
+		Info result { Info::Bytes(), Info::Bytes(), false };
 		try {
-			Url const url_path(_current_user_url(), "/", Archive::download_file_path(path));
+			Url const url_path(_current_user_url(), "/",
+			                   Archive::download_file_path(path), suffix);
 
 			/* search fetchurl progress report for matching 'url_path' */
 			_fetchurl_progress.xml().for_each_sub_node("fetch", [&] (Xml_node fetch) {
 				if (fetch.attribute_value("url", Url()) == url_path)
-					result = { .total = fetch.attribute_value("total", Info::Bytes()),
-					           .now   = fetch.attribute_value("now",   Info::Bytes()) }; });
+					result = { .total    = fetch.attribute_value("total", Info::Bytes()),
+					           .now      = fetch.attribute_value("now",   Info::Bytes()),
+					           .finished = fetch.attribute_value("finished", false) }; });
 
 		} catch (Invalid_download_url) { }
 		return result;
 	}
 
+	/**
+	 * Download_progress interface
+	 */
+	Info download_progress(Archive::Path const &path) const override
+	{
+		return _fetch_progress(path, "");
+	}
+
+	/**
+	 * Download_progress interface
+	 */
+	Info signature_progress(Archive::Path const &path) const override
+	{
+		return _fetch_progress(path, ".sig");
+	}
+
 	void _update_state_report()
 	{
 		_state_reporter.generate([&] (Xml_generator &xml) {
@@ -211,8 +241,17 @@ struct Depot_download_manager::Main : Import::Download_progress
 		if (_import.constructed()) {
 			_import->apply_download_progress(*this);
 
-			/* proceed with next import step if all downloads are done or failed */
-			if (!_import->downloads_in_progress())
+			/*
+			 * Verify each archive as soon as it is downloaded, while the
+			 * remaining downloads are still in progress.
+			 */
+			if (_import->completed_downloads_available()) {
+				_import->verify_all_downloaded_archives();
+				_generate_init_config();
+			}
+
+			/* stop fetchurl if all downloads are done or failed */
+			else if (!_import->downloads_in_progress())
 				_generate_init_config();
 		}
 
@@ -331,14 +370,14 @@ void Depot_download_manager::Main::_generate_init_config(Xml_generator &xml)
 		xml.node("start", [&] () {
 			gen_verify_start_content(xml, *_import, _current_user_path()); });
 
-	if (_import.constructed() && _import->verified_archives_available()) {
+	if (_import.constructed() && _import->extraction_in_progress()) {
 
 		xml.node("start", [&] () {
 			gen_chroot_start_content(xml, _current_user_name());  });
 
 		xml.node("start", [&] () {
 			gen_extract_start_content(xml, *_import, _current_user_path(),
-			                          _current_user_name()); });
+			                          _current_user_name(), _extract_count); });
 	}
 
 	_fetchurl_watchdog.conditional(fetchurl_running, *this);
@@ -489,7 +528,7 @@ void Depot_download_manager::Main::_handle_init_state()
 		}
 	}
 
-	if (!import.downloads_in_progress() && import.completed_downloads_available()) {
+	if (import.completed_downloads_available()) {
 		import.verify_all_downloaded_archives();
 		reconfigure_init = true;
 	}
@@ -521,15 +560,29 @@ void Depot_download_manager::Main::_handle_init_state()
 		});
 	}
 
-	if (import.verified_archives_available()) {
+	if (import.extraction_in_progress()) {
 
-		Child_exit_state const extract_state(_init_state.xml(), "extract");
+		Child_exit_state const extract_state(_init_state.xml(), "extract",
+		                                     Child_exit_state::Version(_extract_count.value));
 
 		if (extract_state.exited && extract_state.code != 0)
 			error("extract failed with exit code ", extract_state.code);
 
-		if (extract_state.exited && extract_state.code == 0)
-			import.all_verified_archives_extracted();
+		if (extract_state.exited && extract_state.code == 0) {
+			import.all_extracting_archives_extracted();
+			reconfigure_init = true;
+		}
+	}
+
+	/*
+	 * Extract the archives verified so far while other archives are still
+	 * being downloaded or verified. Each batch is extracted by a new
+	 * instance of the extract component.
+	 */
+	if (!import.extraction_in_progress() && import.verified_archives_available()) {
+		import.extract_all_verified_archives();
+		_extract_count.value++;
+		reconfigure_init = true;
 	}
 
 	/* flag failed jobs to prevent re-attempts in subsequent import iterations */
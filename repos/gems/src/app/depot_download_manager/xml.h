@@ -96,7 +96,8 @@ namespace Depot_download_manager {
 	void gen_chroot_start_content(Xml_generator &, Archive::User const &);
 
 	void gen_extract_start_content(Xml_generator &, Import const &,
-	                               Path const &, Archive::User const &);
+	                               Path const &, Archive::User const &,
+	                               Extract_version);
 }
 
 #endif /* _GENERATE_XML_H_ */
@@ -0,0 +1,153 @@
+/*
+ * \brief  Cache of remote-file content
+ * \author agent
+ * \date   2026-10-19
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+#ifndef _CACHE_H_
+#define _CACHE_H_
+
+/* Genode includes */
+#include <base/attached_ram_dataspace.h>
+#include <util/construct_at.h>
+
+class Cache
+{
+	typedef Genode::size_t size_t;
+
+	public:
+
+		/**
+		 * Chunk of the remote file, the unit of caching
+		 */
+		struct Chunk
+		{
+			enum State { FREE, FETCHING, VALID };
+
+			State         state     = FREE;
+			size_t        index     = 0;        /* chunk number within file */
+			unsigned      users     = 0;        /* requests waiting for chunk */
+			unsigned long last_used = 0;
+			char         *data      = nullptr;
+
+			bool evictable() const {
+				return state == FREE || (state == VALID && users == 0); }
+		};
+
+	private:
+
+		/*
+		 * Noncopyable
+		 */
+		Cache(Cache const &);
+		Cache &operator = (Cache const &);
+
+		Genode::Allocator             &_alloc;
+		Genode::Attached_ram_dataspace _ds;
+
+		size_t   const _chunk_size;
+		unsigned const _num_chunks;
+
+		Chunk * const _chunks;
+
+		unsigned long _use_count = 0;
+
+		template <typename FN>
+		void _for_each_chunk(FN const &fn)
+		{
+			for (unsigned i = 0; i < _num_chunks; i++)
+				fn(_chunks[i]);
+		}
+
+	public:
+
+		Cache(Genode::Ram_allocator &ram, Genode::Region_map &rm,
+		      Genode::Allocator &alloc, size_t size, size_t chunk_size)
+		:
+			_alloc(alloc), _ds(ram, rm, size),
+			_chunk_size(chunk_size), _num_chunks(size/chunk_size),
+			_chunks((Chunk *)alloc.alloc(_num_chunks*sizeof(Chunk)))
+		{
+			for (unsigned i = 0; i < _num_chunks; i++) {
+				Genode::construct_at<Chunk>(&_chunks[i]);
+				_chunks[i].data = _ds.local_addr<char>() + i*chunk_size;
+			}
+		}
+
+		~Cache() { _alloc.free(_chunks, _num_chunks*sizeof(Chunk)); }
+
+		size_t   chunk_size() const { return _chunk_size; }
+		unsigned num_chunks() const { return _num_chunks; }
+
+		/**
+		 * Return chunk of the file at 'index', or nullptr if not cached
+		 */
+		Chunk *lookup(size_t index)
+		{
+			Chunk *result = nullptr;
+			_for_each_chunk([&] (Chunk &chunk) {
+				if (chunk.state != Chunk::FREE && chunk.index == index)
+					result = &chunk; });
+			return result;
+		}
+
+		/**
+		 * Allocate chunk for the file content at 'index'
+		 *
+		 * If no chunk is free, the least recently used chunk is evicted.
+		 *
+		 * \return chunk in state 'FETCHING', or nullptr if all chunks are
+		 *         in use
+		 */
+		Chunk *alloc(size_t index)
+		{
+			Chunk *victim = nullptr;
+			_for_each_chunk([&] (Chunk &chunk) {
+
+				if (!chunk.evictable())
+					return;
+
+				if (!victim || victim->state != Chunk::FREE)
+					if (chunk.state == Chunk::FREE || !victim
+					 || chunk.last_used < victim->last_used)
+						victim = &chunk;
+			});
+
+			if (!victim)
+				return nullptr;
+
+			victim->state = Chunk::FETCHING;
+			victim->index = index;
+			victim->users = 0;
+			touch(*victim);
+			return victim;
+		}
+
+		void free(Chunk &chunk)
+		{
+			chunk.state = Chunk::FREE;
+			chunk.users = 0;
+		}
+
+		void touch(Chunk &chunk) { chunk.last_used = ++_use_count; }
+
+		/**
+		 * Return number of chunks that can be allocated
+		 */
+		unsigned num_evictable()
+		{
+			unsigned count = 0;
+			_for_each_chunk([&] (Chunk &chunk) {
+				if (chunk.evictable()) count++; });
+			return count;
+		}
+};
+
+#endif /* _CACHE_H_ */
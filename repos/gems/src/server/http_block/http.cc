@@ -5,7 +5,7 @@
  */
 
 /*
- * Copyright (C) 2010-2017 Genode Labs GmbH
+ * Copyright (C) 2010-2019 Genode Labs GmbH
  *
  * This file is part of the Genode OS framework, which is distributed
  * under the terms of the GNU Affero General Public License version 3.
@@ -30,8 +30,8 @@ enum {
 	HTTP_SUCC_OK      = 200,
 	HTTP_SUCC_PARTIAL = 206,
 
-	/* Size of our local buffer */
-	HTTP_BUF = 2048,
+	/* size of request buffer */
+	HTTP_BUF = 512,
 };
 
 /* Tokenizer policy */
@@ -46,22 +46,35 @@ struct Scanner_policy_file
 typedef ::Genode::Token<Scanner_policy_file> Http_token;
 
 
-void Http::cmd_head()
+/**
+ * Return token of the value of header field 'key'
+ */
+static Http_token header_value(char const *header, size_t len, char const *key)
 {
-	const char *http_templ = "%s %s HTTP/1.1\r\n"
-	                         "Host: %s\r\n"
-	                         "\r\n";
+	bool key_found = false;
 
-	int length = snprintf(_http_buf, HTTP_BUF, http_templ, "HEAD", _path, _host);
+	for (Http_token t(header, len); t; t = t.next()) {
 
-	if (write(_fd, _http_buf, length) != length) {
-		error("cmd_head: write error");
-		throw Http::Socket_error();
+		if (t.type() != Http_token::IDENT)
+			continue;
+
+		if (key_found)
+			return t;
+
+		char buf[32];
+		t.string(buf, sizeof(buf));
+
+		key_found = !Genode::strcmp(buf, key, sizeof(buf));
 	}
+	return Http_token();
 }
 
 
-void Http::connect()
+/**********************
+ ** Http::Connection **
+ **********************/
+
+void Http::Connection::_connect()
 {
 	_fd = socket(AF_INET, SOCK_STREAM, 0);
 	if (_fd < 0) {
@@ -69,128 +82,250 @@ void Http::connect()
 		throw Http::Socket_error();
 	}
 
-	if (::connect(_fd, _info->ai_addr, sizeof(*(_info->ai_addr))) < 0) {
+	if (::connect(_fd, _http._info->ai_addr, sizeof(*(_http._info->ai_addr))) < 0) {
 		error("connect: connect failed");
+		_close();
 		throw Http::Socket_error();
 	}
 }
 
 
-void Http::reconnect(){ close(_fd); connect(); }
+void Http::Connection::_close()
+{
+	if (_fd >= 0)
+		close(_fd);
 
+	_fd = -1;
 
-void Http::resolve_uri()
+	_buf_start = _buf_end = 0;
+	_body_remaining = 0;
+	_pending = false;
+}
+
+
+void Http::Connection::_fill()
 {
-	struct addrinfo *info;
-	if (getaddrinfo(_host, _port, 0, &info)) {
-		error("host ", Cstring(_host), " not found");
-		throw Http::Uri_error();
+	/* move unconsumed data to the start of the buffer */
+	if (_buf_start) {
+		memmove(_buf, _buf + _buf_start, _buf_end - _buf_start);
+		_buf_end  -= _buf_start;
+		_buf_start = 0;
 	}
 
-	_heap.alloc(sizeof(struct addrinfo), (void**)&_info);
-	Genode::memcpy(_info, info, sizeof(struct addrinfo));
+	if (_buf_end == BUF_SIZE) {
+		error("read_header: buffer overflow");
+		_close();
+		throw Http::Socket_error();
+	}
+
+	ssize_t const n = read(_fd, _buf + _buf_end, BUF_SIZE - _buf_end);
+	if (n <= 0) {
+		_close();
+		throw Http::Socket_closed();
+	}
+
+	_buf_end += n;
 }
 
 
-Genode::size_t Http::read_header()
+void Http::Connection::_send(char const *request, size_t length)
 {
-	bool header = true; size_t i = 0;
-
-	while (header) {
-		if (!read(_fd, &_http_buf[i], 1))
-			throw Http::Socket_closed();
+	/*
+	 * A failed write on an existing connection is retried once on a new
+	 * connection because the host may have closed the idle connection.
+	 */
+	for (unsigned attempt = 0; ; attempt++) {
+
+		if (_fd < 0)
+			_connect();
+
+		if (write(_fd, request, length) == (ssize_t)length) {
+			_pending = true;
+			return;
+		}
 
-		if (i >= 3 && _http_buf[i - 3] == '\r' && _http_buf[i - 2] == '\n'
-		 && _http_buf[i - 1] == '\r' && _http_buf[i - 0] == '\n')
-			header = false;
+		_close();
 
-		if (++i >= HTTP_BUF) {
-			error("read_header: buffer overflow");
+		if (attempt) {
+			error("could not send request (", errno, ")");
 			throw Http::Socket_error();
 		}
 	}
+}
+
+
+unsigned Http::Connection::_read_header(size_t &content_length)
+{
+	if (_fd < 0)
+		throw Http::Socket_closed();
+
+	/* receive data until the end of the header is buffered */
+	size_t len = 0;
+	for (size_t i = 3; !len; i++) {
+
+		while (_buf_start + i >= _buf_end)
+			_fill();
+
+		char const *b = _buf + _buf_start + i;
+		if (b[-3] == '\r' && b[-2] == '\n' && b[-1] == '\r' && b[0] == '\n')
+			len = i + 1;
+	}
+
+	char const * const header = _buf + _buf_start;
+	_buf_start += len;
 
 	/* scan for status code */
-	Http_token t(_http_buf, i);
-	for (int count = 0;; t = t.next()) {
+	unsigned status = 0;
+	Http_token t(header, len);
+	for (int count = 0; t; t = t.next()) {
 
 		if (t.type() != Http_token::IDENT)
 			continue;
 
 		if (count) {
-			ascii_to(t.start(), _http_ret);
+			ascii_to(t.start(), status);
 			break;
 		}
 
 		count++;
 	}
 
-	return i;
+	content_length = 0;
+	Http_token const length = header_value(header, len, "Content-Length");
+	if (length)
+		ascii_to(length.start(), content_length);
+
+	Http_token const connection = header_value(header, len, "Connection");
+	_close_after_response = connection
+	                     && !Genode::strcmp(connection.start(), "close", 5);
+
+	return status;
 }
 
 
-void Http::get_capacity()
+Genode::size_t Http::Connection::head()
 {
-	cmd_head();
-	size_t  len = read_header();
-	char buf[32];
-	Http_token t(_http_buf, len);
+	char request[HTTP_BUF];
+	int const length = snprintf(request, sizeof(request),
+	                            "HEAD %s HTTP/1.1\r\n"
+	                            "Host: %s\r\n"
+	                            "\r\n", _http._path, _http._host);
 
-	bool key = false;
-	while (t) {
+	_send(request, length);
+	_pending = false;
 
-		if (t.type() != Http_token::IDENT) {
-			t = t.next();
-			continue;
-		}
+	size_t size = 0;
+	_read_header(size);
 
-		if (key) {
-			ascii_to(t.start(), _size);
-			break;
-		}
+	if (_close_after_response)
+		_close();
+
+	return size;
+}
+
+
+void Http::Connection::send_get(size_t file_offset, size_t size)
+{
+	char request[HTTP_BUF];
+	int const length = snprintf(request, sizeof(request),
+	                            "GET %s HTTP/1.1\r\n"
+	                            "Host: %s\r\n"
+	                            "Range: bytes=%lu-%lu\r\n"
+	                            "Connection: keep-alive\r\n"
+	                            "\r\n", _http._path, _http._host,
+	                            file_offset, file_offset + size - 1);
+
+	_send(request, length);
+}
 
-		t.string(buf, 32);
 
-		if (!Genode::strcmp(buf, "Content-Length", 32))
-			key = true;
+void Http::Connection::receive_header(size_t size)
+{
+	_pending = false;
+
+	size_t content_length = 0;
+	unsigned const status = _read_header(content_length);
 
-		t = t.next();
+	if (status != HTTP_SUCC_PARTIAL || content_length != size) {
+		error("cmd_get: server returned ", status, " with ",
+		      content_length, " instead of ", size, " bytes");
+		_close();
+		throw Http::Server_error();
 	}
+
+	_body_remaining = size;
 }
 
 
-void Http::do_read(void * buf, size_t size)
+void Http::Connection::receive_body(void *dst, size_t size)
 {
-	size_t buf_fill = 0;
+	size = min(size, _body_remaining);
+
+	/* consume buffered data */
+	size_t const buffered = min(size, _buf_end - _buf_start);
+	memcpy(dst, _buf + _buf_start, buffered);
+	_buf_start += buffered;
 
-	while (buf_fill < size) {
+	/* read remaining data directly into the destination */
+	for (size_t fill = buffered; fill < size; ) {
 
-		int part;
-		if ((part = read(_fd, (void *)((addr_t)buf + buf_fill),
-		                      size - buf_fill)) <= 0) {
+		ssize_t const part = read(_fd, (char *)dst + fill, size - fill);
+		if (part <= 0) {
 			error("could not read data (", errno, ")");
-			throw Http::Socket_error();
+			_close();
+			throw Http::Socket_closed();
 		}
 
-		buf_fill += part;
+		fill += part;
 	}
+
+	_body_remaining -= size;
+
+	if (!_body_remaining && _close_after_response)
+		_close();
+}
+
+
+/**********
+ ** Http **
+ **********/
+
+void Http::resolve_uri()
+{
+	struct addrinfo *info;
+	if (getaddrinfo(_host, _port, 0, &info)) {
+		error("host ", Cstring(_host), " not found");
+		throw Http::Uri_error();
+	}
+
+	_heap.alloc(sizeof(struct addrinfo), (void**)&_info);
+	Genode::memcpy(_info, info, sizeof(struct addrinfo));
+}
+
+
+void Http::get_capacity()
+{
+	Connection *connection = new (&_heap) Connection(*this);
+
+	try { _size = connection->head(); }
+	catch (...) {
+		destroy(&_heap, connection);
+		throw;
+	}
+
+	destroy(&_heap, connection);
 }
 
 
 Http::Http(Genode::Heap &heap, ::String const &uri)
 : _heap(heap), _port((char *)"80")
 {
-	_heap.alloc(HTTP_BUF, (void**)&_http_buf);
-
 	/* parse URI */
 	parse_uri(uri);
 
 	/* search for host */
 	resolve_uri();
 
-	/* connect to host */
-	connect();
-
 	/* retrieve file info */
 	get_capacity();
 }
@@ -200,7 +335,6 @@ Http::~Http()
 {
 	_heap.free(_host, Genode::strlen(_host) + 1);
 	_heap.free(_path, Genode::strlen(_path) + 2);
-	_heap.free(_http_buf, HTTP_BUF);
 	_heap.free(_info, sizeof(struct addrinfo));
 }
 
@@ -235,42 +369,3 @@ void Http::parse_uri(::String const &u)
 		_host[i] = '\0';
 	}
 }
-
-
-void Http::cmd_get(size_t file_offset, size_t size, addr_t buffer)
-{
-	while (true) {
-
-		const char *http_templ = "GET %s HTTP/1.1\r\n"
-		                         "Host: %s\r\n"
-		                         "Range: bytes=%lu-%lu\r\n"
-		                         "\r\n";
-
-		int length = snprintf(_http_buf, HTTP_BUF, http_templ, _path, _host,
-		                      file_offset, file_offset + size - 1);
-
-		if (write(_fd, _http_buf, length) < 0) {
-
-			if (errno == ESHUTDOWN)
-				reconnect();
-
-			if (write(_fd, _http_buf, length) < 0)
-				throw Http::Socket_error();
-		}
-
-		try {
-			read_header();
-		} catch (Http::Socket_closed) {
-			reconnect();
-			continue;
-		}
-
-		if (_http_ret != HTTP_SUCC_PARTIAL) {
-			error("cmd_get: server returned ", _http_ret);
-			throw Http::Server_error();
-		}
-
-		do_read((void *)(buffer), size);
-		return;
-	}
-}
@@ -5,7 +5,7 @@
  */
 
 /*
- * Copyright (C) 2010-2017 Genode Labs GmbH
+ * Copyright (C) 2010-2019 Genode Labs GmbH
  *
  * This file is part of the Genode OS framework, which is distributed
  * under the terms of the GNU Affero General Public License version 3.
@@ -25,33 +25,24 @@ class Http
 	typedef Genode::addr_t addr_t;
 	typedef Genode::off_t  off_t;
 
-	private:
+	public:
 
-		Genode::Heap   &_heap;
-		size_t           _size;      /* number of bytes in file */
-		char            *_host;      /* host name */
-		char            *_port;      /* host port */
-		char            *_path;      /* absolute file path on host */
-		char            *_http_buf;  /* internal data buffer */
-		unsigned         _http_ret;  /* HTTP status code */
-		struct addrinfo *_info;      /* Resolved address info for host */
-		int              _fd;        /* Socket file handle */
-		addr_t          _base_addr; /* Address of I/O dataspace */
+		class Connection;
 
-		/*
-		 * Send 'HEAD' command
-		 */
-		void cmd_head();
+	private:
 
 		/*
-		 * Connect to host
+		 * Noncopyable
 		 */
-		void connect();
+		Http(Http const &);
+		Http &operator = (Http const &);
 
-		/*
-		 * Re-connect to host
-		 */
-		void reconnect();
+		Genode::Heap    &_heap;
+		size_t           _size = 0;           /* number of bytes in file */
+		char            *_host = nullptr;     /* host name */
+		char            *_port;               /* host port */
+		char            *_path = nullptr;     /* absolute file path on host */
+		struct addrinfo *_info = nullptr;     /* resolved address of host */
 
 		/*
 		 * Set URI of remote file
@@ -63,21 +54,11 @@ class Http
 		 */
 		void resolve_uri();
 
-		/*
-		 * Read HTTP header and parse server-status code
-		 */
-		size_t read_header();
-
 		/*
 		 * Determine remote-file size
 		 */
 		void get_capacity();
 
-		/*
-		 * Read 'size' bytes into buffer
-		 */
-		void do_read(void * buf, size_t size);
-
 	public:
 
 		/*
@@ -97,28 +78,122 @@ class Http
 		 */
 		size_t file_size() const { return _size; }
 
+		/* Exceptions */
+		class Exception     : public ::Genode::Exception { };
+		class Uri_error     : public Exception { };
+		class Socket_error  : public Exception { };
+		class Socket_closed : public Exception { };
+		class Server_error  : public Exception { };
+};
+
+
+/**
+ * Persistent connection to the host of the remote file
+ *
+ * The connection is kept open across requests (HTTP keep-alive). Data
+ * received from the host is buffered so that the response header is parsed
+ * from the buffer rather than read byte by byte. If the host closed the
+ * connection, the connection is re-established with the next request.
+ */
+class Http::Connection
+{
+	private:
+
+		/*
+		 * Noncopyable
+		 */
+		Connection(Connection const &);
+		Connection &operator = (Connection const &);
+
+		enum { BUF_SIZE = 16*1024 };
+
+		Http &_http;
+
+		int _fd = -1;
+
+		char   _buf[BUF_SIZE];
+		size_t _buf_start = 0;   /* first byte not consumed yet */
+		size_t _buf_end   = 0;   /* end of received data */
+
+		/* request sent but response not received yet */
+		bool _pending = false;
+
+		/* bytes of the current response body not received yet */
+		size_t _body_remaining = 0;
+
+		/* host announced to close the connection after the response */
+		bool _close_after_response = false;
+
+		void _connect();
+
+		void _close();
+
 		/**
-		 * Set base address of I/O dataspace
+		 * Receive available data into the buffer
 		 *
-		 * \param base_addr  Base of dataspace
+		 * \throw Socket_closed
+		 */
+		void _fill();
+
+		/**
+		 * Send request to host, re-connect if needed
 		 */
-		void  base_addr(addr_t base_addr) { _base_addr = base_addr; }
+		void _send(char const *request, size_t length);
 
 		/**
-		 * Send 'GET' command
+		 * Read response header
 		 *
-		 * \param file_offset  Read from offset of remote file
-		 * \param size         Number of byts to transfer
-		 * \param buffer       address in I/O dataspace
+		 * \return HTTP status code
 		 */
-		void cmd_get(size_t file_offset, size_t size, addr_t buffer);
+		unsigned _read_header(size_t &content_length);
 
-		/* Exceptions */
-		class Exception     : public ::Genode::Exception { };
-		class Uri_error     : public Exception { };
-		class Socket_error  : public Exception { };
-		class Socket_closed : public Exception { };
-		class Server_error  : public Exception { };
+	public:
+
+		Connection(Http &http) : _http(http) { }
+
+		~Connection() { _close(); }
+
+		/**
+		 * Socket of the connection, for waiting on the response
+		 */
+		int fd() const { return _fd; }
+
+		bool pending() const { return _pending; }
+
+		/**
+		 * Return true if response data is already buffered
+		 */
+		bool buffered() const { return _buf_end > _buf_start; }
+
+		/**
+		 * Send 'HEAD' command and return size of remote file
+		 */
+		size_t head();
+
+		/**
+		 * Send 'GET' command for a range of the remote file
+		 *
+		 * \param file_offset  read from offset of remote file
+		 * \param size         number of bytes to transfer
+		 */
+		void send_get(size_t file_offset, size_t size);
+
+		/**
+		 * Receive header of the response to the 'GET' command sent last
+		 *
+		 * \param size  expected size of the response body
+		 *
+		 * \throw Server_error   host did not respond with the requested range
+		 * \throw Socket_closed  host closed the connection
+		 */
+		void receive_header(size_t size);
+
+		/**
+		 * Receive part of the response body
+		 *
+		 * \throw Socket_closed
+		 */
+		void receive_body(void *dst, size_t size);
 };
 
 #endif /* _HTTP_H_ */
@@ -6,7 +6,7 @@
  */
 
 /*
- * Copyright (C) 2010-2017 Genode Labs GmbH
+ * Copyright (C) 2010-2019 Genode Labs GmbH
  *
  * This file is part of the Genode OS framework, which is distributed
  * under the terms of the GNU Affero General Public License version 3.
@@ -17,25 +17,426 @@
 #include <base/log.h>
 #include <block/component.h>
 #include <libc/component.h>
+#include <libc/select.h>
+#include <util/fifo.h>
 
 /* local includes */
 #include "http.h"
+#include "cache.h"
 
 using namespace Genode;
 
+
+/**
+ * Parameters of the driver as given by the configuration
+ */
+struct Parameters
+{
+	size_t   block_size;
+	size_t   cache_size;
+	size_t   chunk_size;
+	unsigned read_ahead;
+	unsigned connections;
+};
+
+
+/**
+ * Block driver for a file on an HTTP server
+ *
+ * The file content is fetched in chunks, which are kept in a cache. Chunks
+ * are requested via several persistent connections in parallel so that
+ * block requests are completed in the order the chunks arrive. When the
+ * client reads sequentially, the chunks following the requested ones are
+ * fetched ahead of time. Consecutive missing chunks are combined into a
+ * single range request.
+ */
 class Driver : public Block::Driver
 {
 	private:
 
-		size_t _block_size;
-		Http   _http;
+		/*
+		 * Noncopyable
+		 */
+		Driver(Driver const &);
+		Driver &operator = (Driver const &);
+
+		typedef Http::Connection Connection;
+		typedef Cache::Chunk     Chunk;
+
+		enum { MAX_REQUESTS = 64, MAX_CONNECTIONS = 16, MAX_ATTEMPTS = 3 };
+
+		/**
+		 * Block request waiting for chunks
+		 */
+		struct Request
+		{
+			bool                      valid  = false;
+			Block::Packet_descriptor  packet { };
+			char                     *buffer = nullptr;
+			size_t                    offset = 0;
+			size_t                    size   = 0;
+		};
+
+		/**
+		 * Range request for consecutive chunks
+		 */
+		struct Fetch : Fifo<Fetch>::Element
+		{
+			size_t   const first;   /* index of first chunk */
+			size_t         count    = 1;
+			unsigned       attempts = 0;
+
+			Fetch(size_t first) : first(first) { }
+		};
+
+		struct Channel
+		{
+			Connection *connection = nullptr;
+			Fetch      *fetch      = nullptr;
+		};
+
+		Heap &_heap;
+
+		Parameters const _params;
+
+		Http _http;
+
+		size_t const _file_chunks;
+
+		Cache _cache;
+
+		Request _requests[MAX_REQUESTS];
+
+		Channel _channels[MAX_CONNECTIONS];
+
+		unsigned const _num_channels = min(max(_params.connections, 1U),
+		                                   (unsigned)MAX_CONNECTIONS);
+
+		/* fetches waiting for a connection */
+		Fifo<Fetch> _queue { };
+
+		/* fetch that is still being extended by consecutive chunks */
+		Fetch *_collecting = nullptr;
+
+		/* last chunk of the previous request, for detecting sequential reads */
+		size_t _last_chunk = ~0UL;
+
+		bool _processing = false;
+
+		Libc::Select_handler<Driver> _select_handler {
+			*this, &Driver::_select_ready };
+
+		size_t _chunk_offset(size_t index) const {
+			return index*_cache.chunk_size(); }
+
+		size_t _chunk_length(size_t index) const {
+			return min(_cache.chunk_size(),
+			           _http.file_size() - _chunk_offset(index)); }
+
+		size_t _fetch_size(Fetch const &fetch) const
+		{
+			size_t const last = fetch.first + fetch.count - 1;
+			return _chunk_offset(last) + _chunk_length(last)
+			     - _chunk_offset(fetch.first);
+		}
+
+		template <typename FN>
+		void _for_each_chunk_index(Request const &request, FN const &fn)
+		{
+			size_t const chunk_size = _cache.chunk_size();
+			size_t const last = (request.offset + request.size - 1)/chunk_size;
+			for (size_t index = request.offset/chunk_size; index <= last; index++)
+				fn(index);
+		}
+
+		/**
+		 * Allocate chunk at 'index' and schedule its fetching
+		 */
+		Chunk &_fetch_chunk(size_t index)
+		{
+			Chunk &chunk = *_cache.alloc(index);
+
+			if (_collecting && index == _collecting->first + _collecting->count) {
+				_collecting->count++;
+				return chunk;
+			}
+
+			_flush_collected();
+			_collecting = new (_heap) Fetch(index);
+			return chunk;
+		}
+
+		void _flush_collected()
+		{
+			if (_collecting)
+				_queue.enqueue(*_collecting);
+
+			_collecting = nullptr;
+		}
+
+		/**
+		 * Fetch chunks following 'last' if not present
+		 *
+		 * At most half of the cache is occupied by chunks being fetched, which
+		 * leaves room for the chunks of subsequent block requests.
+		 */
+		void _read_ahead(size_t last)
+		{
+			size_t const end = min(last + 1 + _params.read_ahead, _file_chunks);
+
+			for (size_t index = last + 1; index < end; index++) {
+
+				if (_cache.lookup(index))
+					continue;
+
+				if (_cache.num_evictable() <= _cache.num_chunks()/2)
+					break;
+
+				_fetch_chunk(index);
+			}
+		}
+
+		/**
+		 * Send queued fetches via idle connections
+		 */
+		void _issue_fetches()
+		{
+			for (unsigned i = 0; i < _num_channels && !_queue.empty(); i++) {
+
+				Channel &channel = _channels[i];
+				if (channel.fetch)
+					continue;
+
+				_queue.dequeue([&] (Fetch &fetch) {
+					try {
+						channel.connection->send_get(_chunk_offset(fetch.first),
+						                             _fetch_size(fetch));
+						channel.fetch = &fetch;
+					}
+					catch (Http::Exception) { _fail(fetch); }
+				});
+			}
+		}
+
+		void _release(Request &request, bool success)
+		{
+			_for_each_chunk_index(request, [&] (size_t index) {
+				Chunk *chunk = _cache.lookup(index);
+				if (chunk && chunk->users)
+					chunk->users--;
+			});
+
+			request.valid = false;
+			ack_packet(request.packet, success);
+		}
+
+		/**
+		 * Complete block requests whose chunks are present
+		 *
+		 * \return true if any request was completed
+		 */
+		bool _complete_requests()
+		{
+			bool progress = false;
+
+			for (Request &request : _requests) {
+
+				if (!request.valid)
+					continue;
+
+				bool complete = true;
+				_for_each_chunk_index(request, [&] (size_t index) {
+					Chunk const *chunk = _cache.lookup(index);
+					if (!chunk || chunk->state != Chunk::VALID)
+						complete = false;
+				});
+
+				if (!complete)
+					continue;
+
+				size_t const chunk_size = _cache.chunk_size();
+				size_t const end        = request.offset + request.size;
+
+				char *dst = request.buffer;
+				for (size_t pos = request.offset; pos < end; ) {
+					size_t const offset = pos % chunk_size;
+					size_t const length = min(chunk_size - offset, end - pos);
+
+					memcpy(dst, _cache.lookup(pos/chunk_size)->data + offset, length);
+
+					dst += length;
+					pos += length;
+				}
+
+				_release(request, true);
+				progress = true;
+			}
+
+			return progress;
+		}
+
+		/**
+		 * Fail fetch and the block requests that depend on it
+		 */
+		void _fail(Fetch &fetch)
+		{
+			size_t const end = fetch.first + fetch.count;
+
+			for (Request &request : _requests) {
+
+				if (!request.valid)
+					continue;
+
+				bool affected = false;
+				_for_each_chunk_index(request, [&] (size_t index) {
+					if (index >= fetch.first && index < end)
+						affected = true; });
+
+				if (affected)
+					_release(request, false);
+			}
+
+			for (size_t index = fetch.first; index < end; index++)
+				if (Chunk *chunk = _cache.lookup(index))
+					_cache.free(*chunk);
+
+			destroy(_heap, &fetch);
+		}
+
+		/**
+		 * Receive response for the fetch in flight at 'channel'
+		 */
+		void _receive(Channel &channel)
+		{
+			Fetch &fetch = *channel.fetch;
+			channel.fetch = nullptr;
+
+			size_t const end = fetch.first + fetch.count;
+
+			try {
+				channel.connection->receive_header(_fetch_size(fetch));
+
+				for (size_t index = fetch.first; index < end; index++)
+					channel.connection->receive_body(_cache.lookup(index)->data,
+					                                 _chunk_length(index));
+			}
+			catch (Http::Socket_closed) {
+
+				/* the host closed the connection, retry on a new one */
+				if (++fetch.attempts < MAX_ATTEMPTS) {
+					_queue.enqueue(fetch);
+					return;
+				}
+				error("fetching ", fetch.count, " chunks at offset ",
+				      _chunk_offset(fetch.first), " failed");
+				_fail(fetch);
+				return;
+			}
+			catch (Http::Exception) {
+				_fail(fetch);
+				return;
+			}
+
+			for (size_t index = fetch.first; index < end; index++)
+				_cache.lookup(index)->state = Chunk::VALID;
+
+			destroy(_heap, &fetch);
+		}
+
+		/**
+		 * Issue fetches, complete requests, and receive available responses
+		 *
+		 * Acknowledging a packet may lead to a nested call of 'read', which
+		 * merely registers the new request. It is processed by the loop below.
+		 * If no response is available, '_select_ready' is called once a
+		 * response arrives.
+		 */
+		void _process()
+		{
+			if (_processing)
+				return;
+
+			_processing = true;
+
+			for (;;) {
+				while (_complete_requests()) ;
+
+				_issue_fetches();
+
+				fd_set readfds, writefds, exceptfds;
+				FD_ZERO(&readfds);
+				FD_ZERO(&writefds);
+				FD_ZERO(&exceptfds);
+
+				int nfds = 0;
+				for (unsigned i = 0; i < _num_channels; i++) {
+					Channel const &channel = _channels[i];
+					if (!channel.fetch)
+						continue;
+
+					FD_SET(channel.connection->fd(), &readfds);
+					nfds = max(nfds, channel.connection->fd() + 1);
+				}
+
+				if (!nfds) {
+					if (_queue.empty())
+						break;
+					continue;
+				}
+
+				if (_select_handler.select(nfds, readfds, writefds, exceptfds) <= 0)
+					break;
+
+				for (unsigned i = 0; i < _num_channels; i++) {
+					Channel &channel = _channels[i];
+					if (channel.fetch && FD_ISSET(channel.connection->fd(), &readfds))
+						_receive(channel);
+				}
+			}
+
+			_processing = false;
+		}
+
+		void _select_ready(int, fd_set const &, fd_set const &, fd_set const &)
+		{
+			/* an active '_process' loop selects again by itself */
+			if (!_processing)
+				Libc::with_libc([&] () { _process(); });
+		}
+
+		Request *_alloc_request()
+		{
+			for (Request &request : _requests)
+				if (!request.valid)
+					return &request;
+
+			return nullptr;
+		}
 
 	public:
 
-		Driver(Heap &heap, Ram_allocator &ram,
-		       size_t block_size, ::String const &uri)
-		: Block::Driver(ram),
-		  _block_size(block_size), _http(heap, uri) {}
+		Driver(Heap &heap, Ram_allocator &ram, Region_map &rm,
+		       Parameters const &params, ::String const &uri)
+		:
+			Block::Driver(ram), _heap(heap), _params(params), _http(heap, uri),
+			_file_chunks((_http.file_size() + params.chunk_size - 1)/params.chunk_size),
+			_cache(ram, rm, heap, params.cache_size, params.chunk_size)
+		{
+			for (unsigned i = 0; i < _num_channels; i++)
+				_channels[i].connection = new (_heap) Connection(_http);
+		}
+
+		~Driver()
+		{
+			for (unsigned i = 0; i < _num_channels; i++) {
+				if (_channels[i].fetch)
+					destroy(_heap, _channels[i].fetch);
+				destroy(_heap, _channels[i].connection);
+			}
+
+			_flush_collected();
+			_queue.dequeue_all([&] (Fetch &fetch) { destroy(_heap, &fetch); });
+		}
 
 
 		/*******************************
@@ -44,22 +445,69 @@ class Driver : public Block::Driver
 
 		Block::Session::Info info() const override
 		{
-			return { .block_size  = _block_size,
-			         .block_count = _http.file_size() / _block_size,
-			         .align_log2  = log2(_block_size),
+			return { .block_size  = _params.block_size,
+			         .block_count = _http.file_size() / _params.block_size,
+			         .align_log2  = log2(_params.block_size),
 			         .writeable   = false };
 		}
 
 		void read(Block::sector_t           block_nr,
 		          Genode::size_t            block_count,
 		          char                     *buffer,
-		          Block::Packet_descriptor &packet)
+		          Block::Packet_descriptor &packet) override
 		{
-			_http.cmd_get(block_nr * _block_size, block_count * _block_size,
-			              (addr_t)buffer);
-			ack_packet(packet);
+			size_t const offset = block_nr*_params.block_size;
+			size_t const size   = block_count*_params.block_size;
+			size_t const first  = offset/_cache.chunk_size();
+			size_t const last   = (offset + size - 1)/_cache.chunk_size();
+
+			if (last - first + 1 > _cache.num_chunks()/2) {
+				error("request of ", size, " bytes exceeds cache");
+				throw Io_error();
+			}
+
+			Request * const request = _alloc_request();
+			if (!request)
+				throw Request_congestion();
+
+			*request = Request { true, packet, buffer, offset, size };
+
+			/* pin cached chunks first so that they are not evicted below */
+			unsigned missing = 0;
+			_for_each_chunk_index(*request, [&] (size_t index) {
+				if (Chunk *chunk = _cache.lookup(index)) {
+					chunk->users++;
+					_cache.touch(*chunk);
+				} else
+					missing++;
+			});
+
+			if (missing > _cache.num_evictable()) {
+				_for_each_chunk_index(*request, [&] (size_t index) {
+					if (Chunk *chunk = _cache.lookup(index))
+						chunk->users--; });
+
+				request->valid = false;
+				throw Request_congestion();
+			}
+
+			bool const sequential = (first == _last_chunk || first == _last_chunk + 1);
+			_last_chunk = last;
+
+			Libc::with_libc([&] () {
+
+				_for_each_chunk_index(*request, [&] (size_t index) {
+					if (!_cache.lookup(index))
+						_fetch_chunk(index).users++; });
+
+				if (sequential)
+					_read_ahead(last);
+
+				_flush_collected();
+				_process();
+			});
 		}
-	};
+};
 
 
 class Factory : public Block::Driver_factory
@@ -70,7 +518,18 @@ class Factory : public Block::Driver_factory
 		Heap                  &_heap;
 		Attached_rom_dataspace _config { _env, "config" };
 		::String         const _uri;
-		size_t           const _blk_sz;
+		Parameters       const _params;
+
+		static Parameters _parameters(Xml_node config)
+		{
+			return {
+				.block_size  = config.attribute_value("block_size", 512U),
+				.cache_size  = config.attribute_value("cache", Number_of_bytes(4*1024*1024)),
+				.chunk_size  = config.attribute_value("chunk_size", Number_of_bytes(64*1024)),
+				.read_ahead  = config.attribute_value("read_ahead", 8U),
+				.connections = config.attribute_value("connections", 4U)
+			};
+		}
 
 	public:
 
@@ -78,14 +537,28 @@ class Factory : public Block::Driver_factory
 		:
 			_env(env), _heap(heap),
 			_uri   (_config.xml().attribute_value("uri", ::String())),
-			_blk_sz(_config.xml().attribute_value("block_size", 512U))
+			_params(_parameters(_config.xml()))
 		{
 			log("Using file=", _uri, " as device with block size ",
-			    Hex(_blk_sz, Hex::OMIT_PREFIX), ".");
+			    Hex(_params.block_size, Hex::OMIT_PREFIX), ".");
 		}
 
-		Block::Driver *create() {
-			return new (&_heap) Driver(_heap, _env.ram(), _blk_sz, _uri); }
+		Block::Driver *create()
+		{
+			Block::Driver *driver = nullptr;
+
+			Libc::with_libc([&] () {
+				try {
+					driver = new (&_heap)
+						Driver(_heap, _env.ram(), _env.rm(), _params, _uri); }
+				catch (Http::Exception) { }
+			});
+
+			if (!driver)
+				throw Service_denied();
+
+			return driver;
+		}
 
 	void destroy(Block::Driver *driver) {
 		Genode::destroy(&_heap, driver); }
@@ -38,12 +38,25 @@ extern "C" {
 #define LWIP_TCP_TIMESTAMPS         1
 #define TCP_LISTEN_BACKLOG              1
 #define TCP_MSS                         1460
-#define TCP_WND                     (32 * TCP_MSS)
-#define TCP_SND_BUF                 (32 * TCP_MSS)
-#define LWIP_WND_SCALE                  3
+
+/*
+ * The windows exceed 64 KiB and thereby depend on window scaling. The
+ * receive window must stay below '0xffff << TCP_RCV_SCALE' and should not
+ * exceed the RX buffer of the Nic session (see 'nic_netif.h').
+ */
+#ifndef TCP_WND
+#define TCP_WND                     (128 * TCP_MSS)
+#endif
+#ifndef TCP_SND_BUF
+#define TCP_SND_BUF                 (128 * TCP_MSS)
+#endif
+#define LWIP_WND_SCALE                  1
 #define TCP_RCV_SCALE                   2
 #define TCP_SND_QUEUELEN                ((8 * (TCP_SND_BUF) + (TCP_MSS - 1))/(TCP_MSS))
 
+/* the default is derived from TCP_SND_BUF and exceeds the 16-bit limit */
+#define TCP_SNDLOWAT                    (16 * TCP_MSS)
+
 #define LWIP_NETIF_STATUS_CALLBACK  1  /* callback function used for interface changes */
 #define LWIP_NETIF_LINK_CALLBACK    1  /* callback function used for link-state changes */
 
@@ -55,6 +68,9 @@ extern "C" {
 /* checksum calculation for outgoing packets can be disabled if the hardware supports it */
 #define LWIP_CHECKSUM_ON_COPY       1  /* calculate checksum during memcpy */
 
+/* checksums are left to the Nic server if negotiated, see 'nic_netif.h' */
+#define LWIP_CHECKSUM_CTRL_PER_NETIF 1
+
 /*********************
  ** Memory settings **
  *********************/
@@ -35,6 +35,7 @@ namespace Lwip {
 extern "C" {
 /* LwIP includes */
 #include <lwip/netif.h>
+#include <lwip/prot/ip.h>
 #include <netif/etharp.h>
 #if LWIP_IPV6
 #include <lwip/ethip6.h>
@@ -78,13 +79,95 @@ class Lwip::Nic_netif
 		enum {
 			PACKET_SIZE = Nic::Packet_allocator::DEFAULT_PACKET_SIZE,
 			BUF_SIZE    = 128 * PACKET_SIZE,
+
+			/*
+			 * Received packets are referenced by pbufs until the data is
+			 * consumed by the application, so the RX buffer must cover the
+			 * TCP receive window
+			 */
+			RX_BUF_SIZE = 2 * BUF_SIZE,
 		};
 
+		static Genode::size_t _buf_size(Genode::Xml_node config,
+		                                char const *attr, Genode::size_t def)
+		{
+			return config.attribute_value(attr, Genode::Number_of_bytes(def));
+		}
+
 		Genode::Tslab<struct Nic_netif_pbuf, 128> _pbuf_alloc;
 
 		Nic::Packet_allocator _nic_tx_alloc;
 		Nic::Connection _nic;
 
+		/*
+		 * TCP and UDP checksums are left to the Nic server if it also
+		 * passes partial checksums to us. As lwIP then skips the checksum
+		 * verification, which also covers packets looped back by lwIP
+		 * itself, received packets with a complete checksum are verified
+		 * by '_checksum_valid'.
+		 */
+		bool const _checksum_offload;
+
+		bool _negotiate_checksum_offload(Genode::Xml_node config)
+		{
+			using Nic::Offload;
+
+			if (!config.attribute_value("offload", true))
+				return false;
+
+			unsigned const checksum = Offload::TX_CHECKSUM | Offload::RX_CHECKSUM;
+			return _nic.offload(Offload { checksum }).has(checksum);
+		}
+
+		/**
+		 * Return false if a received IPv4 TCP or UDP packet has a wrong
+		 * checksum
+		 *
+		 * Malformed packets are left to lwIP.
+		 */
+		static bool _checksum_valid(void const *eth_base, Genode::size_t size)
+		{
+			enum { ETH_HDR_SIZE = 14, IP_HDR_SIZE = 20 };
+
+			u8_t const *eth = (u8_t const *)eth_base;
+			if (size < ETH_HDR_SIZE + IP_HDR_SIZE || eth[12] != 0x08 || eth[13] != 0)
+				return true;
+
+			u8_t     const *ip    = eth + ETH_HDR_SIZE;
+			unsigned const  ihl   = (ip[0] & 0xf)*4;
+			unsigned const  total = (ip[2] << 8) | ip[3];
+			u8_t     const  proto = ip[9];
+
+			if ((proto != IP_PROTO_TCP && proto != IP_PROTO_UDP)
+			 || ihl < IP_HDR_SIZE || total < ihl || ETH_HDR_SIZE + total > size)
+				return true;
+
+			/* fragments do not carry a complete transport packet */
+			if ((ip[6] & 0x3f) || ip[7])
+				return true;
+
+			/* UDP checksum is optional */
+			if (proto == IP_PROTO_UDP && total - ihl >= 8
+			 && ip[ihl + 6] == 0 && ip[ihl + 7] == 0)
+				return true;
+
+			/* pseudo header */
+			u32_t sum = proto + (total - ihl);
+			for (unsigned i = 12; i < 20; i += 2)
+				sum += (ip[i] << 8) | ip[i + 1];
+
+			for (unsigned i = ihl; i + 1 < total; i += 2)
+				sum += (ip[i] << 8) | ip[i + 1];
+
+			if ((total - ihl) & 1)
+				sum += ip[total - 1] << 8;
+
+			while (sum >> 16)
+				sum = (sum & 0xffff) + (sum >> 16);
+
+			return sum == 0xffff;
+		}
+
 		struct netif _netif { };
 
 		ip_addr_t ip { };
@@ -134,6 +217,14 @@ class Lwip::Nic_netif
 
 				Nic::Packet_descriptor packet = rx.get_packet();
 
+				if (_checksum_offload
+				 && packet.checksum() == Nic::Packet_descriptor::CHECKSUM_COMPLETE
+				 && !_checksum_valid(rx.packet_content(packet), packet.size())) {
+					LINK_STATS_INC(link.chkerr);
+					rx.acknowledge_packet(packet);
+					continue;
+				}
+
 				Nic_netif_pbuf *nic_pbuf = new (_pbuf_alloc)
 					Nic_netif_pbuf(*this, packet);
 
@@ -208,8 +299,10 @@ class Lwip::Nic_netif
 		:
 			_pbuf_alloc(alloc), _nic_tx_alloc(&alloc),
 			_nic(env, &_nic_tx_alloc,
-			     BUF_SIZE, BUF_SIZE,
+			     _buf_size(config, "tx_buf_size", BUF_SIZE),
+			     _buf_size(config, "rx_buf_size", RX_BUF_SIZE),
 			     config.attribute_value("label", Genode::String<160>("lwip")).string()),
+			_checksum_offload(_negotiate_checksum_offload(config)),
 			_link_state_handler(env.ep(), *this, &Nic_netif::handle_link_state),
 			_rx_packet_handler( env.ep(), *this, &Nic_netif::handle_rx_packets)
 		{
@@ -269,6 +362,13 @@ class Lwip::Nic_netif
 
 			_netif.linkoutput      = nic_netif_linkoutput;
 
+			if (_checksum_offload)
+				NETIF_SET_CHECKSUM_CTRL(&_netif, NETIF_CHECKSUM_ENABLE_ALL &
+				                                 ~(NETIF_CHECKSUM_GEN_UDP   |
+				                                   NETIF_CHECKSUM_GEN_TCP   |
+				                                   NETIF_CHECKSUM_CHECK_UDP |
+				                                   NETIF_CHECKSUM_CHECK_TCP));
+
 			/* Set physical MAC address */
 			Nic::Mac_address const mac = _nic.mac_address();
 			for(int i=0; i<6; ++i)
@@ -324,6 +424,9 @@ class Lwip::Nic_netif
 				dst += q->len;
 			}
 
+			if (_checksum_offload)
+				packet.checksum(Nic::Packet_descriptor::CHECKSUM_PARTIAL);
+
 			tx.submit_packet(packet);
 			LINK_STATS_INC(link.xmit);
 			return ERR_OK;
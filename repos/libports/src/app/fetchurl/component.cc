@@ -47,10 +47,28 @@ static int progress_callback(void *userdata,
                              double ultotal, double ulnow);
 
 
+struct Fetchurl::User_data
+{
+	Timer::Connection &timer;
+	Genode::Milliseconds last_ms;
+	Genode::Milliseconds const max_timeout;
+	Genode::Milliseconds curr_timeout;
+	Fetchurl::Fetch &fetch;
+};
+
+
 class Fetchurl::Fetch : Genode::List<Fetch>::Element
 {
 	friend class Genode::List<Fetch>;
 
+	private:
+
+		/*
+		 * Noncopyable
+		 */
+		Fetch(Fetch const &);
+		Fetch &operator = (Fetch const &);
+
 	public:
 
 		using Genode::List<Fetch>::Element::next;
@@ -67,8 +85,16 @@ class Fetchurl::Fetch : Genode::List<Fetch>::Element
 
 		bool timeout = false;
 
+		/* file is completely written and closed */
+		bool finished = false;
+
 		int fd = -1;
 
+		/* easy handle of the ongoing transfer */
+		CURL *curl = nullptr;
+
+		Genode::Constructible<User_data> user_data { };
+
 		Fetch(Main &main, Url const &url, Path const &path,
 		      Url const &proxy, long retry)
 		:
@@ -78,16 +104,6 @@ class Fetchurl::Fetch : Genode::List<Fetch>::Element
 };
 
 
-struct Fetchurl::User_data
-{
-	Timer::Connection &timer;
-	Genode::Milliseconds last_ms;
-	Genode::Milliseconds const max_timeout;
-	Genode::Milliseconds curr_timeout;
-	Fetchurl::Fetch &fetch;
-};
-
-
 struct Fetchurl::Main
 {
 	Main(Main const &);
@@ -110,6 +126,10 @@ struct Fetchurl::Main
 
 	Genode::Milliseconds _progress_timeout { 10u * 1000 };
 
+	/* maximum number of concurrent transfers */
+	enum { MAX_PARALLEL = 16 };
+	unsigned _parallel { 4 };
+
 	void _schedule_report()
 	{
 		using namespace Genode;
@@ -135,6 +155,9 @@ struct Fetchurl::Main
 					if (f->timeout) {
 						xml.attribute("timeout", true);
 					}
+					if (f->finished) {
+						xml.attribute("finished", true);
+					}
 				});
 			}
 		});
@@ -167,6 +190,9 @@ struct Fetchurl::Main
 		_progress_timeout.value = config_node.attribute_value("progress_timeout",
 		                                                      _progress_timeout.value);
 
+		_parallel = max(1U, min((unsigned)MAX_PARALLEL,
+		                        config_node.attribute_value("parallel", _parallel)));
+
 		auto const parse_fn = [&] (Genode::Xml_node node) {
 
 			if (!node.has_attribute("url") || !node.has_attribute("path")) {
@@ -179,8 +205,12 @@ struct Fetchurl::Main
 			Url  const proxy = node.attribute_value("proxy", Url());
 			long const retry = node.attribute_value("retry", 0L);
 
+			/* append to retain the order of the config */
+			Fetch *last = _fetches.first();
+			for (; last && last->next(); last = last->next());
+
 			auto *f = new (_heap) Fetch(*this, url, path, proxy, retry);
-			_fetches.insert(f);
+			_fetches.insert(f, last);
 		};
 
 		config_node.for_each_sub_node("fetch", parse_fn);
@@ -193,7 +223,10 @@ struct Fetchurl::Main
 		});
 	}
 
-	CURLcode _process_fetch(CURL *_curl, Fetch &_fetch)
+	/**
+	 * Prepare easy handle for fetch, the transfer is driven by the multi handle
+	 */
+	CURLcode _start_fetch(CURL *_curl, Fetch &_fetch)
 	{
 		Genode::log("fetch ", _fetch.url);
 
@@ -248,6 +281,9 @@ struct Fetchurl::Main
 		}
 		_fetch.fd = fd;
 
+		/* drop the options of a previous transfer but keep its connection */
+		curl_easy_reset(_curl);
+
 		curl_easy_setopt(_curl, CURLOPT_URL, _fetch.url.string());
 		curl_easy_setopt(_curl, CURLOPT_FOLLOWLOCATION, true);
 
@@ -259,14 +295,15 @@ struct Fetchurl::Main
 
 		curl_easy_setopt(_curl, CURLOPT_NOPROGRESS, 0L);
 		curl_easy_setopt(_curl, CURLOPT_PROGRESSFUNCTION, progress_callback);
-		User_data ud {
+		_fetch.user_data.construct(User_data {
 			.timer        = _timer,
 			.last_ms      = _timer.curr_time().trunc_to_plain_ms(),
 			.max_timeout  = _progress_timeout,
 			.curr_timeout = Genode::Milliseconds { .value = 0 },
 			.fetch        = _fetch,
-		};
-		curl_easy_setopt(_curl, CURLOPT_PROGRESSDATA, &ud);
+		});
+		curl_easy_setopt(_curl, CURLOPT_PROGRESSDATA, &*_fetch.user_data);
+		curl_easy_setopt(_curl, CURLOPT_PRIVATE, &_fetch);
 
 		curl_easy_setopt(_curl, CURLOPT_SSL_VERIFYPEER, 0L);
 		curl_easy_setopt(_curl, CURLOPT_SSL_VERIFYHOST, 0L);
@@ -276,47 +313,139 @@ struct Fetchurl::Main
 			curl_easy_setopt(_curl, CURLOPT_PROXY, _fetch.proxy.string());
 		}
 
-		CURLcode res = curl_easy_perform(_curl);
+		_fetch.curl    = _curl;
+		_fetch.dltotal = 0;
+		_fetch.dlnow   = 0;
+		_fetch.timeout = false;
+		return CURLE_OK;
+	}
+
+	/**
+	 * Complete transfer of fetch
+	 *
+	 * \return easy handle to be used for the next transfer
+	 */
+	CURL *_finish_fetch(Fetch &_fetch, CURLcode res)
+	{
+		CURL *curl = _fetch.curl;
+
 		close(_fetch.fd);
-		_fetch.fd = -1;
+		_fetch.fd   = -1;
+		_fetch.curl = nullptr;
+		_fetch.user_data.destruct();
 
 		if (res != CURLE_OK)
 			Genode::error(curl_easy_strerror(res), ", failed to fetch ", _fetch.url);
-		return res;
+		return curl;
 	}
 
 	int run()
 	{
 		CURLcode exit_res = CURLE_OK;
 
-		CURL *curl = curl_easy_init();
-		if (!curl) {
+		CURLM *multi = curl_multi_init();
+		if (!multi) {
 			Genode::error("failed to initialize libcurl");
 			return -1;
 		}
 
-		while (true) {
-			_report();
+		/* keep the connections of all transfers open for reuse */
+		curl_multi_setopt(multi, CURLMOPT_MAXCONNECTS, (long)_parallel);
 
-			bool retry_some = false;
-			for (Fetch *f = _fetches.first(); f; f = f->next()) {
-				if (f->retry < 1) continue;
-				CURLcode res = _process_fetch(curl, *f);
-				if (res == CURLE_OK) {
+		/*
+		 * Easy handles of completed transfers are reused for subsequent
+		 * transfers, which retains their DNS cache and TLS sessions.
+		 */
+		CURL    *idle[MAX_PARALLEL] { };
+		unsigned num_idle = 0;
+		unsigned active   = 0;
+
+		auto pending = [&] ()
+		{
+			for (Fetch *f = _fetches.first(); f; f = f->next())
+				if (f->retry > 0 && !f->curl)
+					return true;
+			return false;
+		};
+
+		auto start_pending = [&] ()
+		{
+			for (Fetch *f = _fetches.first(); f && active < _parallel; f = f->next()) {
+
+				if (f->retry < 1 || f->curl)
+					continue;
+
+				CURL *curl = num_idle ? idle[--num_idle] : curl_easy_init();
+				if (!curl) {
+					Genode::error("failed to initialize libcurl");
+					exit_res = CURLE_FAILED_INIT;
 					f->retry = 0;
-				} else {
-					if (--f->retry > 0)
-						retry_some = true;
-					else
+					continue;
+				}
+				CURLcode const res = _start_fetch(curl, *f);
+				if (res != CURLE_OK) {
+					idle[num_idle++] = curl;
+					if (--f->retry < 1)
 						exit_res = res;
+					continue;
+				}
+				curl_multi_add_handle(multi, curl);
+				active++;
+			}
+		};
+
+		_report();
+
+		for (;;) {
+
+			start_pending();
+
+			if (!active) {
+				if (pending())
+					continue;
+				break;
+			}
+
+			int running = 0;
+			curl_multi_perform(multi, &running);
+
+			int      left = 0;
+			CURLMsg *msg  = nullptr;
+			while ((msg = curl_multi_info_read(multi, &left))) {
+
+				if (msg->msg != CURLMSG_DONE)
+					continue;
+
+				Fetch *f = nullptr;
+				curl_easy_getinfo(msg->easy_handle, CURLINFO_PRIVATE, (char **)&f);
+
+				CURLcode const res = msg->data.result;
+				curl_multi_remove_handle(multi, msg->easy_handle);
+				active--;
+
+				idle[num_idle++] = _finish_fetch(*f, res);
+
+				if (res == CURLE_OK) {
+					f->retry    = 0;
+					f->finished = true;
+				} else if (--f->retry < 1) {
+					exit_res = res;
 				}
+				_report();
+			}
+
+			if (active) {
+				int numfds = 0;
+				curl_multi_wait(multi, nullptr, 0, 1000, &numfds);
 			}
-			if (!retry_some) break;
 		}
 
 		_report();
 
-		curl_easy_cleanup(curl);
+		for (unsigned i = 0; i < num_idle; i++)
+			curl_easy_cleanup(idle[i]);
+
+		curl_multi_cleanup(multi);
 
 		return exit_res ^ CURLE_OK;
 	}
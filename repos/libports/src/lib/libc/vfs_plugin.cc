@@ -16,6 +16,7 @@
 /* Genode includes */
 #include <base/env.h>
 #include <base/log.h>
+#include <dataspace/client.h>
 #include <vfs/dir_file_system.h>
 
 /* libc includes */
@@ -1187,6 +1188,37 @@ int Libc::Vfs_plugin::rename(char const *from_path, char const *to_path)
 }
 
 
+void *Libc::Vfs_plugin::_mmap_dataspace(char const *path, ::size_t length,
+                                        ::off_t offset)
+{
+	Genode::Dataspace_capability const ds = _root_dir.dataspace(path);
+	if (!ds.valid())
+		return nullptr;
+
+	Genode::size_t const ds_size = Genode::Dataspace_client(ds).size();
+
+	if (offset >= 0 && (Genode::size_t)offset + length <= ds_size) {
+
+		void *addr = nullptr;
+		try {
+			enum { USE_LOCAL_ADDR = false, EXECUTABLE = false, WRITEABLE = false };
+			addr = _rm.attach(ds, length, offset, USE_LOCAL_ADDR, (void *)0,
+			                  EXECUTABLE, WRITEABLE);
+
+			new (_alloc) Registered_mapping(_mappings, addr, path, ds);
+			return addr;
+		}
+		catch (...) {
+			if (addr)
+				_rm.detach(addr);
+		}
+	}
+
+	_root_dir.release(path, ds);
+	return nullptr;
+}
+
+
 void *Libc::Vfs_plugin::mmap(void *addr_in, ::size_t length, int prot, int flags,
                              Libc::File_descriptor *fd, ::off_t offset)
 {
@@ -1202,10 +1234,10 @@ void *Libc::Vfs_plugin::mmap(void *addr_in, ::size_t length, int prot, int flags
 		return (void *)-1;
 	}
 
-	/*
-	 * XXX attempt to obtain memory mapping via
-	 *     'Vfs::Directory_service::dataspace'.
-	 */
+	/* attach the file content directly if the VFS provides a dataspace */
+	if (fd->fd_path && (offset & (PAGE_SIZE - 1)) == 0)
+		if (void * const addr = _mmap_dataspace(fd->fd_path, length, offset))
+			return addr;
 
 	void *addr = Libc::mem_alloc()->alloc(length, PAGE_SHIFT);
 	if (addr == (void *)-1) {
@@ -1238,7 +1270,22 @@ void *Libc::Vfs_plugin::mmap(void *addr_in, ::size_t length, int prot, int flags
 
 int Libc::Vfs_plugin::munmap(void *addr, ::size_t)
 {
-	Libc::mem_alloc()->free(addr);
+	bool attached = false;
+
+	_mappings.for_each([&] (Registered_mapping &mapping) {
+
+		if (mapping.addr != addr)
+			return;
+
+		_rm.detach(addr);
+		_root_dir.release(mapping.path.string(), mapping.ds);
+		destroy(_alloc, &mapping);
+		attached = true;
+	});
+
+	if (!attached)
+		Libc::mem_alloc()->free(addr);
+
 	return 0;
 }
 
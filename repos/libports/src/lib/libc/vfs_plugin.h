@@ -17,6 +17,7 @@
 #define _LIBC_VFS__PLUGIN_H_
 
 /* Genode includes */
+#include <base/registry.h>
 #include <libc/component.h>
 
 /* libc includes */
@@ -40,9 +41,37 @@ class Libc::Vfs_plugin : public Libc::Plugin
 	private:
 
 		Genode::Allocator        &_alloc;
+		Genode::Region_map       &_rm;
 		Vfs::File_system         &_root_dir;
 		Vfs::Io_response_handler &_response_handler;
 
+		/**
+		 * File content attached by 'mmap' as provided by the VFS
+		 */
+		struct Mapping
+		{
+			typedef Genode::String<Vfs::MAX_PATH_LEN> Path;
+
+			void                         * const addr;
+			Path                           const path;
+			Genode::Dataspace_capability   const ds;
+
+			Mapping(void *addr, char const *path, Genode::Dataspace_capability ds)
+			: addr(addr), path(path), ds(ds) { }
+		};
+
+		typedef Genode::Registered_no_delete<Mapping> Registered_mapping;
+
+		Genode::Registry<Registered_mapping> _mappings { };
+
+		/**
+		 * Attach file content provided as dataspace by the VFS
+		 *
+		 * \return local address, or nullptr if the VFS cannot provide
+		 *         a dataspace covering the requested range
+		 */
+		void *_mmap_dataspace(char const *path, ::size_t length, ::off_t offset);
+
 		void _open_stdio(Genode::Xml_node const &node, char const *attr,
 		                 int libc_fd, unsigned flags)
 		{
@@ -154,7 +183,8 @@ class Libc::Vfs_plugin : public Libc::Plugin
 		           Genode::Allocator        &alloc,
 		           Vfs::Io_response_handler &handler)
 		:
-			_alloc(alloc), _root_dir(env.vfs()), _response_handler(handler)
+			_alloc(alloc), _rm(env.rm()), _root_dir(env.vfs()),
+			_response_handler(handler)
 		{
 			using Genode::Xml_node;
 
@@ -68,6 +68,7 @@ extern "C" {
 
 	class Socket_dir;
 	class Udp_socket_dir;
+	class Recv_queue;
 	class Tcp_socket_dir;
 
 	#define Udp_socket_dir_list Genode::List<Udp_socket_dir>
@@ -996,6 +997,136 @@ class Lwip::Udp_socket_dir final :
  ** TCP **
  *********/
 
+/**
+ * Queue of received but not yet consumed data
+ *
+ * Received pbufs are concatenated as long as the length of the resulting
+ * chain fits into the 16-bit 'tot_len' field. With window scaling, the
+ * unconsumed data may exceed this limit. Therefore, the queue holds several
+ * chains. The number of chains is bounded because the peer cannot send more
+ * than the receive window before the data is consumed.
+ */
+class Lwip::Recv_queue
+{
+	private:
+
+		enum { MAX_CHAINS = 2*TCP_WND/0xffff + 2 };
+
+		pbuf    *_chains[MAX_CHAINS] { };
+		unsigned _head  = 0;
+		unsigned _count = 0;
+		u16_t    _off   = 0;   /* consumed bytes of the head chain */
+
+		pbuf *&_chain(unsigned i) { return _chains[(_head + i) % MAX_CHAINS]; }
+
+		pbuf *_dequeue()
+		{
+			pbuf *chain = _chain(0);
+			_chain(0) = nullptr;
+			_head = (_head + 1) % MAX_CHAINS;
+			_count--;
+			_off = 0;
+			return chain;
+		}
+
+	public:
+
+		bool empty() const { return _count == 0; }
+
+		/**
+		 * Append chain
+		 *
+		 * \return false if the queue is full, the caller keeps the
+		 *         ownership of 'p' in this case
+		 */
+		bool enqueue(pbuf *p)
+		{
+			if (_count) {
+				pbuf *&tail = _chain(_count - 1);
+				if ((unsigned)tail->tot_len + p->tot_len <= 0xffff) {
+					pbuf_cat(tail, p);
+					return true;
+				}
+			}
+
+			if (_count == MAX_CHAINS)
+				return false;
+
+			_chain(_count++) = p;
+			return true;
+		}
+
+		/**
+		 * Copy up to 'count' bytes to 'dst'
+		 *
+		 * \param consume  remove the copied data from the queue
+		 * \return         number of copied bytes
+		 */
+		file_size copy_out(char *dst, file_size count, bool consume)
+		{
+			file_size done = 0;
+			u16_t     off  = _off;
+
+			for (unsigned i = 0; i < _count && done < count; ) {
+
+				pbuf *&chain = _chain(i);
+
+				u16_t const n = pbuf_copy_partial(chain, dst + done,
+				                                  min(count - done, (file_size)0xffff),
+				                                  off);
+				done += n;
+				off  += n;
+
+				bool const chain_consumed = (off == chain->tot_len);
+
+				if (!consume) {
+					if (!chain_consumed)
+						break;
+					i++;
+					off = 0;
+					continue;
+				}
+
+				if (chain_consumed) {
+					pbuf_free(_dequeue());
+					off = 0;
+					continue;
+				}
+
+				_off = off;
+
+				/* release the completely consumed pbufs of the chain */
+				u16_t new_off = 0;
+				pbuf *new_head = pbuf_skip(chain, off, &new_off);
+				if (new_head && new_head != chain) {
+					pbuf_ref(new_head);
+					pbuf_free(chain);
+					chain = new_head;
+					_off  = new_off;
+				}
+				break;
+			}
+
+			return done;
+		}
+
+		/**
+		 * Take over all chains of 'other'
+		 */
+		void take(Recv_queue &other)
+		{
+			while (!other.empty() && enqueue(other._chain(0)))
+				other._dequeue();
+		}
+
+		void flush()
+		{
+			while (_count)
+				pbuf_free(_dequeue());
+		}
+};
+
+
 class Lwip::Tcp_socket_dir final :
 	public  Socket_dir,
 	private Tcp_socket_dir_list::Element
@@ -1004,10 +1135,12 @@ class Lwip::Tcp_socket_dir final :
 
 		struct Pcb_pending : Genode::List<Pcb_pending>::Element
 		{
-			tcp_pcb *pcb;
-			pbuf *buf = nullptr;
+			tcp_pcb   *pcb;
+			Recv_queue recv_queue { };
 
 			Pcb_pending(tcp_pcb *p) : pcb(p) { }
+
+			~Pcb_pending() { recv_queue.flush(); }
 		};
 
 	private:
@@ -1027,8 +1160,7 @@ class Lwip::Tcp_socket_dir final :
 		tcp_pcb             *_pcb;
 
 		/* queue of received data */
-		pbuf *_recv_pbuf = nullptr;
-		u16_t _recv_off  = 0;
+		Recv_queue _recv_queue { };
 
 		Open_result _accept_new_socket(Vfs::File_system &fs,
                                        Genode::Allocator &alloc,
@@ -1070,10 +1202,13 @@ class Lwip::Tcp_socket_dir final :
 		{
 			tcp_arg(_pcb, NULL);
 
-			for (Pcb_pending *p = _pcb_pending.first(); p; p->next()) {
+			while (Pcb_pending *p = _pcb_pending.first()) {
+				_pcb_pending.remove(p);
 				destroy(alloc, p);
 			}
 
+			_recv_queue.flush();
+
 			if (_pcb != NULL) {
 				tcp_arg(_pcb, NULL);
 				tcp_close(_pcb);
@@ -1101,15 +1236,13 @@ class Lwip::Tcp_socket_dir final :
 		}
 
 		/**
-		 * chain a buffer to the queue
+		 * Chain a buffer to the queue
+		 *
+		 * \return false if the buffer cannot be queued at this time
 		 */
-		void recv(struct pbuf *buf)
+		bool recv(struct pbuf *buf)
 		{
-			if (_recv_pbuf && buf) {
-				pbuf_cat(_recv_pbuf, buf);
-			} else {
-				_recv_pbuf = buf;
-			}
+			return _recv_queue.enqueue(buf);
 		}
 
 		/**
@@ -1138,7 +1271,7 @@ class Lwip::Tcp_socket_dir final :
 		void shutdown()
 		{
 			state = CLOSING;
-			if (_recv_pbuf)
+			if (!_recv_queue.empty())
 				return;
 
 			if (_pcb) {
@@ -1160,7 +1293,7 @@ class Lwip::Tcp_socket_dir final :
 			case Lwip_file_handle::PEEK:
 				switch (state) {
 				case READY:
-					return _recv_pbuf != NULL;
+					return !_recv_queue.empty();
 				case CLOSING:
 				case CLOSED:
 					/* time for the application to find out */
@@ -1211,7 +1344,7 @@ class Lwip::Tcp_socket_dir final :
 
 			case Lwip_file_handle::DATA:
 				{
-					if (_recv_pbuf == nullptr) {
+					if (_recv_queue.empty()) {
 						/*
 						 * queue the read if the PCB is active and
 						 * there is nothing to read, otherwise return
@@ -1222,29 +1355,15 @@ class Lwip::Tcp_socket_dir final :
 							: Read_result::READ_OK;
 					}
 
-					u16_t const ucount = count;
-					u16_t const n = pbuf_copy_partial(_recv_pbuf, dst, ucount, _recv_off);
-					_recv_off += n;
-					{
-						u16_t new_off;
-						pbuf *new_head = pbuf_skip(_recv_pbuf, _recv_off, &new_off);
-						if (new_head != NULL && new_head != _recv_pbuf) {
-							/* increment the references on the new head */
-							pbuf_ref(new_head);
-							/* free the buffers chained to the old head */
-							pbuf_free(_recv_pbuf);
-						}
+					file_size const n = _recv_queue.copy_out(dst, count, true);
 
-						if (!new_head)
-							pbuf_free(_recv_pbuf);
-						_recv_pbuf = new_head;
-						_recv_off = new_off;
+					/* ACK the remote, 'tcp_recved' takes 16-bit lengths */
+					for (file_size acked = 0; _pcb && acked < n; ) {
+						u16_t const chunk = min(n - acked, (file_size)0xffff);
+						tcp_recved(_pcb, chunk);
+						acked += chunk;
 					}
 
-					/* ACK the remote */
-					if (_pcb)
-						tcp_recved(_pcb, n);
-
 					if (state == CLOSING)
 						shutdown();
 
@@ -1254,11 +1373,7 @@ class Lwip::Tcp_socket_dir final :
 				break;
 
 			case Lwip_file_handle::PEEK:
-				if (_recv_pbuf != nullptr) {
-					u16_t const ucount = count;
-					u16_t const n = pbuf_copy_partial(_recv_pbuf, dst, ucount, _recv_off);
-					out_count = n;
-				}
+				out_count = _recv_queue.copy_out(dst, count, false);
 				return Read_result::READ_OK;
 
 			case Lwip_file_handle::REMOTE:
@@ -1278,7 +1393,7 @@ class Lwip::Tcp_socket_dir final :
 			case Lwip_file_handle::PENDING: {
 				if (Pcb_pending *pp = _pcb_pending.first()) {
 					Tcp_socket_dir &new_dir = _proto_dir.alloc_socket(alloc, pp->pcb);
-					new_dir._recv_pbuf = pp->buf;
+					new_dir._recv_queue.take(pp->recv_queue);
 
 					handles.remove(&handle);
 					handle.socket = &new_dir;
@@ -1368,10 +1483,22 @@ class Lwip::Tcp_socket_dir final :
 					 * and the availability of send buffer
 					 */
 					while (count && tcp_sndbuf(_pcb)) {
-						u16_t n = min(count, tcp_sndbuf(_pcb));
+
+						/* 'tcp_write' takes 16-bit lengths */
+						u16_t const n = min(min(count, (file_size)tcp_sndbuf(_pcb)),
+						                    (file_size)0xffff);
+
+						/* announce further data to avoid pushing each chunk */
+						u8_t const flags = TCP_WRITE_FLAG_COPY
+						                 | ((n < count) ? TCP_WRITE_FLAG_MORE : 0);
 
 						/* queue data to outgoing TCP buffer */
-						err_t err = tcp_write(_pcb, src, n, TCP_WRITE_FLAG_COPY);
+						err_t err = tcp_write(_pcb, src, n, flags);
+
+						/* segment queue exhausted, retry when data was acked */
+						if (err == ERR_MEM)
+							break;
+
 						if (err != ERR_OK) {
 							Genode::error("lwIP: tcp_write failed, error ", (int)-err);
 							res = Write_result::WRITE_ERR_IO;
@@ -1524,8 +1651,9 @@ err_t tcp_recv_callback(void *arg, struct tcp_pcb *pcb, struct pbuf *p, err_t)
 	Lwip::Tcp_socket_dir *socket_dir = static_cast<Lwip::Tcp_socket_dir *>(arg);
 	if (p == NULL) {
 		socket_dir->shutdown();
-	} else {
-		socket_dir->recv(p);
+	} else if (!socket_dir->recv(p)) {
+		/* lwIP delivers the refused data again later */
+		return ERR_MEM;
 	}
 
 	socket_dir->process_io();
@@ -1545,11 +1673,8 @@ err_t tcp_delayed_recv_callback(void *arg, struct tcp_pcb *pcb, struct pbuf *buf
 	Lwip::Tcp_socket_dir::Pcb_pending *pending =
 		static_cast<Lwip::Tcp_socket_dir::Pcb_pending *>(arg);
 
-	if (pending->buf && buf) {
-		pbuf_cat(pending->buf, buf);
-	} else {
-		pending->buf = buf;
-	}
+	if (buf && !pending->recv_queue.enqueue(buf))
+		return ERR_MEM;
 
 	return ERR_OK;
 };
@@ -27,6 +27,36 @@ struct Genode_cpy_test {
 		Genode::memcpy(dst, src, size); }
 };
 
+struct Genode_cpy_unaligned_test {
+
+	void start()    { log("start Genode unaligned memcpy");    }
+	void finished() { log("finished Genode unaligned memcpy"); }
+
+	void copy(void *dst, const void *src, size_t size) {
+		Genode::memcpy((char *)dst + 1, src, size - 1); }
+};
+
+struct Genode_move_test {
+
+	void start()    { log("start Genode memmove");    }
+	void finished() { log("finished Genode memmove"); }
+
+	void copy(void *dst, const void *src, size_t size) {
+		Genode::memmove(dst, src, size); }
+};
+
+struct Genode_cmp_test {
+
+	int volatile result = 0;
+
+	void start()    { log("start Genode memcmp");    }
+	void finished() { log("finished Genode memcmp"); }
+
+	/* compare the buffer with itself to scan the whole block */
+	void copy(void *dst, const void *, size_t size) {
+		result = Genode::memcmp(dst, dst, size); }
+};
+
 struct Genode_set_test {
 
 	void start()    { log("start Genode memset");    }
@@ -60,6 +90,9 @@ void Libc::Component::construct(Libc::Env &env)
 
 	memcpy_test<Bytewise_test>();
 	memcpy_test<Genode_cpy_test>();
+	memcpy_test<Genode_cpy_unaligned_test>();
+	memcpy_test<Genode_move_test>();
+	memcpy_test<Genode_cmp_test>();
 	memcpy_test<Genode_set_test>();
 	memcpy_test<Libc_cpy_test>();
 	memcpy_test<Libc_set_test>();
@@ -0,0 +1,300 @@
+/*
+ * \brief  Libc test transferring data over many concurrent TCP connections
+ * \author agent
+ * \date   2026-10-19
+ *
+ * The client opens all connections to the server first and then sends
+ * data over all of them in an interleaved fashion. Hence, the IP stack has
+ * to maintain many connections with their timers at the same time. Both
+ * sides report the elapsed time and the achieved throughput.
+ *
+ * Arguments: 'server [<connections>]' or
+ *            'client <server-ip> [<connections> [<KiB per connection>]]'
+ *
+ * With a single connection, the test serves as bulk-throughput benchmark.
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+/* Libc includes */
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <time.h>
+#include <unistd.h>
+
+enum { PORT = 2, CHUNK_SIZE = 1024 };
+
+static char buf[CHUNK_SIZE];
+
+static int           num_connections      = 100;
+static unsigned long bytes_per_connection = 256*1024;
+
+
+static unsigned long elapsed_ms(struct timespec const *start)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (now.tv_sec - start->tv_sec)*1000
+	     + (now.tv_nsec - start->tv_nsec)/1000000;
+}
+
+
+static void report(char const *side, struct timespec const *start)
+{
+	unsigned long const ms    = elapsed_ms(start);
+	unsigned long const total = num_connections*bytes_per_connection;
+
+	fprintf(stderr, "%s: %d connections, %lu KiB in %lu ms (%lu KiB/s)\n",
+	        side, num_connections, total/1024, ms,
+	        ms ? (total/1024)*1000/ms : 0);
+}
+
+
+static int set_nonblocking(int sock)
+{
+	int const flags = fcntl(sock, F_GETFL);
+	return fcntl(sock, F_SETFL, flags | O_NONBLOCK);
+}
+
+
+static int test_client(char const *host)
+{
+	int           *socks = calloc(num_connections, sizeof(int));
+	unsigned long *sent  = calloc(num_connections, sizeof(unsigned long));
+
+	if (!socks || !sent) {
+		fprintf(stderr, "out of memory\n");
+		return ~0;
+	}
+
+	usleep(1000000);
+
+	struct sockaddr_in addr;
+	memset(&addr, 0, sizeof(addr));
+	addr.sin_family      = AF_INET;
+	addr.sin_addr.s_addr = inet_addr(host);
+	addr.sin_port        = htons(PORT);
+
+	struct timespec start;
+	clock_gettime(CLOCK_MONOTONIC, &start);
+
+	/* establish all connections before transferring any data */
+	for (int i = 0; i < num_connections; i++) {
+
+		socks[i] = socket(AF_INET, SOCK_STREAM, 0);
+		if (socks[i] < 0) {
+			perror("`socket` failed");
+			return ~0;
+		}
+
+		if (connect(socks[i], (struct sockaddr *)&addr, sizeof(addr))) {
+			perror("`connect` failed");
+			return ~0;
+		}
+
+		set_nonblocking(socks[i]);
+		sent[i] = 0;
+	}
+
+	fprintf(stderr, "client: %d connections established in %lu ms\n",
+	        num_connections, elapsed_ms(&start));
+
+	memset(buf, 'x', sizeof(buf));
+
+	int open = num_connections;
+	while (open) {
+
+		fd_set wfds;
+		FD_ZERO(&wfds);
+
+		int max_fd = -1;
+		for (int i = 0; i < num_connections; i++) {
+			if (socks[i] < 0)
+				continue;
+
+			FD_SET(socks[i], &wfds);
+			if (socks[i] > max_fd)
+				max_fd = socks[i];
+		}
+
+		if (select(max_fd + 1, NULL, &wfds, NULL, NULL) < 0) {
+			perror("`select` failed");
+			return ~0;
+		}
+
+		for (int i = 0; i < num_connections; i++) {
+
+			if (socks[i] < 0 || !FD_ISSET(socks[i], &wfds))
+				continue;
+
+			size_t const len = bytes_per_connection - sent[i] < CHUNK_SIZE
+			                 ? bytes_per_connection - sent[i] : CHUNK_SIZE;
+
+			ssize_t const res = send(socks[i], buf, len, 0);
+			if (res < 0 && errno != EAGAIN) {
+				perror("`send` failed");
+				return ~0;
+			}
+
+			if (res > 0)
+				sent[i] += res;
+
+			if (sent[i] == bytes_per_connection) {
+				shutdown(socks[i], SHUT_RDWR);
+				close(socks[i]);
+				socks[i] = -1;
+				open--;
+			}
+		}
+	}
+
+	report("client", &start);
+	usleep(5000000);
+
+	return 0;
+}
+
+
+static int test_server(void)
+{
+	int           *socks    = calloc(num_connections, sizeof(int));
+	unsigned long *received = calloc(num_connections, sizeof(unsigned long));
+
+	if (!socks || !received) {
+		fprintf(stderr, "out of memory\n");
+		return ~0;
+	}
+
+	int listen_sock = socket(AF_INET, SOCK_STREAM, 0);
+	if (listen_sock < 0) {
+		perror("`socket` failed");
+		return listen_sock;
+	}
+
+	struct sockaddr_in addr;
+	memset(&addr, 0, sizeof(addr));
+	addr.sin_family      = AF_INET;
+	addr.sin_addr.s_addr = INADDR_ANY;
+	addr.sin_port        = htons(PORT);
+
+	if (bind(listen_sock, (struct sockaddr *)&addr, sizeof(addr))) {
+		perror("`bind` failed");
+		return ~0;
+	}
+
+	if (listen(listen_sock, num_connections)) {
+		perror("`listen` failed");
+		return ~0;
+	}
+
+	struct timespec start;
+
+	int accepted = 0, closed = 0;
+	while (closed < num_connections) {
+
+		fd_set rfds;
+		FD_ZERO(&rfds);
+
+		int max_fd = -1;
+		if (accepted < num_connections) {
+			FD_SET(listen_sock, &rfds);
+			max_fd = listen_sock;
+		}
+
+		for (int i = 0; i < accepted; i++) {
+			if (socks[i] < 0)
+				continue;
+
+			FD_SET(socks[i], &rfds);
+			if (socks[i] > max_fd)
+				max_fd = socks[i];
+		}
+
+		if (select(max_fd + 1, &rfds, NULL, NULL, NULL) < 0) {
+			perror("`select` failed");
+			return ~0;
+		}
+
+		if (accepted < num_connections && FD_ISSET(listen_sock, &rfds)) {
+
+			int const sock = accept(listen_sock, NULL, NULL);
+			if (sock < 0) {
+				perror("`accept` failed");
+				return ~0;
+			}
+
+			if (accepted == 0)
+				clock_gettime(CLOCK_MONOTONIC, &start);
+
+			set_nonblocking(sock);
+			received[accepted] = 0;
+			socks[accepted++]  = sock;
+		}
+
+		for (int i = 0; i < accepted; i++) {
+
+			if (socks[i] < 0 || !FD_ISSET(socks[i], &rfds))
+				continue;
+
+			ssize_t const res = recv(socks[i], buf, sizeof(buf), 0);
+			if (res < 0 && errno == EAGAIN)
+				continue;
+
+			if (res < 0) {
+				perror("`recv` failed");
+				return ~0;
+			}
+
+			received[i] += res;
+
+			if (res == 0) {
+				if (received[i] != bytes_per_connection) {
+					fprintf(stderr, "connection %d closed after %lu bytes\n",
+					        i, received[i]);
+					return ~0;
+				}
+				close(socks[i]);
+				socks[i] = -1;
+				closed++;
+			}
+		}
+	}
+
+	report("server", &start);
+	return 0;
+}
+
+
+int main(int argc, char **argv)
+{
+	if (argc >= 1 && strcmp(argv[0], "server") == 0) {
+		if (argc >= 2)
+			num_connections = atoi(argv[1]);
+		return test_server();
+	}
+
+	if (argc >= 2 && strcmp(argv[0], "client") == 0) {
+		if (argc >= 3)
+			num_connections = atoi(argv[2]);
+		if (argc >= 4)
+			bytes_per_connection = strtoul(argv[3], NULL, 10)*1024;
+		return test_client(argv[1]);
+	}
+
+	fprintf(stderr, "invalid arguments\n");
+	return ~0;
+}
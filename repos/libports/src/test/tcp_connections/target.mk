@@ -0,0 +1,5 @@
+TARGET  = test-tcp_connections
+LIBS   += posix libc
+SRC_C  += main.c
+
+CC_CXX_WARN_STRICT =
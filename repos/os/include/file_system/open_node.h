@@ -37,6 +37,9 @@ class File_system::Open_node : public File_system::Node
 
 		Listener::Version const _version_when_opened { _node_version(_node) };
 
+		/* access mode of file handles */
+		Mode const _mode;
+
 		/*
 		 * Flag to track whether the underlying file-system node was
 		 * modified via this 'Open_node'. That is, if closing the 'Open_node'
@@ -57,8 +60,9 @@ class File_system::Open_node : public File_system::Node
 	public:
 
 		Open_node(Genode::Weak_ptr<NODE> node,
-		          Genode::Id_space<File_system::Node> &id_space)
-		: _element(*this, id_space), _node(node) { }
+		          Genode::Id_space<File_system::Node> &id_space,
+		          Mode mode = READ_WRITE)
+		: _element(*this, id_space), _node(node), _mode(mode) { }
 
 		~Open_node()
 		{
@@ -83,6 +87,8 @@ class File_system::Open_node : public File_system::Node
 
 		Genode::Id_space<File_system::Node>::Id id() { return _element.id(); }
 
+		Mode mode() const { return _mode; }
+
 		/**
 		 * Register packet stream sink to be notified of node changes
 		 */
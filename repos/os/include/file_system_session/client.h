@@ -116,6 +116,11 @@ class File_system::Session_client : public Genode::Rpc_client<Session>
 		{
 			call<Rpc_move>(from_dir, from_name, to_dir, to_name);
 		}
+
+		Genode::Dataspace_capability dataspace(File_handle file) override
+		{
+			return call<Rpc_dataspace>(file);
+		}
 };
 
 #endif /* _INCLUDE__FILE_SYSTEM_SESSION__CLIENT_H_ */
@@ -115,6 +115,29 @@ struct File_system::Connection : Genode::Connection<Session>, Session_client
 		return _retry([&] () {
 			return Session_client::watch(path); });
 	}
+
+	/**
+	 * Request file content as dataspace
+	 *
+	 * The server may pay a copy of the content from the session quota.
+	 * Hence, the session is upgraded by the size of the file on demand.
+	 */
+	Genode::Dataspace_capability dataspace(File_handle file) override
+	{
+		enum { UPGRADE_ATTEMPTS = ~0U };
+		return Genode::retry<Out_of_caps>(
+			[&] () {
+				return Genode::retry<Out_of_ram>(
+					[&] () { return Session_client::dataspace(file); },
+					[&] () {
+						size_t const size = (size_t)Session_client::status(file).size;
+						File_system::Connection::upgrade_ram(size + 8*1024);
+					},
+					UPGRADE_ATTEMPTS);
+			},
+			[&] () { File_system::Connection::upgrade_caps(2); },
+			UPGRADE_ATTEMPTS);
+	}
 };
 
 #endif /* _INCLUDE__FILE_SYSTEM_SESSION__CONNECTION_H_ */
@@ -17,6 +17,7 @@
 #define _INCLUDE__FILE_SYSTEM_SESSION__FILE_SYSTEM_SESSION_H_
 
 #include <base/exception.h>
+#include <dataspace/capability.h>
 #include <os/packet_stream.h>
 #include <packet_stream_tx/packet_stream_tx.h>
 #include <session/session.h>
@@ -407,6 +408,25 @@ struct File_system::Session : public Genode::Session
 	virtual void move(Dir_handle, Name const &from,
 	                  Dir_handle, Name const &to) = 0;
 
+	/**
+	 * Request dataspace with the content of a file
+	 *
+	 * The dataspace holds the file content at the time of the call and is
+	 * meant to be attached read-only. Depending on the server, it is a
+	 * private copy or shared with other clients. Modifications of the file
+	 * are not reflected. Calling 'dataspace' again yields the current
+	 * content and invalidates the dataspace returned before. The dataspace
+	 * is released when the file handle is closed.
+	 *
+	 * \throw Invalid_handle     file handle is invalid
+	 * \throw Permission_denied  file not opened for reading
+	 * \throw Unavailable        file vanished or the file system cannot
+	 *                           provide file content as dataspace
+	 * \throw Out_of_ram         server cannot allocate the dataspace
+	 * \throw Out_of_caps
+	 */
+	virtual Genode::Dataspace_capability dataspace(File_handle) = 0;
+
 
 	/*******************
 	 ** RPC interface **
@@ -458,12 +478,16 @@ struct File_system::Session : public Genode::Session
 	                 GENODE_TYPE_LIST(Invalid_handle, Invalid_name,
 	                                  Lookup_failed, Permission_denied, Unavailable),
 	                 Dir_handle, Name const &, Dir_handle, Name const &);
+	GENODE_RPC_THROW(Rpc_dataspace, Genode::Dataspace_capability, dataspace,
+	                 GENODE_TYPE_LIST(Invalid_handle, Permission_denied,
+	                                  Unavailable, Out_of_ram, Out_of_caps),
+	                 File_handle);
 
 	GENODE_RPC_INTERFACE(Rpc_tx_cap,
 	                     Rpc_file, Rpc_symlink, Rpc_dir,
 	                     Rpc_node, Rpc_watch,
 	                     Rpc_close, Rpc_status, Rpc_control, Rpc_unlink,
-	                     Rpc_truncate, Rpc_move);
+	                     Rpc_truncate, Rpc_move, Rpc_dataspace);
 };
 
 #endif /* _INCLUDE__FILE_SYSTEM_SESSION__FILE_SYSTEM_SESSION_H_ */
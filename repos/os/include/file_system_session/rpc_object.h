@@ -56,6 +56,12 @@ class File_system::Session_rpc_object : public Genode::Rpc_object<Session, Sessi
 		Watch_handle watch(Path const &) override {
 			throw Unavailable(); }
 
+		/**
+		 * Default stub implementation
+		 */
+		Genode::Dataspace_capability dataspace(File_handle) override {
+			throw Unavailable(); }
+
 };
 
 #endif /* _INCLUDE__FILE_SYSTEM_SESSION__SERVER_H_ */
@@ -100,6 +100,16 @@ class Net::Tcp_packet
 
 		void src_port(Port p) { _src_port = host_to_big_endian(p.value); }
 		void dst_port(Port p) { _dst_port = host_to_big_endian(p.value); }
+		void seq_nr(uint32_t v) { _seq_nr = host_to_big_endian(v); }
+
+		void flags(uint16_t v)
+		{
+			_flags_lsb = (uint8_t)v;
+			_flags_msb = (v >> 8) & 1;
+		}
+
+		void fin(bool v) { uint16_t f = flags(); Flags::Fin::set(f, v); flags(f); }
+		void psh(bool v) { uint16_t f = flags(); Flags::Psh::set(f, v); flags(f); }
 
 
 		/*********
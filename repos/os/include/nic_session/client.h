@@ -64,6 +64,9 @@ class Nic::Session_client : public Genode::Rpc_client<Session>
 		}
 
 		bool link_state() override { return call<Rpc_link_state>(); }
+
+		Offload offload(Offload requested) override {
+			return call<Rpc_offload>(requested); }
 };
 
 #endif /* _INCLUDE__NIC_SESSION__CLIENT_H_ */
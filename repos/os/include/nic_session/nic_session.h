@@ -26,15 +26,102 @@ namespace Nic {
 
 	using Mac_address = Net::Mac_address;
 
+	struct Offload;
+	class  Packet_descriptor;
 	struct Session;
 
 	using Genode::Packet_stream_sink;
 	using Genode::Packet_stream_source;
-
-	typedef Genode::Packet_descriptor Packet_descriptor;
 }
 
 
+/**
+ * Offload features negotiated between client and server
+ *
+ * Checksums concern the TCP and UDP checksums only. IPv4 header checksums
+ * are always complete.
+ */
+struct Nic::Offload
+{
+	enum {
+		/* client may submit packets with incomplete checksum */
+		TX_CHECKSUM = 1 << 0,
+
+		/* client accepts packets with partial checksum */
+		RX_CHECKSUM = 1 << 1,
+
+		/* client may submit TCP segments that exceed the MTU */
+		TX_LARGE    = 1 << 2,
+
+		/* client accepts TCP segments that exceed the MTU */
+		RX_LARGE    = 1 << 3,
+	};
+
+	unsigned value;
+
+	bool has(unsigned features) const { return (value & features) == features; }
+};
+
+
+/**
+ * Packet descriptor with offload meta data
+ */
+class Nic::Packet_descriptor : public Genode::Packet_descriptor
+{
+	public:
+
+		/*
+		 * A partial checksum originates from a sender with 'TX_CHECKSUM'
+		 * and is passed only to receivers with 'RX_CHECKSUM'. A receiver
+		 * must still verify packets with a complete checksum.
+		 */
+		enum Checksum {
+			CHECKSUM_COMPLETE, /* checksum is calculated */
+			CHECKSUM_PARTIAL,  /* checksum is left to the receiver */
+		};
+
+	private:
+
+		Genode::uint8_t  _checksum     = CHECKSUM_COMPLETE;
+		Genode::uint16_t _segment_size = 0;
+
+	public:
+
+		/**
+		 * Constructor
+		 */
+		Packet_descriptor(Genode::off_t offset = 0, Genode::size_t size = 0)
+		: Genode::Packet_descriptor(offset, size) { }
+
+		/**
+		 * Constructor for packets without offload meta data
+		 */
+		Packet_descriptor(Genode::Packet_descriptor const &p)
+		: Genode::Packet_descriptor(p) { }
+
+		Checksum checksum() const { return (Checksum)_checksum; }
+
+		void checksum(Checksum checksum) { _checksum = checksum; }
+
+		/**
+		 * Return TCP payload size of the segments a large segment stands
+		 * for, zero if the packet does not exceed the MTU
+		 */
+		Genode::uint16_t segment_size() const { return _segment_size; }
+
+		void segment_size(Genode::uint16_t size) { _segment_size = size; }
+
+		/**
+		 * Take over the offload meta data of 'other'
+		 */
+		void offload_info(Packet_descriptor const &other)
+		{
+			_checksum     = other._checksum;
+			_segment_size = other._segment_size;
+		}
+};
+
+
 /*
  * NIC session interface
  *
@@ -60,7 +147,7 @@ struct Nic::Session : Genode::Session
 	 * The acknowledgement queue has always the same size as the submit
 	 * queue. We access the packet content as a char pointer.
 	 */
-	typedef Genode::Packet_stream_policy<Genode::Packet_descriptor,
+	typedef Genode::Packet_stream_policy<Packet_descriptor,
 	                                     QUEUE_SIZE, QUEUE_SIZE, char> Policy;
 
 	typedef Packet_stream_tx::Channel<Policy> Tx;
@@ -116,6 +203,17 @@ struct Nic::Session : Genode::Session
 	 */
 	virtual void link_state_sigh(Genode::Signal_context_capability sigh) = 0;
 
+	/**
+	 * Negotiate offload features
+	 *
+	 * \param requested  features supported by the client
+	 * \return           subset of 'requested' enabled for the session
+	 *
+	 * Without negotiation, no offload features are enabled. Servers that
+	 * do not support offloading keep the default implementation.
+	 */
+	virtual Offload offload(Offload) { return Offload { 0 }; }
+
 	/*******************
 	 ** RPC interface **
 	 *******************/
@@ -126,9 +224,11 @@ struct Nic::Session : Genode::Session
 	GENODE_RPC(Rpc_link_state, bool, link_state);
 	GENODE_RPC(Rpc_link_state_sigh, void, link_state_sigh,
 	           Genode::Signal_context_capability);
+	GENODE_RPC(Rpc_offload, Offload, offload, Offload);
 
 	GENODE_RPC_INTERFACE(Rpc_mac_address, Rpc_link_state,
-	                     Rpc_link_state_sigh, Rpc_tx_cap, Rpc_rx_cap);
+	                     Rpc_link_state_sigh, Rpc_tx_cap, Rpc_rx_cap,
+	                     Rpc_offload);
 };
 
 #endif /* _INCLUDE__NIC_SESSION__NIC_SESSION_H_ */
@@ -0,0 +1,122 @@
+/*
+ * \brief  Server-side shared-memory ring of a LOG session
+ * \author agent
+ * \date   2026-10-19
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+#ifndef _INCLUDE__OS__LOG_RING_BUFFER_H_
+#define _INCLUDE__OS__LOG_RING_BUFFER_H_
+
+#include <util/reconstructible.h>
+#include <base/attached_ram_dataspace.h>
+#include <base/signal.h>
+#include <base/entrypoint.h>
+#include <log_session/ring.h>
+
+namespace Genode { class Log_ring_buffer; }
+
+
+/**
+ * Ring of a LOG session, to be embedded into the session component
+ *
+ * The ring is allocated on demand with the RAM quota that the client donated
+ * via session upgrades. Pending messages are handed to the 'Output' interface
+ * whenever the client notifies the server. The session component must call
+ * 'drain' before handling a 'write' RPC and before closing the session.
+ */
+class Genode::Log_ring_buffer : Noncopyable
+{
+	public:
+
+		struct Output : Interface
+		{
+			/**
+			 * Output null-terminated message taken from the ring
+			 */
+			virtual void output_from_ring(char const *string) = 0;
+		};
+
+		enum { MIN_SIZE = 4096, MAX_SIZE = 1024*1024 };
+
+	private:
+
+		Ram_allocator &_ram;
+		Region_map    &_rm;
+		Output        &_output;
+
+		/* RAM quota donated by the client but not yet used for the ring */
+		size_t _quota = 0;
+
+		Constructible<Attached_ram_dataspace> _ds   { };
+		Constructible<Log_ring>               _ring { };
+
+		Signal_handler<Log_ring_buffer> _handler;
+
+		void _handle_signal()
+		{
+			/* ignore signals before the ring is set up */
+			if (!_ring.constructed())
+				return;
+
+			do { drain(); } while (!_ring->wait());
+		}
+
+	public:
+
+		Log_ring_buffer(Ram_allocator &ram, Region_map &rm, Entrypoint &ep,
+		                Output &output)
+		:
+			_ram(ram), _rm(rm), _output(output),
+			_handler(ep, *this, &Log_ring_buffer::_handle_signal)
+		{ }
+
+		/**
+		 * Account RAM quota donated by a session upgrade
+		 */
+		void upgrade(size_t ram_quota) { _quota += ram_quota; }
+
+		/**
+		 * Return dataspace of the ring, allocate it on first call
+		 *
+		 * \throw Out_of_ram
+		 */
+		Dataspace_capability dataspace(size_t size)
+		{
+			if (_ds.constructed())
+				return _ds->cap();
+
+			size = align_addr(min(max(size, (size_t)MIN_SIZE), (size_t)MAX_SIZE), 12);
+			if (size > _quota)
+				throw Out_of_ram();
+
+			_ds.construct(_ram, _rm, size);
+			_quota -= size;
+
+			_ring.construct(_ds->local_addr<void>(), size);
+			_ring->reset();
+			_ring->wait();
+
+			return _ds->cap();
+		}
+
+		Signal_context_capability sigh() { return _handler; }
+
+		/**
+		 * Output all messages pending in the ring
+		 */
+		void drain()
+		{
+			if (_ring.constructed())
+				_ring->consume([&] (char const *string) {
+					_output.output_from_ring(string); });
+		}
+};
+
+#endif /* _INCLUDE__OS__LOG_RING_BUFFER_H_ */
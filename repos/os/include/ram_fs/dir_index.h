@@ -0,0 +1,260 @@
+/*
+ * \brief  Index of directory entries for in-memory file systems
+ * \author agent
+ * \date   2026-10-19
+ *
+ * Directories with tens of thousands of entries are common for build and
+ * depot-extraction workloads. The index combines a hash table for the
+ * lookup of entries by name with a doubly-linked list in insertion order,
+ * which defines the index of each entry as seen by directory reads. A
+ * cursor remembers the entry that was accessed by index most recently so
+ * that reading a directory sequentially takes constant time per entry.
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+#ifndef _INCLUDE__RAM_FS__DIR_INDEX_H_
+#define _INCLUDE__RAM_FS__DIR_INDEX_H_
+
+/* Genode includes */
+#include <base/allocator.h>
+#include <util/string.h>
+
+namespace File_system { template <typename> class Dir_index; }
+
+
+/**
+ * Index of directory entries
+ *
+ * \param NODE  node type, must inherit 'Dir_index<NODE>::Element' and
+ *              provide the method 'name()' returning the null-terminated
+ *              name of the node
+ */
+template <typename NODE>
+class File_system::Dir_index
+{
+	public:
+
+		class Element
+		{
+			private:
+
+				friend class Dir_index;
+
+				NODE         *_prev      = nullptr;
+				NODE         *_next      = nullptr;
+				NODE         *_hash_next = nullptr;
+				unsigned long _hash      = 0;
+		};
+
+	private:
+
+		/*
+		 * Noncopyable
+		 */
+		Dir_index(Dir_index const &);
+		Dir_index &operator = (Dir_index const &);
+
+		typedef Genode::size_t size_t;
+
+		enum { INITIAL_BUCKETS = 16 };
+
+		Genode::Allocator &_alloc;
+
+		NODE  *_initial_buckets[INITIAL_BUCKETS] { };
+		NODE **_buckets     = _initial_buckets;
+		size_t _num_buckets = INITIAL_BUCKETS;
+
+		NODE  *_first = nullptr;
+		NODE  *_last  = nullptr;
+		size_t _count = 0;
+
+		/* entry accessed by index most recently */
+		NODE  *_cursor       = nullptr;
+		size_t _cursor_index = 0;
+
+		static unsigned long _hash(char const *name, size_t len)
+		{
+			unsigned long hash = 2166136261UL;
+			for (size_t i = 0; i < len && name[i]; i++)
+				hash = (hash ^ (unsigned char)name[i])*16777619UL;
+
+			return hash;
+		}
+
+		NODE *&_bucket(unsigned long hash) const {
+			return _buckets[hash & (_num_buckets - 1)]; }
+
+		void _link_hashed(NODE &node)
+		{
+			NODE *&head = _bucket(node._hash);
+
+			node._hash_next = head;
+			head = &node;
+		}
+
+		void _unlink_hashed(NODE &node)
+		{
+			for (NODE **n = &_bucket(node._hash); *n; n = &(*n)->_hash_next) {
+				if (*n == &node) {
+					*n = node._hash_next;
+					break;
+				}
+			}
+			node._hash_next = nullptr;
+		}
+
+		void _free_buckets()
+		{
+			if (_buckets != _initial_buckets)
+				_alloc.free(_buckets, _num_buckets*sizeof(NODE *));
+		}
+
+		/*
+		 * Double the number of hash buckets
+		 *
+		 * If the allocation fails, the index keeps its current buckets at
+		 * the cost of longer hash chains.
+		 */
+		void _grow()
+		{
+			size_t const num_buckets = 2*_num_buckets;
+
+			NODE **buckets = nullptr;
+			try {
+				buckets = (NODE **)_alloc.alloc(num_buckets*sizeof(NODE *)); }
+			catch (Genode::Out_of_ram)  { return; }
+			catch (Genode::Out_of_caps) { return; }
+
+			for (size_t i = 0; i < num_buckets; i++)
+				buckets[i] = nullptr;
+
+			_free_buckets();
+
+			_buckets     = buckets;
+			_num_buckets = num_buckets;
+
+			for (NODE *n = _first; n; n = n->_next)
+				_link_hashed(*n);
+		}
+
+	public:
+
+		Dir_index(Genode::Allocator &alloc) : _alloc(alloc) { }
+
+		~Dir_index() { _free_buckets(); }
+
+		size_t count() const { return _count; }
+
+		NODE *first() const { return _first; }
+
+		/**
+		 * Append node to the index
+		 */
+		void insert(NODE &node)
+		{
+			if (_count >= _num_buckets)
+				_grow();
+
+			node._hash = _hash(node.name(), ~0UL);
+			_link_hashed(node);
+
+			node._prev = _last;
+			node._next = nullptr;
+
+			if (_last) _last->_next = &node;
+			else       _first       = &node;
+
+			_last = &node;
+			_count++;
+		}
+
+		void remove(NODE &node)
+		{
+			_unlink_hashed(node);
+
+			/*
+			 * Removing the cursor entry moves the cursor to its predecessor.
+			 * Removing any other entry may change the index of the cursor
+			 * entry, which we cannot tell without walking the list.
+			 */
+			if (_cursor == &node && _cursor_index > 0) {
+				_cursor = node._prev;
+				_cursor_index--;
+			} else {
+				_cursor = nullptr;
+			}
+
+			if (node._prev) node._prev->_next = node._next;
+			else            _first            = node._next;
+
+			if (node._next) node._next->_prev = node._prev;
+			else            _last             = node._prev;
+
+			node._prev = node._next = nullptr;
+			_count--;
+		}
+
+		/**
+		 * Look up node by the first 'len' characters of 'name'
+		 */
+		NODE *lookup(char const *name, size_t len) const
+		{
+			unsigned long const hash = _hash(name, len);
+
+			for (NODE *n = _bucket(hash); n; n = n->_hash_next) {
+				if (n->_hash != hash)
+					continue;
+
+				char const * const n_name = n->name();
+				if (Genode::strcmp(n_name, name, len) == 0 && n_name[len] == 0)
+					return n;
+			}
+			return nullptr;
+		}
+
+		NODE *lookup(char const *name) const {
+			return lookup(name, Genode::strlen(name)); }
+
+		/**
+		 * Return node at position 'index' in insertion order
+		 */
+		NODE *at(size_t index)
+		{
+			if (index >= _count)
+				return nullptr;
+
+			/* start from the closest of first entry, cursor, and last entry */
+			NODE  *node = _first;
+			size_t i    = 0;
+
+			if (_cursor) {
+				size_t const dist = index > _cursor_index ? index - _cursor_index
+				                                          : _cursor_index - index;
+				if (dist < index) {
+					node = _cursor;
+					i    = _cursor_index;
+				}
+			}
+
+			if (_count - 1 - index < (index > i ? index - i : i - index)) {
+				node = _last;
+				i    = _count - 1;
+			}
+
+			for (; i < index; i++) node = node->_next;
+			for (; i > index; i--) node = node->_prev;
+
+			_cursor       = node;
+			_cursor_index = index;
+
+			return node;
+		}
+};
+
+#endif /* _INCLUDE__RAM_FS__DIR_INDEX_H_ */
@@ -18,6 +18,8 @@
 #include <util/reconstructible.h>
 #include <os/session_policy.h>
 #include <base/attached_ram_dataspace.h>
+#include <rm_session/rm_session.h>
+#include <region_map/client.h>
 
 namespace Rom {
 	using Genode::size_t;
@@ -25,6 +27,7 @@ namespace Rom {
 	using Genode::Attached_ram_dataspace;
 	using Genode::Interface;
 
+	class Snapshot;
 	class Module;
 	class Readable_module;
 	class Registry;
@@ -57,6 +60,117 @@ struct Rom::Reader : private Reader_list::Element, Interface
 };
 
 
+/**
+ * Immutable version of a module's content shared by all readers
+ *
+ * The content is handed out to the readers as a managed dataspace that
+ * maps the backing store read-only. Hence, a reader cannot modify the
+ * content observed by the other readers of the same module.
+ */
+class Rom::Snapshot : Genode::Noncopyable
+{
+	public:
+
+		/**
+		 * Exception type
+		 *
+		 * Thrown if the kernel platform lacks support for managed
+		 * dataspaces, e.g., base-linux.
+		 */
+		class Managed_dataspace_unavailable { };
+
+	private:
+
+		friend class Module;
+
+		Genode::Rm_session &_rm_session;
+
+		Attached_ram_dataspace _ds;
+
+		Genode::Capability<Genode::Region_map> const _rm_cap {
+			_rm_session.create(_ds.size()) };
+
+		Genode::Region_map_client _rm { _rm_cap };
+
+		Genode::Region_map::Local_addr _attachment { };
+
+		Genode::Dataspace_capability _rm_ds { };
+
+		/**
+		 * Number of readers referring to the snapshot, plus one while the
+		 * snapshot is the module's current content
+		 */
+		unsigned _refs = 0;
+
+		size_t _size = 0;
+
+		Genode::Region_map::Local_addr _attach()
+		{
+			enum { OFFSET = 0, LOCAL_ADDR = false, EXEC = false, WRITE = false };
+			return _rm.attach(_ds.cap(), _ds.size(), OFFSET,
+			                  LOCAL_ADDR, (Genode::addr_t)0, EXEC, WRITE);
+		}
+
+		/**
+		 * Constructor
+		 *
+		 * \throw Managed_dataspace_unavailable
+		 * \throw Out_of_ram
+		 * \throw Out_of_caps
+		 */
+		Snapshot(Genode::Ram_allocator &ram, Genode::Region_map &rm,
+		         Genode::Rm_session &rm_session, size_t capacity)
+		:
+			_rm_session(rm_session), _ds(ram, rm, capacity)
+		{
+			try {
+				_attachment = _attach();
+				_rm_ds      = _rm.dataspace();
+			} catch (...) {
+				_rm_session.destroy(_rm_cap);
+				throw;
+			}
+
+			if (!_rm_ds.valid()) {
+				_rm.detach(_attachment);
+				_rm_session.destroy(_rm_cap);
+				throw Managed_dataspace_unavailable();
+			}
+		}
+
+		size_t _capacity() const { return _ds.size(); }
+
+		/**
+		 * Replace content, which must fit into the snapshot's capacity
+		 */
+		void _assign(char const *src, size_t len)
+		{
+			char * const dst = _ds.local_addr<char>();
+
+			Genode::memcpy(dst, src, len);
+
+			/* clear remainder of old content, append zero termination */
+			Genode::memset(dst + len, 0, Genode::max(_size, len) - len + 1);
+
+			_size = len;
+		}
+
+	public:
+
+		~Snapshot()
+		{
+			_rm.detach(_attachment);
+			_rm_session.destroy(_rm_cap);
+		}
+
+		size_t size() const { return _size; }
+
+		char const *content() const { return _ds.local_addr<char const>(); }
+
+		Genode::Dataspace_capability dataspace() const { return _rm_ds; }
+};
+
+
 struct Rom::Readable_module : Interface
 {
 	/**
@@ -75,6 +189,18 @@ struct Rom::Readable_module : Interface
 	                            size_t dst_len) const = 0;
 
 	virtual size_t size() const = 0;
+
+	/**
+	 * Obtain shared snapshot of the current content
+	 *
+	 * \return  snapshot, or nullptr if the reader is supposed to obtain
+	 *          a private copy via 'read_content' instead
+	 *
+	 * Each acquired snapshot must be returned via 'release_snapshot'.
+	 */
+	virtual Snapshot *acquire_snapshot(Reader const &) { return nullptr; }
+
+	virtual void release_snapshot(Snapshot &) { }
 };
 
 
@@ -164,6 +290,61 @@ struct Rom::Module : private Module_list::Element, Readable_module
 		 */
 		size_t _size = 0;
 
+		/*
+		 * Backing store of shared snapshots, only available if the module
+		 * was created with an 'Rm_session'
+		 */
+		Genode::Allocator  *_snapshot_alloc = nullptr;
+		Genode::Rm_session *_rm_session     = nullptr;
+
+		/*
+		 * Snapshot of the current content, created on demand by the first
+		 * reader after each write
+		 */
+		Snapshot *_snapshot = nullptr;
+
+		/*
+		 * Unused snapshot kept for the next version to avoid the
+		 * allocation of a new dataspace for each report
+		 */
+		Snapshot *_spare = nullptr;
+
+		void _destroy(Snapshot *&snapshot)
+		{
+			if (snapshot)
+				Genode::destroy(_snapshot_alloc, snapshot);
+
+			snapshot = nullptr;
+		}
+
+		void _unref(Snapshot &snapshot)
+		{
+			if (--snapshot._refs > 0)
+				return;
+
+			if (!_spare)
+				_spare = &snapshot;
+			else if (_spare->_capacity() < snapshot._capacity()) {
+				_destroy(_spare);
+				_spare = &snapshot;
+			} else {
+				Snapshot *s = &snapshot;
+				_destroy(s);
+			}
+		}
+
+		/**
+		 * Drop module reference to the snapshot of the outdated content
+		 */
+		void _invalidate_snapshot()
+		{
+			if (!_snapshot)
+				return;
+
+			_unref(*_snapshot);
+			_snapshot = nullptr;
+		}
+
 
 		/********************************
 		 ** Interface used by registry **
@@ -193,6 +374,30 @@ struct Rom::Module : private Module_list::Element, Readable_module
 			_read_policy(read_policy), _write_policy(write_policy)
 		{ }
 
+		/**
+		 * Constructor
+		 *
+		 * \param alloc       allocator for snapshot meta data
+		 * \param rm_session  RM session used to export snapshots read-only
+		 *
+		 * With this variant, readers share the module content via
+		 * snapshots instead of holding private copies.
+		 */
+		Module(Genode::Ram_allocator &ram,
+		       Genode::Region_map    &rm,
+		       Genode::Allocator     &alloc,
+		       Genode::Rm_session    &rm_session,
+		       Name            const &name,
+		       Read_policy     const &read_policy,
+		       Write_policy    const &write_policy)
+		:
+			Module(ram, rm, name, read_policy, write_policy)
+		{
+			_snapshot_alloc = &alloc;
+			_rm_session     = &rm_session;
+		}
+
+
 
 		/*************************************************
 		 ** Interface to be used by the 'Registry' only **
@@ -225,6 +430,7 @@ struct Rom::Module : private Module_list::Element, Readable_module
 				Genode::memset(_ds->local_addr<char>(), 0, _size);
 				_size = 0;
 				_last_writer = nullptr;
+				_invalidate_snapshot();
 			}
 		}
 
@@ -246,6 +452,12 @@ struct Rom::Module : private Module_list::Element, Readable_module
 
 	public:
 
+		~Module()
+		{
+			_invalidate_snapshot();
+			_destroy(_spare);
+		}
+
 		/**
 		 * Assign new content to the ROM module
 		 *
@@ -260,6 +472,8 @@ struct Rom::Module : private Module_list::Element, Readable_module
 
 			_last_writer = &writer;
 
+			_invalidate_snapshot();
+
 			/*
 			 * Realloc backing store if needed
 			 *
@@ -307,6 +521,64 @@ struct Rom::Module : private Module_list::Element, Readable_module
 
 		virtual size_t size() const override { return _size; }
 
+		/**
+		 * Readable_module interface
+		 *
+		 * Contents smaller than 'MIN_SNAPSHOT_SIZE' are still copied into
+		 * the readers' private dataspaces because re-attaching a fresh
+		 * dataspace at the client is more expensive than copying a few
+		 * bytes.
+		 */
+		Snapshot *acquire_snapshot(Reader const &reader) override
+		{
+			enum { MIN_SNAPSHOT_SIZE = 4096 };
+
+			if (!_rm_session || !_ds.constructed() || !_last_writer)
+				return nullptr;
+
+			if (_size < MIN_SNAPSHOT_SIZE)
+				return nullptr;
+
+			if (!_read_policy.read_permitted(*this, *_last_writer, reader))
+				return nullptr;
+
+			if (!_snapshot) {
+
+				/* reuse spare snapshot if large enough */
+				if (_spare && _spare->_capacity() > _size) {
+					_snapshot = _spare;
+					_spare    = nullptr;
+				} else {
+					_destroy(_spare);
+
+					/* fall back to private copies if no snapshot can be created */
+					try {
+						_snapshot = new (_snapshot_alloc)
+							Snapshot(_ram, _rm, *_rm_session, _size + 1);
+					}
+					catch (Snapshot::Managed_dataspace_unavailable) {
+						Genode::warning("managed dataspaces unavailable, "
+						                "snapshot sharing disabled");
+						_rm_session = nullptr;
+						return nullptr;
+					}
+					catch (Genode::Out_of_ram)  { return nullptr; }
+					catch (Genode::Out_of_caps) { return nullptr; }
+				}
+
+				_snapshot->_assign(_ds->local_addr<char const>(), _size);
+				_snapshot->_refs = 1;
+			}
+
+			_snapshot->_refs++;
+			return _snapshot;
+		}
+
+		/**
+		 * Readable_module interface
+		 */
+		void release_snapshot(Snapshot &snapshot) override { _unref(snapshot); }
+
 		Name name() const { return _name; }
 };
 
@@ -35,6 +35,12 @@ class Rom::Session_component : public Genode::Rpc_object<Genode::Rom_session>,
 {
 	private:
 
+		/*
+		 * Noncopyable
+		 */
+		Session_component(Session_component const &);
+		Session_component &operator = (Session_component const &);
+
 		Genode::Ram_allocator &_ram;
 		Genode::Region_map    &_rm;
 
@@ -53,6 +59,24 @@ class Rom::Session_component : public Genode::Rpc_object<Genode::Rom_session>,
 
 		Constructible<Genode::Attached_ram_dataspace> _ds { };
 
+		/*
+		 * Shared snapshot handed out instead of '_ds' for large contents
+		 */
+		Snapshot *_snapshot = nullptr;
+
+		/**
+		 * True if the module changed after '_snapshot' was obtained
+		 */
+		bool _snapshot_outdated = false;
+
+		void _release_snapshot()
+		{
+			if (_snapshot)
+				_module.release_snapshot(*_snapshot);
+
+			_snapshot = nullptr;
+		}
+
 		size_t _content_size = 0;
 
 		/**
@@ -63,10 +87,22 @@ class Rom::Session_component : public Genode::Rpc_object<Genode::Rom_session>,
 
 		Genode::Signal_context_capability _sigh { };
 
+		/**
+		 * True if the client has not responded to the last signal yet
+		 *
+		 * Further changes are not signalled until the client obtains the
+		 * content via 'update' or 'dataspace'. This way, a series of
+		 * reports results in only one signal per reader.
+		 */
+		bool _signal_pending = false;
+
 		void _notify_client()
 		{
-			if (_sigh.valid())
-				Genode::Signal_transmitter(_sigh).submit();
+			if (!_sigh.valid() || _signal_pending)
+				return;
+
+			_signal_pending = true;
+			Genode::Signal_transmitter(_sigh).submit();
 		}
 
 	public:
@@ -81,6 +117,7 @@ class Rom::Session_component : public Genode::Rpc_object<Genode::Rom_session>,
 
 		~Session_component()
 		{
+			_release_snapshot();
 			_registry.release(*this, _module);
 		}
 
@@ -90,6 +127,20 @@ class Rom::Session_component : public Genode::Rpc_object<Genode::Rom_session>,
 		{
 			using namespace Genode;
 
+				_signal_pending = false;
+
+				_release_snapshot();
+				_snapshot = _module.acquire_snapshot(*this);
+
+				if (_snapshot) {
+					_ds.destruct();
+					_snapshot_outdated = false;
+					_content_size = _snapshot->size();
+					_valid = true;
+
+					return static_cap_cast<Rom_dataspace>(_snapshot->dataspace());
+				}
+
 				/* replace dataspace by new one */
 				/* XXX we could keep the old dataspace if the size fits */
 				_ds.construct(_ram, _rm, _module.size());
@@ -107,6 +158,12 @@ class Rom::Session_component : public Genode::Rpc_object<Genode::Rom_session>,
 
 		bool update() override
 		{
+			_signal_pending = false;
+
+			/* a snapshot is immutable, a new version requires a new dataspace */
+			if (_snapshot)
+				return !_snapshot_outdated;
+
 			if (!_ds.constructed() || _module.size() > _ds->size())
 				return false;
 
@@ -128,6 +185,7 @@ class Rom::Session_component : public Genode::Rpc_object<Genode::Rom_session>,
 		void sigh(Genode::Signal_context_capability sigh) override
 		{
 			_sigh = sigh;
+			_signal_pending = false;
 
 			/*
 			 * Notify client initially to enforce a client-side ROM update.
@@ -142,6 +200,7 @@ class Rom::Session_component : public Genode::Rpc_object<Genode::Rom_session>,
 		 */
 		void notify_module_changed() override
 		{
+			_snapshot_outdated = true;
 			_notify_client();
 		}
 
@@ -155,6 +214,7 @@ class Rom::Session_component : public Genode::Rpc_object<Genode::Rom_session>,
 				return;
 
 			_valid = false;
+			_snapshot_outdated = true;
 			_notify_client();
 		}
 };
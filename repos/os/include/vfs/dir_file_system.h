@@ -843,6 +843,15 @@ class Vfs::Dir_file_system : public File_system
 		char const *name() const    { return "dir"; }
 		char const *type() override { return "dir"; }
 
+		bool thread_safe() override
+		{
+			for (File_system *fs = _first_file_system; fs; fs = fs->next)
+				if (!fs->thread_safe())
+					return false;
+
+			return true;
+		}
+
 		void apply_config(Genode::Xml_node const &node) override
 		{
 			using namespace Genode;
@@ -49,6 +49,17 @@ class Vfs::File_system : public Directory_service, public File_io_service
 		 * Return the file-system type
 		 */
 		virtual char const *type() = 0;
+
+		/**
+		 * Return true if the file system may be used by multiple threads
+		 *
+		 * A thread-safe file system must tolerate concurrent calls of its
+		 * directory-service and file-I/O operations and must not wait for
+		 * I/O signals of the component's entrypoint. Users of the VFS, like
+		 * the VFS server, may process independent requests in parallel only
+		 * if all file systems are thread safe.
+		 */
+		virtual bool thread_safe() { return false; }
 };
 
 #endif /* _INCLUDE__VFS__FILE_SYSTEM_H_ */
@@ -130,7 +130,9 @@ Init::Child::apply_config(Xml_node start_node)
 		_heartbeat_enabled = start_node.has_sub_node("heartbeat");
 
 		/* import new start node */
+		_route_model.destruct();
 		_start_node.construct(_alloc, start_node);
+		_update_route_model();
 	}
 
 	/*
@@ -507,21 +509,22 @@ Init::Child::Route Init::Child::resolve_session_request(Service::Name const &ser
 		return Route { _session_requester.service(),
 		               Session::Label(), Session::Diag{false} };
 
-	try {
-		Xml_node route_node = _default_route_accessor.default_route();
-		try {
-			route_node = _start_node->xml().sub_node("route"); }
-		catch (...) { }
-		Xml_node service_node = route_node.sub_node();
+	Route_model const &route_model = _route_model.constructed()
+	                               ? *_route_model
+	                               : _default_route_accessor.default_route();
+
+	Constructible<Route> route { };
 
-		for (; ; service_node = service_node.next()) {
+	route_model.for_each_candidate(service_name, [&] (Route_model::Rule const &rule) {
 
-			bool service_wildcard = service_node.has_type("any-service");
+		if (rule.label_dependent
+		 && !service_node_matches(rule.node, label, name(), service_name))
+			return false;
 
-			if (!service_node_matches(service_node, label, name(), service_name))
-				continue;
+		bool const service_wildcard = rule.any_service;
 
-			Xml_node target = service_node.sub_node();
+		try {
+			Xml_node target = rule.node.sub_node();
 			for (; ; target = target.next()) {
 
 				/*
@@ -545,8 +548,9 @@ Init::Child::Route Init::Child::resolve_session_request(Service::Name const &ser
 				if (target.has_type("parent")) {
 
 					try {
-						return Route { find_service(_parent_services, service_name, no_filter),
-						               target_label, target_diag };
+						route.construct(Route { find_service(_parent_services, service_name, no_filter),
+						                        target_label, target_diag });
+						return true;
 					} catch (Service_denied) { }
 				}
 
@@ -560,8 +564,9 @@ Init::Child::Route Init::Child::resolve_session_request(Service::Name const &ser
 						return s.child_name() != server_name; };
 
 					try {
-						return Route { find_service(_child_services, service_name, filter_server_name),
-						               target_label, target_diag };
+						route.construct(Route { find_service(_child_services, service_name, filter_server_name),
+						                        target_label, target_diag });
+						return true;
 
 					} catch (Service_denied) { }
 				}
@@ -574,8 +579,9 @@ Init::Child::Route Init::Child::resolve_session_request(Service::Name const &ser
 						throw Service_denied();
 					}
 					try {
-						return Route { find_service(_child_services, service_name, no_filter),
-						               target_label, target_diag };
+						route.construct(Route { find_service(_child_services, service_name, no_filter),
+						                        target_label, target_diag });
+						return true;
 
 					} catch (Service_denied) { }
 				}
@@ -589,7 +595,15 @@ Init::Child::Route Init::Child::resolve_session_request(Service::Name const &ser
 					break;
 			}
 		}
-	} catch (Xml_node::Nonexistent_sub_node) { }
+
+		/* a rule without target terminates the lookup */
+		catch (Xml_node::Nonexistent_sub_node) { return true; }
+
+		return false;
+	});
+
+	if (route.constructed())
+		return *route;
 
 	warning(name(), ": no route to service \"", service_name, "\" (label=\"", label, "\")");
 	throw Service_denied();
@@ -727,6 +741,7 @@ Init::Child::Child(Env                      &env,
 	_env(env), _alloc(alloc), _verbose(verbose), _id(id),
 	_report_update_trigger(report_update_trigger),
 	_list_element(this),
+	_name_element(this),
 	_start_node(_alloc, start_node),
 	_default_route_accessor(default_route_accessor),
 	_default_caps_accessor(default_caps_accessor),
@@ -749,6 +764,8 @@ Init::Child::Child(Env                      &env,
 		log("  priority:   ", _resources.priority);
 	}
 
+	_update_route_model();
+
 	/*
 	 * Determine services provided by the child
 	 */
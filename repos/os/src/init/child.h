@@ -28,6 +28,7 @@
 #include <name_registry.h>
 #include <service.h>
 #include <utils.h>
+#include <route_model.h>
 
 namespace Init { class Child; }
 
@@ -48,7 +49,7 @@ class Init::Child : Child_policy, Routed_service::Wakeup
 		 */
 		struct Id { unsigned value; };
 
-		struct Default_route_accessor : Interface { virtual Xml_node default_route() = 0; };
+		struct Default_route_accessor : Interface { virtual Route_model const &default_route() = 0; };
 		struct Default_caps_accessor  : Interface { virtual Cap_quota default_caps() = 0; };
 
 		template <typename QUOTA>
@@ -84,8 +85,30 @@ class Init::Child : Child_policy, Routed_service::Wakeup
 
 		List_element<Child> _list_element;
 
+		/* element of the child registry's name index */
+		List_element<Child> _name_element;
+
+		/* used by the child registry to detect obsolete children */
+		bool _referenced = false;
+
 		Reconstructible<Buffered_xml> _start_node;
 
+		/*
+		 * Routing rules of the '<route>' node of the start node, if present
+		 *
+		 * The model refers to '_start_node' and must be updated whenever
+		 * '_start_node' is reconstructed.
+		 */
+		Constructible<Route_model> _route_model { };
+
+		void _update_route_model()
+		{
+			_route_model.destruct();
+
+			if (_start_node->xml().has_sub_node("route"))
+				_route_model.construct(_alloc, _start_node->xml().sub_node("route"));
+		}
+
 		/*
 		 * Version attribute of the start node, used to force child restarts.
 		 */
@@ -29,13 +29,34 @@ class Init::Child_registry : public Name_registry, Child_list
 
 		List<Alias> _aliases { };
 
+		/*
+		 * Index of children by name
+		 *
+		 * Abandoned children may share their name with the child that
+		 * replaces them. Hence, a bucket may contain several children of
+		 * the same name.
+		 */
+		enum { NUM_BUCKETS = 64 };
+
+		Child_list _buckets[NUM_BUCKETS] { };
+
+		static unsigned _bucket(Child_policy::Name const &name)
+		{
+			/* FNV-1a */
+			unsigned long hash = 2166136261UL;
+			for (char const *s = name.string(); *s; s++)
+				hash = (hash ^ (unsigned char)*s) * 16777619UL;
+
+			return hash % NUM_BUCKETS;
+		}
+
 		bool _unique(const char *name) const
 		{
 			/* check for name clash with an existing child */
-			Genode::List_element<Init::Child> const *curr = first();
-			for (; curr; curr = curr->next())
-				if (curr->object()->has_name(name))
-					return false;
+			bool clash = false;
+			for_each_child_with_name(name, [&] (Child const &) { clash = true; });
+			if (clash)
+				return false;
 
 			/* check for name clash with an existing alias */
 			for (Alias const *a = _aliases.first(); a; a = a->next()) {
@@ -59,6 +80,7 @@ class Init::Child_registry : public Name_registry, Child_list
 		void insert(Child *child)
 		{
 			Child_list::insert(&child->_list_element);
+			_buckets[_bucket(child->name())].insert(&child->_name_element);
 		}
 
 		/**
@@ -67,6 +89,7 @@ class Init::Child_registry : public Name_registry, Child_list
 		void remove(Child *child)
 		{
 			Child_list::remove(&child->_list_element);
+			_buckets[_bucket(child->name())].remove(&child->_name_element);
 		}
 
 		/**
@@ -123,6 +146,59 @@ class Init::Child_registry : public Name_registry, Child_list
 			}
 		}
 
+		/**
+		 * Call 'fn' for each child named 'name', including abandoned ones
+		 */
+		template <typename FN>
+		void for_each_child_with_name(Child_policy::Name const &name, FN const &fn) const
+		{
+			Genode::List_element<Child> const *curr = _buckets[_bucket(name)].first();
+			for (; curr; curr = curr->next())
+				if (curr->object()->has_name(name))
+					fn(*curr->object());
+		}
+
+		template <typename FN>
+		void for_each_child_with_name(Child_policy::Name const &name, FN const &fn)
+		{
+			Genode::List_element<Child> *curr = _buckets[_bucket(name)].first(), *next = nullptr;
+			for (; curr; curr = next) {
+				next = curr->next();
+				if (curr->object()->has_name(name))
+					fn(*curr->object());
+			}
+		}
+
+		/**
+		 * Call 'fn' for each child without a corresponding start node
+		 *
+		 * \param config  configuration containing the '<start>' nodes
+		 * \param fn      functor called with each obsolete child
+		 *
+		 * A child is obsolete if no start node with the child's name and
+		 * version exists.
+		 */
+		template <typename FN>
+		void for_each_obsolete_child(Xml_node config, FN const &fn)
+		{
+			for_each_child([&] (Child &child) { child._referenced = false; });
+
+			config.for_each_sub_node("start", [&] (Xml_node node) {
+
+				Child::Version const version =
+					node.attribute_value("version", Child::Version());
+
+				for_each_child_with_name(node.attribute_value("name", Child_policy::Name()),
+				                         [&] (Child &child) {
+					if (child.has_version(version))
+						child._referenced = true; });
+			});
+
+			for_each_child([&] (Child &child) {
+				if (!child._referenced)
+					fn(child); });
+		}
+
 		void report_state(Xml_generator &xml, Report_detail const &detail) const
 		{
 			for_each_child([&] (Child &child) { child.report_state(xml, detail); });
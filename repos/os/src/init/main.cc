@@ -44,6 +44,13 @@ struct Init::Main : State_reporter::Producer,
 
 	Constructible<Buffered_xml> _default_route { };
 
+	/*
+	 * Routing rules of '_default_route', updated along with '_default_route'
+	 */
+	Constructible<Route_model> _default_route_model { };
+
+	Route_model const _empty_route_model { _heap, Xml_node("<empty/>") };
+
 	Cap_quota _default_caps { 0 };
 
 	unsigned _child_cnt = 0;
@@ -127,10 +134,10 @@ struct Init::Main : State_reporter::Producer,
 	/**
 	 * Default_route_accessor interface
 	 */
-	Xml_node default_route() override
+	Route_model const &default_route() override
 	{
-		return _default_route.constructed() ? _default_route->xml()
-		                                    : Xml_node("<empty/>");
+		return _default_route_model.constructed() ? *_default_route_model
+		                                          : _empty_route_model;
 	}
 
 	/**
@@ -247,17 +254,8 @@ void Init::Main::_update_aliases_from_config()
 
 void Init::Main::_abandon_obsolete_children()
 {
-	_children.for_each_child([&] (Child &child) {
-
-		bool obsolete = true;
-		_config_xml.for_each_sub_node("start", [&] (Xml_node node) {
-			if (child.has_name   (node.attribute_value("name", Child_policy::Name()))
-			 && child.has_version(node.attribute_value("version", Child::Version())))
-				obsolete = false; });
-
-		if (obsolete)
-			child.abandon();
-	});
+	_children.for_each_obsolete_child(_config_xml, [&] (Child &child) {
+		child.abandon(); });
 }
 
 
@@ -278,8 +276,8 @@ void Init::Main::_update_children_config()
 			Child_policy::Name const start_node_name =
 				node.attribute_value("name", Child_policy::Name());
 
-			_children.for_each_child([&] (Child &child) {
-				if (!child.abandoned() && child.name() == start_node_name) {
+			_children.for_each_child_with_name(start_node_name, [&] (Child &child) {
+				if (!child.abandoned()) {
 					switch (child.apply_config(node)) {
 					case Child::NO_SIDE_EFFECTS: break;
 					case Child::MAY_HAVE_SIDE_EFFECTS: side_effects = true; break;
@@ -308,9 +306,13 @@ void Init::Main::_handle_config()
 
 	/* determine default route for resolving service requests */
 	try {
+		_default_route_model.destruct();
 		_default_route.construct(_heap, _config_xml.sub_node("default-route")); }
 	catch (...) { }
 
+	if (_default_route.constructed())
+		_default_route_model.construct(_heap, _default_route->xml());
+
 	_default_caps = Cap_quota { 0 };
 	try {
 		_default_caps = Cap_quota { _config_xml.sub_node("default")
@@ -361,14 +363,13 @@ void Init::Main::_handle_config()
 
 			unsigned num_abandoned = 0;
 
-			_children.for_each_child([&] (Child const &child) {
-				if (child.name() == start_node.attribute_value("name", Child_policy::Name())) {
+			_children.for_each_child_with_name(
+				start_node.attribute_value("name", Child_policy::Name()),
+				[&] (Child const &child) {
 					if (child.abandoned())
 						num_abandoned++;
 					else
-						exists = true;
-				}
-			});
+						exists = true; });
 
 			/* skip start node if corresponding child already exists */
 			if (exists)
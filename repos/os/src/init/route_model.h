@@ -0,0 +1,193 @@
+/*
+ * \brief  Pre-processed routing rules
+ * \author agent
+ * \date   2026-10-19
+ *
+ * The route model is created from a '<route>' or '<default-route>' node
+ * whenever the configuration changes. It indexes the routing rules by
+ * service name so that a session request visits only the rules for the
+ * requested service and the '<any-service>' rules instead of parsing all
+ * rules of the XML node.
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+#ifndef _SRC__INIT__ROUTE_MODEL_H_
+#define _SRC__INIT__ROUTE_MODEL_H_
+
+/* Genode includes */
+#include <base/allocator.h>
+#include <base/service.h>
+#include <util/xml_node.h>
+#include <util/construct_at.h>
+
+/* local includes */
+#include <types.h>
+
+namespace Init { class Route_model; }
+
+
+class Init::Route_model
+{
+	public:
+
+		struct Rule
+		{
+			/*
+			 * Noncopyable
+			 */
+			Rule(Rule const &);
+			Rule &operator = (Rule const &);
+
+			Xml_node const node;
+
+			bool const any_service = node.has_type("any-service");
+
+			Service::Name const service_name =
+				node.attribute_value("name", Service::Name());
+
+			/*
+			 * True if the rule has label attributes to be evaluated for
+			 * each session request
+			 */
+			bool const label_dependent =
+				node.has_attribute("label")        ||
+				node.has_attribute("label_prefix") ||
+				node.has_attribute("label_suffix") ||
+				node.has_attribute("label_last")   ||
+				node.has_attribute("unscoped_label");
+
+			/* next rule of the same bucket in XML order */
+			Rule *next = nullptr;
+
+			Rule(Xml_node node) : node(node) { }
+		};
+
+	private:
+
+		/*
+		 * Noncopyable
+		 */
+		Route_model(Route_model const &);
+		Route_model &operator = (Route_model const &);
+
+		enum { NUM_BUCKETS = 16 };
+
+		Allocator &_alloc;
+
+		unsigned _num_rules = 0;
+
+		Rule *_rules = nullptr;
+
+		Rule *_any_service = nullptr;
+
+		/* first rule for each service-name bucket */
+		Rule *_buckets[NUM_BUCKETS] { };
+
+		static unsigned _bucket(Service::Name const &name)
+		{
+			/* FNV-1a */
+			unsigned long hash = 2166136261UL;
+			for (char const *s = name.string(); *s; s++)
+				hash = (hash ^ (unsigned char)*s) * 16777619UL;
+
+			return hash % NUM_BUCKETS;
+		}
+
+		static bool _is_rule(Xml_node node)
+		{
+			return node.has_type("service") || node.has_type("any-service");
+		}
+
+	public:
+
+		Route_model(Allocator &alloc, Xml_node route)
+		:
+			_alloc(alloc)
+		{
+			route.for_each_sub_node([&] (Xml_node node) {
+				if (_is_rule(node))
+					_num_rules++; });
+
+			if (_num_rules == 0)
+				return;
+
+			_rules = (Rule *)_alloc.alloc(_num_rules*sizeof(Rule));
+
+			/* tails of the chains, used for appending rules in XML order */
+			Rule *last_any = nullptr;
+			Rule *last[NUM_BUCKETS] { };
+
+			unsigned i = 0;
+			route.for_each_sub_node([&] (Xml_node node) {
+
+				if (!_is_rule(node))
+					return;
+
+				Rule &rule = *construct_at<Rule>(&_rules[i++], node);
+
+				Rule *&tail = rule.any_service ? last_any
+				                               : last[_bucket(rule.service_name)];
+				Rule *&head = rule.any_service ? _any_service
+				                               : _buckets[_bucket(rule.service_name)];
+				if (tail)
+					tail->next = &rule;
+				else
+					head = &rule;
+
+				tail = &rule;
+			});
+		}
+
+		~Route_model()
+		{
+			if (!_rules)
+				return;
+
+			for (unsigned i = 0; i < _num_rules; i++)
+				_rules[i].~Rule();
+
+			_alloc.free(_rules, _num_rules*sizeof(Rule));
+		}
+
+		/**
+		 * Call 'fn' for each rule that applies to 'service_name' in XML order
+		 *
+		 * The functor returns true to stop the iteration.
+		 */
+		template <typename FN>
+		void for_each_candidate(Service::Name const &service_name, FN const &fn) const
+		{
+			Rule const *named = _buckets[_bucket(service_name)];
+			Rule const *any   = _any_service;
+
+			auto skip_other_names = [&] ()
+			{
+				while (named && named->service_name != service_name)
+					named = named->next;
+			};
+
+			/* merge both chains according to the position of the rules */
+			for (skip_other_names(); named || any; skip_other_names()) {
+
+				Rule const *rule = nullptr;
+				if (!any || (named && named < any)) {
+					rule  = named;
+					named = named->next;
+				} else {
+					rule  = any;
+					any   = any->next;
+				}
+
+				if (fn(*rule))
+					return;
+			}
+		}
+};
+
+#endif /* _SRC__INIT__ROUTE_MODEL_H_ */
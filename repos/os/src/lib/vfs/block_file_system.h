@@ -41,11 +41,27 @@ class Vfs::Block_file_system : public Single_file_system
 
 		Genode::Allocator_avl _tx_block_alloc { &_env.alloc() };
 
+		static Genode::size_t _buffer_size(Genode::Xml_node const &config)
+		{
+			return config.attribute_value("buffer_size",
+			                              Genode::Number_of_bytes(128*1024));
+		}
+
+		Genode::size_t const _tx_buf_size;
+
 		Block::Connection<> _block {
-			_env.env(), &_tx_block_alloc, 128*1024, _label.string() };
+			_env.env(), &_tx_block_alloc, _tx_buf_size, _label.string() };
 
 		Block::Session::Info const _info { _block.info() };
 
+		/*
+		 * Limit the size of a single packet such that several packets can
+		 * be in flight at the same time
+		 */
+		file_size const _max_packet_size {
+			Genode::max((file_size)_info.block_size,
+			            (file_size)(_tx_buf_size / 4) & ~(file_size)(_info.block_size - 1)) };
+
 		Block::Session::Tx::Source *_tx_source;
 
 		bool _writeable;
@@ -73,6 +89,7 @@ class Vfs::Block_file_system : public Single_file_system
 				Block::Connection<>               &_block;
 				Genode::size_t               const _block_size;
 				Block::sector_t              const _block_count;
+				file_size                    const _max_packet_size;
 				Block::Session::Tx::Source        *_tx_source;
 				bool                         const _writeable;
 				Genode::Signal_receiver           &_signal_receiver;
@@ -85,61 +102,101 @@ class Vfs::Block_file_system : public Single_file_system
 				Block_vfs_handle(Block_vfs_handle const &);
 				Block_vfs_handle &operator = (Block_vfs_handle const &);
 
-				file_size _block_io(file_size nr, void *buf, file_size sz,
-				                    bool write, bool bulk = false)
+				/*
+				 * Transfer 'sz' bytes starting at block 'nr'
+				 *
+				 * The request is split into packets of at most
+				 * '_max_packet_size' bytes. As many packets as the bulk
+				 * buffer and the submit queue permit are in flight at the
+				 * same time. Because acknowledgements may arrive in any
+				 * order, the payload of each packet is located via its
+				 * block number.
+				 *
+				 * \return number of bytes transferred, or 0 on error
+				 */
+				file_size _block_io(file_size nr, void *buf, file_size sz, bool write)
 				{
 					Block::Packet_descriptor::Opcode op;
 					op = write ? Block::Packet_descriptor::WRITE : Block::Packet_descriptor::READ;
 
-					file_size packet_size  = bulk ? sz : _block_size;
-					file_size packet_count = bulk ? (sz / _block_size) : 1;
+					Lock::Guard guard(_lock);
 
-					Block::Packet_descriptor packet;
+					char * const data = (char *)buf;
 
-					/* sanity check */
-					if (packet_count > _block_buffer_count) {
-						packet_size  = _block_buffer_count * _block_size;
-						packet_count = _block_buffer_count;
-					}
+					file_size max_packet_size = _max_packet_size;
+					file_size submitted       = 0;
+					unsigned  in_flight       = 0;
+					bool      succeeded       = true;
 
-					while (true) {
-						try {
-							Lock::Guard guard(_lock);
+					while (submitted < sz || in_flight) {
 
-							packet = _block.alloc_packet(packet_size);
-							break;
-						} catch (Block::Session::Tx::Source::Packet_alloc_failed) {
-							if (!_tx_source->ready_to_submit())
-								_signal_receiver.wait_for_signal();
-							else {
-								if (packet_count > 1) {
-									packet_size  /= 2;
-									packet_count /= 2;
+						/* submit as many packets as possible */
+						while (submitted < sz && _tx_source->ready_to_submit()) {
+
+							file_size const length = Genode::min(sz - submitted,
+							                                     max_packet_size);
+							Block::Packet_descriptor packet;
+							try { packet = _block.alloc_packet(length); }
+							catch (Block::Session::Tx::Source::Packet_alloc_failed) {
+
+								if (in_flight)
+									break;
+
+								/*
+								 * No acknowledgement will free buffer space, so
+								 * give up if even a single block does not fit
+								 */
+								if (max_packet_size <= _block_size) {
+									Genode::error("could not allocate packet for ",
+									              write ? "write" : "read");
+									return 0;
 								}
+
+								/* try smaller packets if the buffer is fragmented */
+								max_packet_size = Genode::max((file_size)_block_size,
+								                              (max_packet_size / 2)
+								                              & ~(file_size)(_block_size - 1));
+								break;
 							}
+
+							Block::Packet_descriptor const
+								p(packet, op, nr + submitted / _block_size,
+								  length / _block_size);
+
+							if (write)
+								Genode::memcpy(_tx_source->packet_content(p),
+								               data + submitted, length);
+
+							_tx_source->submit_packet(p);
+							submitted += length;
+							in_flight++;
 						}
-					}
-					Lock::Guard guard(_lock);
 
-					Block::Packet_descriptor p(packet, op, nr, packet_count);
+						if (!in_flight) {
+							if (!_tx_source->ready_to_submit())
+								_signal_receiver.wait_for_signal();
+							continue;
+						}
 
-					if (write)
-						Genode::memcpy(_tx_source->packet_content(p), buf, packet_size);
+						Block::Packet_descriptor const p = _tx_source->get_acked_packet();
+						in_flight--;
 
-					_tx_source->submit_packet(p);
-					p = _tx_source->get_acked_packet();
+						if (!p.succeeded())
+							succeeded = false;
+						else if (!write)
+							Genode::memcpy(data + (p.block_number() - nr) * _block_size,
+							               _tx_source->packet_content(p),
+							               p.block_count() * _block_size);
 
-					if (!p.succeeded()) {
-						Genode::error("Could not read block(s)");
 						_tx_source->release_packet(p);
-						return 0;
 					}
 
-					if (!write)
-						Genode::memcpy(buf, _tx_source->packet_content(p), packet_size);
+					if (!succeeded) {
+						Genode::error("Could not ", write ? "write" : "read", " block(s)");
+						return 0;
+					}
 
-					_tx_source->release_packet(p);
-					return packet_size;
+					return sz;
 				}
 
 			public:
@@ -155,6 +212,7 @@ class Vfs::Block_file_system : public Single_file_system
 				                 Block::Connection<>               &block,
 				                 Genode::size_t                     block_size,
 				                 Block::sector_t                    block_count,
+				                 file_size                          max_packet_size,
 				                 Block::Session::Tx::Source        *tx_source,
 				                 bool                               writeable,
 				                 Genode::Signal_receiver           &signal_receiver,
@@ -170,6 +228,7 @@ class Vfs::Block_file_system : public Single_file_system
 				  _block(block),
 				  _block_size(block_size),
 				  _block_count(block_count),
+				  _max_packet_size(max_packet_size),
 				  _tx_source(tx_source),
 				  _writeable(writeable),
 				  _signal_receiver(signal_receiver),
@@ -200,7 +259,8 @@ class Vfs::Block_file_system : public Single_file_system
 						 * We take a shortcut and read the blocks all at once if the
 						 * offset is aligned on a block boundary and the count is a
 						 * multiple of the block size, e.g. 4K reads will be read at
-						 * once.
+						 * once. Large reads are split into concurrently submitted
+						 * packets by '_block_io'.
 						 *
 						 * XXX this is quite hackish because we have to omit partial
 						 * blocks at the end.
@@ -208,7 +268,7 @@ class Vfs::Block_file_system : public Single_file_system
 						if (displ == 0 && !(count < _block_size)) {
 							file_size bytes_left = count - (count % _block_size);
 
-							nbytes = _block_io(blk_nr, dst + read, bytes_left, false, true);
+							nbytes = _block_io(blk_nr, dst + read, bytes_left, false);
 							if (nbytes == 0) {
 								Genode::error("error while reading block:", blk_nr, " from block device");
 								return READ_ERR_INVALID;
@@ -277,7 +337,7 @@ class Vfs::Block_file_system : public Single_file_system
 							file_size bytes_left = count - (count % _block_size);
 
 							nbytes = _block_io(blk_nr, (void*)(buf + written),
-							                   bytes_left, true, true);
+							                   bytes_left, true);
 							if (nbytes == 0) {
 								Genode::error("error while write block:", blk_nr, " to block device");
 								return WRITE_ERR_INVALID;
@@ -331,6 +391,7 @@ class Vfs::Block_file_system : public Single_file_system
 			_label(config.attribute_value("label", Label())),
 			_block_buffer(0),
 			_block_buffer_count(config.attribute_value("block_buffer_count", 1UL)),
+			_tx_buf_size(_buffer_size(config)),
 			_tx_source(_block.tx()),
 			_writeable(_info.writeable),
 			_source_submit_cap(_signal_receiver.manage(&_signal_context))
@@ -371,6 +432,7 @@ class Vfs::Block_file_system : public Single_file_system
 				                                           _block,
 				                                           _info.block_size,
 				                                           _info.block_count,
+				                                           _max_packet_size,
 				                                           _tx_source,
 				                                           _info.writeable,
 				                                           _signal_receiver,
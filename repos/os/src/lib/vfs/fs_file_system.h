@@ -19,6 +19,7 @@
 /* Genode includes */
 #include <base/allocator_avl.h>
 #include <base/id_space.h>
+#include <base/registry.h>
 #include <file_system_session/connection.h>
 
 namespace Vfs { class Fs_file_system; }
@@ -53,6 +54,25 @@ class Vfs::Fs_file_system : public File_system
 		Handle_space _handle_space { };
 		Handle_space _watch_handle_space { };
 
+		/**
+		 * File content provided as dataspace by the file-system server
+		 *
+		 * The file handle stays open until the dataspace is released because
+		 * the server frees the dataspace when the handle is closed.
+		 */
+		struct Mapping
+		{
+			::File_system::File_handle const handle;
+			Dataspace_capability       const ds;
+
+			Mapping(::File_system::File_handle handle, Dataspace_capability ds)
+			: handle(handle), ds(ds) { }
+		};
+
+		typedef Genode::Registered_no_delete<Mapping> Registered_mapping;
+
+		Genode::Registry<Registered_mapping> _mappings { };
+
 		struct Handle_state
 		{
 			enum class Read_ready_state { IDLE, PENDING, READY };
@@ -579,13 +599,49 @@ class Vfs::Fs_file_system : public File_system
 		 ** Directory-service interface **
 		 *********************************/
 
-		Dataspace_capability dataspace(char const *) override
+		Dataspace_capability dataspace(char const *path) override
 		{
-			/* cannot be implemented without blocking */
+			Absolute_path dir_path(path);
+			dir_path.strip_last_element();
+
+			Absolute_path file_name(path);
+			file_name.keep_only_last_element();
+
+			::File_system::File_handle file { ~0UL };
+
+			try {
+				::File_system::Dir_handle dir = _fs.dir(dir_path.base(), false);
+				Fs_handle_guard dir_guard(*this, _fs, dir, _handle_space, _fs);
+
+				file = _fs.file(dir, file_name.base() + 1,
+				                ::File_system::READ_ONLY, false);
+			}
+			catch (...) { return Dataspace_capability(); }
+
+			/* the server may not support the mapping of files */
+			try {
+				Dataspace_capability const ds = _fs.dataspace(file);
+
+				new (_env.alloc()) Registered_mapping(_mappings, file, ds);
+				return ds;
+			}
+			catch (...) { }
+
+			_fs.close(file);
 			return Dataspace_capability();
 		}
 
-		void release(char const *, Dataspace_capability) override { }
+		void release(char const *, Dataspace_capability ds) override
+		{
+			_mappings.for_each([&] (Registered_mapping &mapping) {
+
+				if (!(mapping.ds == ds))
+					return;
+
+				_fs.close(mapping.handle);
+				destroy(_env.alloc(), &mapping);
+			});
+		}
 
 		Stat_result stat(char const *path, Stat &out) override
 		{
@@ -30,6 +30,8 @@ struct Vfs::Null_file_system : Single_file_system
 	static char const *name()   { return "null"; }
 	char const *type() override { return "null"; }
 
+	bool thread_safe() override { return true; }
+
 	struct Null_vfs_handle : Single_vfs_handle
 	{
 		Null_vfs_handle(Directory_service &ds,
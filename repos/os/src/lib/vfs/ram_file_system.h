@@ -15,10 +15,10 @@
 #define _INCLUDE__VFS__RAM_FILE_SYSTEM_H_
 
 #include <ram_fs/chunk.h>
+#include <ram_fs/dir_index.h>
 #include <ram_fs/param.h>
 #include <vfs/file_system.h>
 #include <dataspace/client.h>
-#include <util/avl_tree.h>
 
 namespace Vfs { class Ram_file_system; }
 
@@ -93,12 +93,12 @@ struct Vfs_ram::Watch_handle final : public  Vfs_watch_handle,
 };
 
 
-class Vfs_ram::Node : private Genode::Avl_node<Node>, private Genode::Lock
+class Vfs_ram::Node : private File_system::Dir_index<Node>::Element,
+                      private Genode::Lock
 {
 	private:
 
-		friend class Genode::Avl_node<Node>;
-		friend class Genode::Avl_tree<Node>;
+		friend class File_system::Dir_index<Node>;
 		friend class Genode::List<Io_handle>;
 		friend class Genode::List<Io_handle>::Element;
 		friend class Genode::List<Watch_handle>;
@@ -182,45 +182,6 @@ class Vfs_ram::Node : private Genode::Avl_node<Node>, private Genode::Lock
 			Genode::error("Vfs_ram::Node::truncate() called");
 		}
 
-		/************************
-		 ** Avl node interface **
-		 ************************/
-
-		bool higher(Node *c) { return (strcmp(c->_name, _name) > 0); }
-
-		/**
-		 * Find index N by walking down the tree N times,
-		 * not the most efficient way to do this.
-		 */
-		Node *index(file_offset &i)
-		{
-			if (i-- == 0)
-				return this;
-
-			Node *n;
-
-			n = child(LEFT);
-			if (n)
-				n = n->index(i);
-
-			if (n) return n;
-
-			n = child(RIGHT);
-			if (n)
-				n = n->index(i);
-
-			return n;
-		}
-
-		Node *sibling(const char *name)
-		{
-			if (strcmp(name, _name) == 0) return this;
-
-			Node *c =
-				Avl_node<Node>::child(strcmp(name, _name) > 0);
-			return c ? c->sibling(name) : nullptr;
-		}
-
 		struct Guard
 		{
 			Node &node;
@@ -383,18 +344,17 @@ class Vfs_ram::Directory : public Vfs_ram::Node
 {
 	private:
 
-		Avl_tree<Node>  _entries { };
-		file_size       _count = 0;
+		File_system::Dir_index<Node> _entries;
 
 	public:
 
-		Directory(char const *name)
-		: Node(name) { }
+		Directory(char const *name, Allocator &alloc)
+		: Node(name), _entries(alloc) { }
 
 		void empty(Allocator &alloc)
 		{
 			while (Node *node = _entries.first()) {
-				_entries.remove(node);
+				_entries.remove(*node);
 				if (File *file = dynamic_cast<File*>(node)) {
 					if (file->opened())
 						continue;
@@ -405,25 +365,13 @@ class Vfs_ram::Directory : public Vfs_ram::Node
 			}
 		}
 
-		void adopt(Node *node)
-		{
-			_entries.insert(node);
-			++_count;
-		}
+		void adopt(Node *node) { _entries.insert(*node); }
 
-		Node *child(char const *name)
-		{
-			Node *node = _entries.first();
-			return node ? node->sibling(name) : nullptr;
-		}
+		Node *child(char const *name) { return _entries.lookup(name); }
 
-		void release(Node *node)
-		{
-			_entries.remove(node);
-			--_count;
-		}
+		void release(Node *node) { _entries.remove(*node); }
 
-		file_size length() override { return _count; }
+		file_size length() override { return _entries.count(); }
 
 		Vfs::File_io_service::Read_result complete_read(char *dst,
 		                                                file_size count,
@@ -441,8 +389,7 @@ class Vfs_ram::Directory : public Vfs_ram::Node
 			*dirent = Dirent();
 			out_count = sizeof(Dirent);
 
-			Node *node = _entries.first();
-			if (node) node = node->index(index);
+			Node *node = _entries.at(index);
 			if (!node) {
 				dirent->type = Directory_service::DIRENT_TYPE_END;
 				return Vfs::File_io_service::READ_OK;
@@ -481,7 +428,16 @@ class Vfs::Ram_file_system : public Vfs::File_system
 		friend class Genode::List<Vfs_ram::Watch_handle>;
 
 		Vfs::Env           &_env;
-		Vfs_ram::Directory  _root = { "" };
+		Vfs_ram::Directory  _root { "", _env.alloc() };
+
+		/*
+		 * Lock serializing the operations on the directory tree
+		 *
+		 * Operations on the content of a node are synchronized by the lock
+		 * of the node only, which is acquired after '_lock' if both are
+		 * needed.
+		 */
+		Genode::Lock _lock { };
 
 		Vfs_ram::Node *lookup(char const *path, bool return_parent = false)
 		{
@@ -556,6 +512,8 @@ class Vfs::Ram_file_system : public Vfs::File_system
 
 		file_size num_dirent(char const *path) override
 		{
+			Genode::Lock::Guard fs_guard(_lock);
+
 			using namespace Vfs_ram;
 
 			if (Node *node = lookup(path)) {
@@ -569,6 +527,8 @@ class Vfs::Ram_file_system : public Vfs::File_system
 
 		bool directory(char const *path) override
 		{
+			Genode::Lock::Guard fs_guard(_lock);
+
 			using namespace Vfs_ram;
 
 			Node *node = lookup(path);
@@ -577,13 +537,19 @@ class Vfs::Ram_file_system : public Vfs::File_system
 				: false;
 		}
 
-		char const *leaf_path(char const *path) override {
-			return lookup(path) ? path : nullptr; }
+		char const *leaf_path(char const *path) override
+		{
+			Genode::Lock::Guard fs_guard(_lock);
+
+			return lookup(path) ? path : nullptr;
+		}
 
 		Open_result open(char const  *path, unsigned mode,
 		                 Vfs_handle **handle,
 		                 Allocator   &alloc) override
 		{
+			Genode::Lock::Guard fs_guard(_lock);
+
 			using namespace Vfs_ram;
 
 			File *file;
@@ -634,6 +600,8 @@ class Vfs::Ram_file_system : public Vfs::File_system
 		                       Vfs_handle **handle,
 		                       Allocator   &alloc) override
 		{
+			Genode::Lock::Guard fs_guard(_lock);
+
 			using namespace Vfs_ram;
 
 			Directory *parent = lookup_parent(path);
@@ -654,7 +622,7 @@ class Vfs::Ram_file_system : public Vfs::File_system
 				if (parent->child(name))
 					return OPENDIR_ERR_NODE_ALREADY_EXISTS;
 
-				try { dir = new (_env.alloc()) Directory(name); }
+				try { dir = new (_env.alloc()) Directory(name, _env.alloc()); }
 				catch (Out_of_memory) { return OPENDIR_ERR_NO_SPACE; }
 
 				parent->adopt(dir);
@@ -690,6 +658,8 @@ class Vfs::Ram_file_system : public Vfs::File_system
 		Openlink_result openlink(char const *path, bool create,
 		                         Vfs_handle **handle, Allocator &alloc) override
 		{
+			Genode::Lock::Guard fs_guard(_lock);
+
 			using namespace Vfs_ram;
 
 			Directory *parent = lookup_parent(path);
@@ -747,6 +717,8 @@ class Vfs::Ram_file_system : public Vfs::File_system
 
 		void close(Vfs_handle *vfs_handle) override
 		{
+			Genode::Lock::Guard fs_guard(_lock);
+
 			Vfs_ram::Io_handle *ram_handle =
 				static_cast<Vfs_ram::Io_handle *>(vfs_handle);
 
@@ -765,6 +737,8 @@ class Vfs::Ram_file_system : public Vfs::File_system
 
 		Stat_result stat(char const *path, Stat &stat) override
 		{
+			Genode::Lock::Guard fs_guard(_lock);
+
 			using namespace Vfs_ram;
 
 			Node *node = lookup(path);
@@ -799,6 +773,8 @@ class Vfs::Ram_file_system : public Vfs::File_system
 
 		Rename_result rename(char const *from, char const *to) override
 		{
+			Genode::Lock::Guard fs_guard(_lock);
+
 			using namespace Vfs_ram;
 
 			if ((strcmp(from, to) == 0) && lookup(from))
@@ -855,6 +831,8 @@ class Vfs::Ram_file_system : public Vfs::File_system
 
 		Unlink_result unlink(char const *path) override
 		{
+			Genode::Lock::Guard fs_guard(_lock);
+
 			using namespace Vfs_ram;
 
 			Directory *parent = lookup_parent(path);
@@ -874,6 +852,8 @@ class Vfs::Ram_file_system : public Vfs::File_system
 
 		Dataspace_capability dataspace(char const *path) override
 		{
+			Genode::Lock::Guard fs_guard(_lock);
+
 			using namespace Vfs_ram;
 
 			Ram_dataspace_capability ds_cap;
@@ -912,6 +892,8 @@ class Vfs::Ram_file_system : public Vfs::File_system
 		                   Vfs_watch_handle **handle,
 		                   Allocator        &alloc) override
 		{
+			Genode::Lock::Guard fs_guard(_lock);
+
 			using namespace Vfs_ram;
 
 			Node *node = lookup(path);
@@ -931,6 +913,8 @@ class Vfs::Ram_file_system : public Vfs::File_system
 
 		void close(Vfs_watch_handle *vfs_handle) override
 		{
+			Genode::Lock::Guard fs_guard(_lock);
+
 			Vfs_ram::Watch_handle *watch_handle =
 				static_cast<Vfs_ram::Watch_handle *>(vfs_handle);
 			watch_handle->node.close(*watch_handle);
@@ -993,6 +977,8 @@ class Vfs::Ram_file_system : public Vfs::File_system
 		 */
 		Sync_result complete_sync(Vfs_handle *vfs_handle) override
 		{
+			Genode::Lock::Guard fs_guard(_lock);
+
 			Vfs_ram::Io_handle *handle =
 				static_cast<Vfs_ram::Io_handle *>(vfs_handle);
 			if (handle->modifying) {
@@ -1010,6 +996,8 @@ class Vfs::Ram_file_system : public Vfs::File_system
 
 		static char const *name()   { return "ram"; }
 		char const *type() override { return "ram"; }
+
+		bool thread_safe() override { return true; }
 };
 
 #endif /* _INCLUDE__VFS__RAM_FILE_SYSTEM_H_ */
@@ -30,6 +30,8 @@ struct Vfs::Zero_file_system : Single_file_system
 	static char const *name()   { return "zero"; }
 	char const *type() override { return "zero"; }
 
+	bool thread_safe() override { return true; }
+
 	struct Zero_vfs_handle : Single_vfs_handle
 	{
 		Zero_vfs_handle(Directory_service &ds,
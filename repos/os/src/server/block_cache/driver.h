@@ -12,9 +12,13 @@
  */
 
 #include <base/log.h>
+#include <base/attached_rom_dataspace.h>
 #include <block_session/connection.h>
 #include <block/component.h>
 #include <os/packet_allocator.h>
+#include <os/reporter.h>
+#include <timer_session/connection.h>
+#include <util/reconstructible.h>
 
 #include "chunk.h"
 
@@ -88,18 +92,29 @@ class Driver : public Block::Driver
 		};
 
 
+	public:
+
 		/*
 		 * The given policy class is extended by a synchronization routine,
-		 * used by the cache chunk structure
+		 * used by the cache chunk structure, and a routine that completes
+		 * a sequence of synchronized chunks
 		 */
 		struct Policy : POLICY {
-			static void sync(const typename POLICY::Element *e, char *src); };
-
-	public:
+			static void sync(const typename POLICY::Element *e, char *src);
+			static void sync_complete(); };
 
 		enum {
 			SLAB_SZ = Block::Session::TX_QUEUE_SIZE*sizeof(Request),
-			CACHE_BLK_SIZE = 4096
+			CACHE_BLK_SIZE = 4096,
+
+			/* maximum read-ahead window in cache blocks */
+			MAX_READ_AHEAD = 32,
+
+			/* maximum number of adjacent dirty chunks per back-end write */
+			MAX_WRITE_RUN = 32,
+
+			/* amount of written cache blocks that triggers a write-back */
+			WRITE_BACK_THRESHOLD = 64,
 		};
 
 		/**
@@ -125,6 +140,50 @@ class Driver : public Block::Driver
 		Genode::Io_signal_handler<Driver> _source_submit;
 		Genode::Io_signal_handler<Driver> _yield;
 
+		/*
+		 * Sequential-stream detection for read-ahead
+		 *
+		 * A miss at the block that follows the previous read-ahead doubles
+		 * the read-ahead window, any other miss resets it.
+		 */
+		Block::sector_t _ra_next   { 0 }; /* block following last read-ahead */
+		unsigned        _ra_window { 1 }; /* read-ahead window in cache blocks */
+
+		/*
+		 * Adjacent dirty chunks are collected in one back-end packet
+		 */
+		struct Write_run
+		{
+			Block::Packet_descriptor packet; /* allocated back-end packet */
+			Cache::offset_t          off;    /* device offset of first chunk */
+			Cache::size_t            used;   /* bytes collected so far */
+		};
+
+		Genode::Constructible<Write_run> _write_run { };
+
+		Cache::size_t   _written           { 0 };     /* bytes since write-back */
+		bool            _write_back_needed { false }; /* resume write-back */
+		Cache::offset_t _write_back_off    { 0 };
+
+		struct Statistics
+		{
+			Genode::uint64_t read_hits;
+			Genode::uint64_t read_misses;
+			Genode::uint64_t read_bytes;
+			Genode::uint64_t write_bytes;
+			Genode::uint64_t backend_read_bytes;
+			Genode::uint64_t backend_write_bytes;
+		};
+
+		Statistics _stats      { };
+		Statistics _stats_last { };
+
+		Genode::Constructible<Timer::Connection> _timer    { };
+		Genode::Constructible<Genode::Reporter>  _reporter { };
+		unsigned long                            _report_interval_ms { 0 };
+
+		Genode::Signal_handler<Driver> _report_handler;
+
 		Driver(Driver const&);            /* singleton pattern */
 		Driver& operator=(Driver const&); /* singleton pattern */
 
@@ -157,8 +216,8 @@ class Driver : public Block::Driver
 		{
 			try {
 			if (r->cli.operation() == Block::Packet_descriptor::READ)
-				read(r->cli.block_number(), r->cli.block_count(),
-				     r->buffer, r->cli);
+				_read(r->cli.block_number(), r->cli.block_count(),
+				      r->buffer, r->cli);
 			else
 				write(r->cli.block_number(), r->cli.block_count(),
 				      r->buffer, r->cli);
@@ -179,10 +238,12 @@ class Driver : public Block::Driver
 				Block::Packet_descriptor p = _blk.tx()->get_acked_packet();
 
 				/* when reading, write result into cache */
-				if (p.operation() == Block::Packet_descriptor::READ)
+				if (p.operation() == Block::Packet_descriptor::READ) {
 					_cache.write(_blk.tx()->packet_content(p),
 					             p.block_count() * _info.block_size,
 					             p.block_number() * _info.block_size);
+					_stats.backend_read_bytes += p.block_count() * _info.block_size;
+				}
 
 				/* loop through the list of requests, and ack all related */
 				for (Request *r = _r_list.first(), *r_to_handle = r; r;
@@ -197,12 +258,52 @@ class Driver : public Block::Driver
 
 				_blk.tx()->release_packet(p);
 			}
+
+			if (_write_back_needed)
+				_write_back();
 		}
 
 		/*
 		 * Handle that the backend device is ready to receive again
 		 */
-		void _ready_to_submit() { }
+		void _ready_to_submit()
+		{
+			if (_write_back_needed)
+				_write_back();
+		}
+
+		/*
+		 * Determine size of the back-end read request for a cache miss
+		 *
+		 * \param nr   first block of the miss, aligned to cache blocks
+		 * \param cnt  number of blocks of the miss, aligned to cache blocks
+		 *
+		 * \return number of blocks to read including read-ahead
+		 */
+		Genode::size_t _read_ahead(Block::sector_t nr, Genode::size_t cnt)
+		{
+			_ra_window = (nr == _ra_next)
+			           ? Genode::min(_ra_window * 2, (unsigned)MAX_READ_AHEAD)
+			           : 1;
+
+			Genode::size_t const mod = _cache_blk_mod();
+
+			Genode::size_t max_cnt = Genode::max(cnt, (Genode::size_t)_ra_window * mod);
+			if (nr + max_cnt > _info.block_count)
+				max_cnt = _info.block_count - nr;
+
+			/* extend the request as long as the following chunks are missing */
+			while (cnt + mod <= max_cnt) {
+				try {
+					_cache.stat(CACHE_BLK_SIZE, (nr + cnt) * _info.block_size);
+					break;
+				} catch (Cache::Chunk_base::Range_incomplete) {
+					cnt += mod; }
+			}
+
+			_ra_next = nr + cnt;
+			return cnt;
+		}
 
 		/*
 		 * Setup a request to the backend device
@@ -234,19 +335,35 @@ class Driver : public Block::Driver
 					throw Request_congestion();
 				}
 
-				/* read ahead CACHE_BLK_SIZE */
+				/* read ahead at least CACHE_BLK_SIZE */
 				Block::sector_t nr = _cache_blk_round_off(block_number);
 				Genode::size_t cnt = _cache_blk_round_up(block_count +
 				                                         (block_number - nr));
+				Genode::size_t const min_cnt = cnt;
+
+				cnt = _read_ahead(nr, cnt);
+
+				/* fall back to the plain miss if the buffer is fragmented */
+				Block::Packet_descriptor buf;
+				try { buf = _blk.alloc_packet(_info.block_size*cnt); }
+				catch (Block::Session::Tx::Source::Packet_alloc_failed) {
+					cnt = min_cnt;
+					_ra_next = nr + cnt;
+					buf = _blk.alloc_packet(_info.block_size*cnt);
+				}
+				p_to_dev = buf;
 
-				/* ensure all memory is available before sending the request */
+				/*
+				 * Ensure all memory is available before sending the request.
+				 * Chunks are allocated only for the blocks that are actually
+				 * read, so no unfilled read-ahead chunk remains in the cache.
+				 */
 				_cache.alloc(cnt * _info.block_size, nr * _info.block_size);
 
 				/* construct and send the packet */
-				p_to_dev =
-					Block::Packet_descriptor(_blk.alloc_packet(_info.block_size*cnt),
-					                         Block::Packet_descriptor::READ,
-					                         nr, cnt);
+				p_to_dev = Block::Packet_descriptor(buf,
+				                                    Block::Packet_descriptor::READ,
+				                                    nr, cnt);
 				_r_list.insert(new (&_r_slab) Request(p_to_dev, packet, buffer));
 				_blk.tx()->submit_packet(p_to_dev);
 			} catch(Block::Session::Tx::Source::Packet_alloc_failed) {
@@ -258,6 +375,92 @@ class Driver : public Block::Driver
 			}
 		}
 
+		/*
+		 * Add dirty chunk to the pending back-end write
+		 *
+		 * \param off  device offset of the chunk
+		 * \param src  chunk content
+		 *
+		 * \throw Write_failed
+		 */
+		void _sync_chunk(Cache::offset_t off, char const *src)
+		{
+			if (_write_run.constructed()) {
+				Write_run &run = *_write_run;
+
+				if (off == run.off + run.used && run.used < run.packet.size()) {
+					Genode::memcpy(_blk.tx()->packet_content(run.packet) + run.used,
+					               src, CACHE_BLK_SIZE);
+					run.used += CACHE_BLK_SIZE;
+					return;
+				}
+				_submit_write_run();
+			}
+
+			if (!_blk.tx()->ready_to_submit())
+				throw Write_failed(off);
+
+			Block::Packet_descriptor p;
+			try { p = _blk.alloc_packet(MAX_WRITE_RUN*CACHE_BLK_SIZE); }
+			catch (Block::Session::Tx::Source::Packet_alloc_failed) {
+				try { p = _blk.alloc_packet(CACHE_BLK_SIZE); }
+				catch (Block::Session::Tx::Source::Packet_alloc_failed) {
+					throw Write_failed(off); }
+			}
+
+			Genode::memcpy(_blk.tx()->packet_content(p), src, CACHE_BLK_SIZE);
+			_write_run.construct(Write_run { p, off, CACHE_BLK_SIZE });
+		}
+
+		/*
+		 * Submit pending back-end write of adjacent dirty chunks
+		 */
+		void _submit_write_run()
+		{
+			if (!_write_run.constructed())
+				return;
+
+			Write_run const &run = *_write_run;
+
+			/* return unused part of the packet to the allocator */
+			if (run.used < run.packet.size())
+				_blk.tx()->release_packet(
+					Block::Packet_descriptor(run.packet.offset() + run.used,
+					                         run.packet.size() - run.used));
+
+			Block::Packet_descriptor const
+				p(Block::Packet_descriptor(run.packet.offset(), run.used),
+				  Block::Packet_descriptor::WRITE, run.off / _info.block_size,
+				  run.used / _info.block_size);
+
+			_blk.tx()->submit_packet(p);
+			_stats.backend_write_bytes += run.used;
+
+			_write_run.destruct();
+		}
+
+		/*
+		 * Write back dirty chunks in the background
+		 *
+		 * In contrast to '_sync', the write-back never blocks. If the
+		 * backend device is congested, it is resumed at the same offset
+		 * as soon as the backend device makes progress.
+		 */
+		void _write_back()
+		{
+			Cache::size_t const dev_size = _info.block_size * _info.block_count;
+
+			try {
+				_cache.sync(dev_size - _write_back_off, _write_back_off);
+				_write_back_needed = false;
+				_write_back_off    = 0;
+			} catch (Write_failed &e) {
+				_write_back_needed = true;
+				_write_back_off    = e.off;
+			}
+			_submit_write_run();
+		}
+
 		/*
 		 * Synchronize dirty chunks with backend device
 		 */
@@ -275,11 +478,83 @@ class Driver : public Block::Driver
 					 * Write to backend failed when backend device isn't ready
 					 * to proceed, so handle signals, until it's ready again
 					 */
+					_submit_write_run();
 					off = e.off;
 					len = _info.block_size * _info.block_count - off;
 					_env.ep().wait_and_dispatch_one_io_signal();
 				}
 			}
+			_submit_write_run();
+
+			_write_back_needed = false;
+			_write_back_off    = 0;
+		}
+
+		/*
+		 * Generate statistics report
+		 */
+		void _report()
+		{
+			using namespace Genode;
+
+			auto rate = [&] (uint64_t now, uint64_t last) {
+				return (now - last) * 1000 / _report_interval_ms / 1024; };
+
+			uint64_t const reads = _stats.read_hits + _stats.read_misses;
+
+			try {
+				Reporter::Xml_generator xml(*_reporter, [&] () {
+					xml.node("read", [&] () {
+						xml.attribute("hits",      _stats.read_hits);
+						xml.attribute("misses",    _stats.read_misses);
+						xml.attribute("hit_ratio", reads ? _stats.read_hits * 100 / reads : 0);
+						xml.attribute("bytes",     _stats.read_bytes);
+						xml.attribute("kib_per_sec",
+						              rate(_stats.read_bytes, _stats_last.read_bytes));
+					});
+					xml.node("write", [&] () {
+						xml.attribute("bytes", _stats.write_bytes);
+						xml.attribute("kib_per_sec",
+						              rate(_stats.write_bytes, _stats_last.write_bytes));
+					});
+					xml.node("backend", [&] () {
+						xml.attribute("read_bytes",  _stats.backend_read_bytes);
+						xml.attribute("write_bytes", _stats.backend_write_bytes);
+						xml.attribute("read_kib_per_sec",
+						              rate(_stats.backend_read_bytes,
+						                   _stats_last.backend_read_bytes));
+						xml.attribute("write_kib_per_sec",
+						              rate(_stats.backend_write_bytes,
+						                   _stats_last.backend_write_bytes));
+					});
+				});
+			} catch (...) { warning("could not report statistics"); }
+
+			_stats_last = _stats;
+		}
+
+		/*
+		 * Enable statistics report if configured
+		 *
+		 * ! <config> <report interval_ms="1000"/> </config>
+		 */
+		void _configure_report()
+		{
+			using namespace Genode;
+
+			try {
+				Attached_rom_dataspace config(_env, "config");
+				Xml_node const report = config.xml().sub_node("report");
+
+				_report_interval_ms = max(report.attribute_value("interval_ms", 1000UL), 10UL);
+			} catch (...) { return; }
+
+			_reporter.construct(_env, "statistics");
+			_reporter->enabled(true);
+
+			_timer.construct(_env);
+			_timer->sigh(_report_handler);
+			_timer->trigger_periodic(_report_interval_ms * 1000);
 		}
 
 		/*
@@ -307,6 +582,35 @@ class Driver : public Block::Driver
 			return false;
 		}
 
+		/*
+		 * Copy blocks known to be cached to the client
+		 */
+		void _read_cached(Block::sector_t           block_number,
+		                  Genode::size_t            block_count,
+		                  char*                     buffer,
+		                  Block::Packet_descriptor &packet)
+		{
+			_cache.read(buffer,
+			            block_count *_info.block_size,
+			            block_number*_info.block_size);
+
+			_stats.read_bytes += block_count * _info.block_size;
+
+			ack_packet(packet);
+		}
+
+		/*
+		 * Read cached blocks or request missing ones from the backend device
+		 */
+		void _read(Block::sector_t           block_number,
+		           Genode::size_t            block_count,
+		           char*                     buffer,
+		           Block::Packet_descriptor &packet)
+		{
+			if (_stat(block_number, block_count, buffer, packet))
+				_read_cached(block_number, block_count, buffer, packet);
+		}
+
 		/*
 		 * Signal handler for yield requests of the parent
 		 */
@@ -340,7 +644,8 @@ class Driver : public Block::Driver
 		  _cache(heap, 0),
 		  _source_ack(env.ep(), *this, &Driver::_ack_avail),
 		  _source_submit(env.ep(), *this, &Driver::_ready_to_submit),
-		  _yield(env.ep(), *this, &Driver::_parent_yield)
+		  _yield(env.ep(), *this, &Driver::_parent_yield),
+		  _report_handler(env.ep(), *this, &Driver::_report)
 		{
 			using namespace Genode;
 
@@ -356,6 +661,8 @@ class Driver : public Block::Driver
 
 			/* truncate chunk structure to real size of the device */
 			_cache.truncate(_info.block_size * _info.block_count);
+
+			_configure_report();
 		}
 
 		~Driver()
@@ -380,14 +687,13 @@ class Driver : public Block::Driver
 		          char*                     buffer,
 		          Block::Packet_descriptor &packet)
 		{
-			if (!_stat(block_number, block_count, buffer, packet))
+			if (!_stat(block_number, block_count, buffer, packet)) {
+				_stats.read_misses++;
 				return;
+			}
 
-			_cache.read(buffer,
-			            block_count *_info.block_size,
-			            block_number*_info.block_size);
-
-			ack_packet(packet);
+			_stats.read_hits++;
+			_read_cached(block_number, block_count, buffer, packet);
 		}
 
 		void write(Block::sector_t           block_number,
@@ -415,6 +721,15 @@ class Driver : public Block::Driver
 			             block_number * _info.block_size);
 
 			ack_packet(packet);
+
+			_stats.write_bytes += block_count * _info.block_size;
+
+			/* start write-back early to avoid syncing during eviction */
+			_written += block_count * _info.block_size;
+			if (_written >= WRITE_BACK_THRESHOLD*CACHE_BLK_SIZE && !_write_back_needed) {
+				_written = 0;
+				_write_back();
+			}
 		}
 
 		void sync() { _sync(); }
@@ -16,47 +16,137 @@
 
 typedef Driver<Lru_policy>::Chunk_level_4 Chunk;
 
-static const Lru_policy::Element        *lru = 0;
-static Genode::List<Lru_policy::Element> lru_list;
 
-
-static void lru_access(const Lru_policy::Element *e)
+/**
+ * Doubly-linked queue of chunks, the head is the least recently used one
+ */
+class Lru_policy::Queue
 {
-	if (e == lru) return;
+	private:
 
-	if (e->next()) lru_list.remove(e);
+		Element const *_head  = nullptr;
+		Element const *_tail  = nullptr;
+		Cache::size_t  _count = 0;
 
-	lru_list.insert(e, lru);
-	lru = e;
-}
+	public:
+
+		Element::Segment const segment;
+
+		Queue(Element::Segment segment) : segment(segment) { }
+
+		Element const *head()  const { return _head;  }
+		Cache::size_t  count() const { return _count; }
+
+		void remove(Element const *e)
+		{
+			if (e->_lru_prev) e->_lru_prev->_lru_next = e->_lru_next;
+			else              _head = e->_lru_next;
+
+			if (e->_lru_next) e->_lru_next->_lru_prev = e->_lru_prev;
+			else              _tail = e->_lru_prev;
+
+			e->_lru_prev = e->_lru_next = nullptr;
+			e->_lru_segment = Element::NONE;
+			_count--;
+		}
+
+		void append(Element const *e)
+		{
+			e->_lru_prev = _tail;
+			e->_lru_next = nullptr;
+			if (_tail) _tail->_lru_next = e;
+			else       _head = e;
+			_tail = e;
+			e->_lru_segment = segment;
+			_count++;
+		}
+
+		void prepend(Element const *e)
+		{
+			e->_lru_prev = nullptr;
+			e->_lru_next = _head;
+			if (_head) _head->_lru_prev = e;
+			else       _tail = e;
+			_head = e;
+			e->_lru_segment = segment;
+			_count++;
+		}
+};
 
 
-void Lru_policy::read(const Lru_policy::Element  *e) {
-	lru_access(e); }
+static Lru_policy::Queue probation { Lru_policy::Element::PROBATION };
+static Lru_policy::Queue protect   { Lru_policy::Element::PROTECTED };
+
+/*
+ * A chunk gets promoted to the protected segment once it was accessed
+ * this many times after it has been filled
+ */
+enum { PROMOTION_HITS = 2 };
+
+
+void Lru_policy::read(const Lru_policy::Element *e)
+{
+	switch (e->_lru_segment) {
+
+	case Element::NONE:
+		e->_lru_hits = 0;
+		probation.append(e);
+		return;
+
+	case Element::PROBATION:
+		if (++e->_lru_hits < PROMOTION_HITS)
+			return;
+		probation.remove(e);
+		protect.append(e);
+		return;
+
+	case Element::PROTECTED:
+		protect.remove(e);
+		protect.append(e);
+		return;
+	}
+}
 
 
 void Lru_policy::write(const Lru_policy::Element *e) {
-	lru_access(e); }
+	read(e); }
 
 
 void Lru_policy::flush(Cache::size_t size)
 {
 	Cache::size_t s = 0;
-	for (Lru_policy::Element *e = lru_list.first();
-		 e && ((size == 0) || (s < size));
-		 e = lru_list.first(), s += sizeof(Chunk)) {
-		Chunk *cb = static_cast<Chunk*>(e);
-		e = e->next();
+
+	while ((size == 0) || (s < size)) {
+
+		/*
+		 * Evict from the probationary segment as long as it holds at least
+		 * a quarter of all chunks, which keeps chunks touched only once from
+		 * displacing frequently used ones.
+		 */
+		bool const use_probation = probation.count() &&
+			(!protect.count() ||
+			 probation.count()*4 >= probation.count() + protect.count());
+
+		Queue &queue = use_probation ? probation : protect;
+
+		Element const *e = queue.head();
+		if (!e) break;
+
+		Chunk *cb = static_cast<Chunk*>(const_cast<Element *>(e));
+		queue.remove(e);
 		try {
 			cb->free(Driver<Lru_policy>::CACHE_BLK_SIZE,
 			         cb->base_offset());
-			lru_list.remove(cb);
+			s += sizeof(Chunk);
 		} catch(Chunk::Dirty_chunk &e) {
+
+			/* write back and keep the chunk as next candidate */
+			queue.prepend(cb);
 			cb->sync(e.size, e.off);
 		}
 	}
 
-	if (!lru_list.first()) lru = 0;
+	Driver<Lru_policy>::Policy::sync_complete();
 
 	if (s < size) throw Block::Driver::Request_congestion();
 }
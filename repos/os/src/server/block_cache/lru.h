@@ -2,6 +2,12 @@
  * \brief  Least-recently-used cache replacement strategy
  * \author Stefan Kalkowski
  * \date   2013-12-05
+ *
+ * The policy implements a segmented LRU. Chunks enter a probationary
+ * segment when they are filled and are promoted to a protected segment
+ * only if they are accessed repeatedly. Chunks that are touched once,
+ * e.g., by a sequential scan or read-ahead, are evicted first and thereby
+ * cannot displace the working set held in the protected segment.
  */
 
 /*
@@ -11,13 +17,33 @@
  * under the terms of the GNU Affero General Public License version 3.
  */
 
-#include <util/list.h>
-
 #include "chunk.h"
 
 struct Lru_policy
 {
-	class Element : public Genode::List<Element>::Element {};
+	class Queue;
+
+	class Element
+	{
+		public:
+
+			enum Segment { NONE, PROBATION, PROTECTED };
+
+		private:
+
+			friend class Queue;
+			friend struct Lru_policy;
+
+			/*
+			 * The policy is informed about accesses via const pointers
+			 * because reading a chunk does not modify it. The queue
+			 * linkage is bookkeeping of the policy only.
+			 */
+			mutable Element const *_lru_prev    = nullptr;
+			mutable Element const *_lru_next    = nullptr;
+			mutable Segment        _lru_segment = NONE;
+			mutable unsigned       _lru_hits    = 0;
+	};
 
 	static void read(const Element  *e);
 	static void write(const Element *e);
@@ -24,27 +24,31 @@ static Driver<Policy> * driver = nullptr;
  * Synchronize a chunk with the backend device
  */
 template <typename POLICY>
-void Driver<POLICY>::Policy::sync(const typename POLICY::Element *e, char *dst)
+void Driver<POLICY>::Policy::sync(const typename POLICY::Element *e, char *src)
 {
 	Cache::offset_t off =
 		static_cast<const Driver<POLICY>::Chunk_level_4*>(e)->base_offset();
 
 	if (!driver) throw Write_failed(off);
 
-	if (!driver->blk()->tx()->ready_to_submit())
-		throw Write_failed(off);
-	try {
-		Block::Packet_descriptor
-			p(driver->blk()->alloc_packet(Driver::CACHE_BLK_SIZE),
-		      Block::Packet_descriptor::WRITE, off / driver->blk_sz(),
-		      Driver::CACHE_BLK_SIZE / driver->blk_sz());
-		driver->blk()->tx()->submit_packet(p);
-	} catch(Block::Session::Tx::Source::Packet_alloc_failed) {
-		throw Write_failed(off);
-	}
+	driver->_sync_chunk(off, src);
+}
+
+
+/**
+ * Submit chunks collected by 'sync' to the backend device
+ */
+template <typename POLICY>
+void Driver<POLICY>::Policy::sync_complete()
+{
+	if (driver) driver->_submit_write_run();
 }
 
 
+/* used by the replacement policy, which is compiled separately */
+template void Driver<Policy>::Policy::sync_complete();
+
+
 struct Main
 {
 	template <typename T>
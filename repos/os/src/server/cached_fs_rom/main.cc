@@ -18,6 +18,7 @@
 #include <rom_session/rom_session.h>
 #include <region_map/client.h>
 #include <rm_session/connection.h>
+#include <dataspace/client.h>
 #include <base/attached_ram_dataspace.h>
 #include <base/session_label.h>
 #include <base/heap.h>
@@ -57,23 +58,44 @@ struct Cached_fs_rom::Cached_rom final
 	Cached_rom(Cached_rom const &);
 	Cached_rom &operator = (Cached_rom const &);
 
+	/**
+	 * File content provided as dataspace by the file-system server
+	 *
+	 * The file handle stays open for the lifetime of the cache entry
+	 * because the server frees the dataspace when the handle is closed.
+	 */
+	struct Mapping
+	{
+		File_system::Session    *fs;
+		File_system::File_handle handle;
+		Dataspace_capability     ds;
+	};
+
 	Genode::Env   &env;
 	Rm_connection &rm_connection;
 
-	size_t const file_size;
+	size_t  const file_size;
+	Mapping const mapping;
 
 	/**
-	 * Backing RAM dataspace
+	 * Backing RAM dataspace, unused if the file content is mapped
 	 *
 	 * This shall be valid even if the file is empty.
 	 */
 	Attached_ram_dataspace ram_ds {
-		env.pd(), env.rm(), file_size ? file_size : 1 };
+		env.pd(), env.rm(), mapping.ds.valid() ? 0 : (file_size ? file_size : 1) };
+
+	Dataspace_capability backing_ds() const {
+		return mapping.ds.valid() ? mapping.ds : Dataspace_capability(ram_ds.cap()); }
+
+	size_t backing_size() const {
+		return mapping.ds.valid() ? Dataspace_client(mapping.ds).size()
+		                          : ram_ds.size(); }
 
 	/**
 	 * Read-only region map exposed as ROM module to the client
 	 */
-	Region_map_client      rm { rm_connection.create(ram_ds.size()) };
+	Region_map_client      rm { rm_connection.create(backing_size()) };
 	Region_map::Local_addr rm_attachment { };
 	Dataspace_capability   rm_ds { };
 
@@ -88,17 +110,25 @@ struct Cached_fs_rom::Cached_rom final
 	 */
 	int _ref_count = 0;
 
+	/**
+	 * Constructor
+	 *
+	 * \param mapping  file content provided by the file-system server,
+	 *                 if invalid, the content is filled in by a 'Transfer'
+	 */
 	Cached_rom(Cache_space   &cache_space,
 	           Env           &env,
 	           Rm_connection &rm,
 	           Path const    &file_path,
-	           size_t         size)
+	           size_t         size,
+	           Mapping const &mapping = Mapping { nullptr, File_system::File_handle { ~0UL },
+	                                             Dataspace_capability() })
 	:
-		env(env), rm_connection(rm), file_size(size),
+		env(env), rm_connection(rm), file_size(size), mapping(mapping),
 		path(file_path),
 		cache_elem(*this, cache_space)
 	{
-		if (size == 0)
+		if (size == 0 || mapping.ds.valid())
 			complete();
 	}
 
@@ -109,6 +139,9 @@ struct Cached_fs_rom::Cached_rom final
 	{
 		if (rm_attachment)
 			rm.detach(rm_attachment);
+
+		if (mapping.fs)
+			mapping.fs->close(mapping.handle);
 	}
 
 	bool completed() const { return rm_ds.valid(); }
@@ -119,7 +152,7 @@ struct Cached_fs_rom::Cached_rom final
 		/* attach dataspace read-only into region map */
 		enum { OFFSET = 0, LOCAL_ADDR = false, EXEC = true, WRITE = false };
 		rm_attachment = rm.attach(
-			ram_ds.cap(), ram_ds.size(), OFFSET,
+			backing_ds(), backing_size(), OFFSET,
 			LOCAL_ADDR, (addr_t)~0, EXEC, WRITE);
 		rm_ds = rm.dataspace();
 	}
@@ -322,6 +355,17 @@ struct Cached_fs_rom::Main final : Genode::Session_request_handler
 			File_system::READ_ONLY, false);
 	}
 
+	/**
+	 * Request file content as dataspace from the file-system server
+	 *
+	 * \return invalid capability if the server does not support it
+	 */
+	Dataspace_capability try_map(File_system::File_handle handle)
+	{
+		try { return fs.dataspace(handle); }
+		catch (...) { return Dataspace_capability(); }
+	}
+
 	/**
 	 * Open a file with some exception management
 	 */
@@ -379,15 +423,35 @@ struct Cached_fs_rom::Main final : Genode::Session_request_handler
 
 		if (!rom) {
 			File_system::File_handle handle = try_open(path);
-			File_system::Handle_guard guard(fs, handle);
-			size_t file_size = fs.status(handle).size;
 
-			while (env.pd().avail_ram().value < file_size || env.pd().avail_caps().value < 8) {
-				/* drop unused cache entries */
-				if (!cache_evict()) break;
+			size_t               file_size = 0;
+			Dataspace_capability mapped_ds { };
+
+			try {
+				file_size = fs.status(handle).size;
+				mapped_ds = try_map(handle);
 			}
+			catch (...) { fs.close(handle); throw; }
+
+			if (mapped_ds.valid()) {
 
-			rom = new (heap) Cached_rom(cache, env, rm, path, file_size);
+				/* the cache entry takes over the file handle */
+				try {
+					rom = new (heap)
+						Cached_rom(cache, env, rm, path, file_size,
+						           Cached_rom::Mapping { &fs, handle, mapped_ds });
+				}
+				catch (...) { fs.close(handle); throw; }
+			} else {
+				File_system::Handle_guard guard(fs, handle);
+
+				while (env.pd().avail_ram().value < file_size || env.pd().avail_caps().value < 8) {
+					/* drop unused cache entries */
+					if (!cache_evict()) break;
+				}
+
+				rom = new (heap) Cached_rom(cache, env, rm, path, file_size);
+			}
 		}
 
 		if (rom->completed()) {
@@ -0,0 +1,495 @@
+/*
+ * \brief  Buffered writer of log files
+ * \author agent
+ * \date   2026-10-19
+ *
+ * Log messages are accumulated in large packets of the packet stream of the
+ * file-system session. A packet is submitted as soon as it is full, when a
+ * flush is due, or - if no flush period is configured - whenever the packet
+ * stream has an unused slot. The file system acknowledges the packets
+ * asynchronously. Writing a log message never waits for acknowledgements.
+ * If no packet is available for a message, the message is dropped and the
+ * number of dropped messages is reported once packets become available
+ * again. Packets that cannot be submitted right away, the rotation of a
+ * file, and the final sync of a closed file are resumed by the handler of
+ * acknowledgements.
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+#ifndef _FS_LOG__LOG_FILE_H_
+#define _FS_LOG__LOG_FILE_H_
+
+/* Genode includes */
+#include <file_system_session/connection.h>
+#include <file_system/util.h>
+#include <timer_session/connection.h>
+#include <util/list.h>
+#include <util/noncopyable.h>
+#include <base/allocator.h>
+#include <base/log.h>
+#include <os/path.h>
+
+namespace Fs_log {
+
+	using namespace Genode;
+
+	typedef Genode::Path<File_system::MAX_PATH_LEN>   Path;
+	typedef Genode::String<File_system::MAX_NAME_LEN> Name;
+
+	class Log_file;
+	class Writer;
+}
+
+
+class Fs_log::Log_file : Noncopyable, public List<Log_file>::Element
+{
+	private:
+
+		friend class Writer;
+
+		Path const _dir_path;
+		Name const _name;
+
+		File_system::File_handle _handle;
+
+		/* packet that is currently filled with log messages */
+		File_system::Packet_descriptor _packet { };
+		size_t                         _fill   { 0 };
+
+		/* file size including the content of submitted packets */
+		File_system::file_size_t _size;
+
+		unsigned _in_flight      = 0;
+		unsigned _users          = 1;
+		bool     _closing        = false;
+		bool     _sync_pending   = false;
+		bool     _closed         = false;
+		bool     _rotatable      = true;
+		bool     _rotate_pending = false;
+
+		bool _matches(Path const &dir_path, Name const &name) const {
+			return !_closing && _dir_path == dir_path.base() && _name == name; }
+
+	public:
+
+		Log_file(Path const &dir_path, Name const &name,
+		         File_system::File_handle handle, File_system::file_size_t size)
+		:
+			_dir_path(dir_path), _name(name), _handle(handle), _size(size)
+		{ }
+};
+
+
+class Fs_log::Writer : Noncopyable
+{
+	public:
+
+		struct Attr
+		{
+			size_t   packet_size;   /* size of a bulk-buffer packet */
+			unsigned packets;       /* number of bulk-buffer packets */
+			unsigned flush_ms;      /* flush period, 0 for write-behind */
+			size_t   rotate;        /* file-size threshold for rotation */
+			unsigned keep;          /* number of rotated files to keep */
+
+			enum { MIN_PACKET_SIZE = 4096 };
+
+			static Attr from_xml(Xml_node config)
+			{
+				enum { MAX_PACKETS = File_system::Session::TX_QUEUE_SIZE };
+
+				Number_of_bytes const packet_size =
+					config.attribute_value("buffer", Number_of_bytes(16*1024));
+
+				unsigned const packets =
+					config.attribute_value("packets", (unsigned)8);
+
+				return Attr {
+					.packet_size = max((size_t)packet_size, (size_t)MIN_PACKET_SIZE),
+					.packets     = max(1U, min(packets, (unsigned)MAX_PACKETS)),
+					.flush_ms    = config.attribute_value("flush_ms", 0U),
+					.rotate      = config.attribute_value("rotate", Number_of_bytes(0)),
+					.keep        = max(1U, config.attribute_value("keep", 1U)) };
+			}
+
+			size_t tx_buf_size() const { return packet_size*packets; }
+		};
+
+	private:
+
+		typedef File_system::Packet_descriptor Packet_descriptor;
+
+		enum { MAX_IN_FLIGHT = File_system::Session::TX_QUEUE_SIZE };
+
+		Env                              &_env;
+		Allocator                        &_alloc;
+		File_system::Connection          &_fs;
+		File_system::Session::Tx::Source &_source = *_fs.tx();
+		Attr const                        _attr;
+
+		List<Log_file> _files { };
+
+		/* number of packets submitted but not acknowledged yet */
+		unsigned _in_flight = 0;
+
+		Constructible<Timer::Connection> _timer { };
+
+		bool _flush_pending = false;
+
+		/* set if a packet could not be submitted, retried on ack */
+		bool _flush_blocked = false;
+
+		/* number of log messages dropped for the lack of packets */
+		unsigned long _dropped = 0;
+
+		Signal_handler<Writer> _ack_handler {
+			_env.ep(), *this, &Writer::_handle_ack };
+
+		Signal_handler<Writer> _timeout_handler {
+			_env.ep(), *this, &Writer::_handle_timeout };
+
+		Log_file *_file_by_handle(File_system::Node_handle handle)
+		{
+			for (Log_file *file = _files.first(); file; file = file->next())
+				if (!file->_closed && file->_handle == handle)
+					return file;
+
+			return nullptr;
+		}
+
+		template <typename FN>
+		void _for_each_file(FN const &fn)
+		{
+			for (Log_file *file = _files.first(); file; file = file->next())
+				if (!file->_closed)
+					fn(*file);
+		}
+
+		/**
+		 * Destroy files that were synced and closed
+		 *
+		 * The destruction is deferred to points where no file is referenced
+		 * by an ongoing operation.
+		 */
+		void _destroy_closed_files()
+		{
+			for (Log_file *file = _files.first(); file; ) {
+				Log_file *next = file->next();
+				if (file->_closed) {
+					_files.remove(file);
+					destroy(_alloc, file);
+				}
+				file = next;
+			}
+		}
+
+		void _process_ack(Packet_descriptor packet)
+		{
+			_in_flight--;
+
+			if (packet.size())
+				_source.release_packet(packet);
+
+			Log_file *file = _file_by_handle(packet.handle());
+			if (!file)
+				return;
+
+			file->_in_flight--;
+
+			if (packet.operation() == Packet_descriptor::WRITE
+			 && !packet.succeeded())
+				warning("writing to ", file->_dir_path, "/", file->_name, " failed");
+
+			/* the sync of a closed file completes its life time */
+			if (packet.operation() == Packet_descriptor::SYNC) {
+				_fs.close(file->_handle);
+				file->_closed = true;
+			}
+		}
+
+		bool _can_submit() {
+			return _in_flight < MAX_IN_FLIGHT && _source.ready_to_submit(); }
+
+		void _submit(Log_file &file, Packet_descriptor const &packet)
+		{
+			_source.submit_packet(packet);
+			_in_flight++;
+			file._in_flight++;
+		}
+
+		/**
+		 * Submit the partially or completely filled packet of 'file'
+		 *
+		 * \return false if the packet must be kept until an
+		 *         acknowledgement arrives
+		 */
+		bool _flush(Log_file &file)
+		{
+			if (!file._fill)
+				return true;
+
+			if (_attr.rotate && file._rotatable && file._size
+			 && file._size + file._fill > _attr.rotate)
+				file._rotate_pending = true;
+
+			/* rotate once the packets of the old file are acknowledged */
+			if (file._rotate_pending && !file._in_flight) {
+				_rotate(file);
+				file._rotate_pending = false;
+			}
+
+			if (file._rotate_pending || !_can_submit()) {
+				_flush_blocked = true;
+				return false;
+			}
+
+			_submit(file, Packet_descriptor(file._packet, file._handle,
+			                                Packet_descriptor::WRITE,
+			                                file._fill, File_system::SEEK_TAIL));
+			file._size  += file._fill;
+			file._packet = Packet_descriptor();
+			file._fill   = 0;
+			return true;
+		}
+
+		/**
+		 * Flush 'file' and submit the sync of a closed file
+		 */
+		void _flush_and_sync(Log_file &file)
+		{
+			if (!_flush(file) || !file._sync_pending)
+				return;
+
+			if (!_can_submit()) {
+				_flush_blocked = true;
+				return;
+			}
+
+			_submit(file, Packet_descriptor(Packet_descriptor(), file._handle,
+			                                Packet_descriptor::SYNC, 0, 0));
+			file._sync_pending = false;
+		}
+
+		void _flush_all()
+		{
+			_flush_blocked = false;
+			_for_each_file([&] (Log_file &file) { _flush_and_sync(file); });
+		}
+
+		/**
+		 * Allocate packet for filling it with the messages of 'file'
+		 *
+		 * \return false if all packets are in flight or being filled
+		 */
+		bool _alloc_packet(Log_file &file)
+		{
+			try {
+				file._packet = _source.alloc_packet(_attr.packet_size);
+				return true;
+			}
+			catch (File_system::Session::Tx::Source::Packet_alloc_failed) { }
+
+			/*
+			 * If no packet is in flight, all packets are being filled.
+			 * Submit them to make sure that an acknowledgement is about
+			 * to come.
+			 */
+			if (!_in_flight)
+				_flush_all();
+
+			return false;
+		}
+
+		void _move(File_system::Dir_handle dir, Name const &from, Name const &to)
+		{
+			try { _fs.unlink(dir, to.string()); }
+			catch (File_system::Lookup_failed) { }
+			_fs.move(dir, from.string(), dir, to.string());
+		}
+
+		/**
+		 * Move the log file to "<name>.1", shift older files, and reopen
+		 *
+		 * Must be called only if no packet of 'file' is in flight.
+		 */
+		void _rotate(Log_file &file)
+		{
+			auto rotated_name = [&] (unsigned i) {
+				return Name(file._name, ".", i); };
+
+			try {
+				File_system::Dir_handle dir =
+					_fs.dir(file._dir_path.base(), false);
+				File_system::Handle_guard dir_guard(_fs, dir);
+
+				for (unsigned i = _attr.keep; i > 1; i--) {
+					try { _move(dir, rotated_name(i - 1), rotated_name(i)); }
+					catch (File_system::Lookup_failed) { }
+				}
+				_move(dir, file._name, rotated_name(1));
+
+				File_system::File_handle const handle =
+					_fs.file(dir, file._name.string(), File_system::WRITE_ONLY, true);
+
+				_fs.close(file._handle);
+				file._handle = handle;
+				file._size   = 0;
+			}
+			catch (...) {
+				warning("cannot rotate ", file._dir_path, "/", file._name,
+				        ", rotation disabled for this file");
+				file._rotatable = false;
+			}
+		}
+
+		void _schedule_flush()
+		{
+			if (_flush_pending || !_timer.constructed())
+				return;
+
+			_timer->trigger_once(_attr.flush_ms*1000);
+			_flush_pending = true;
+		}
+
+		void _handle_timeout()
+		{
+			_flush_pending = false;
+			_flush_all();
+			_destroy_closed_files();
+		}
+
+		void _handle_ack()
+		{
+			while (_source.ack_avail())
+				_process_ack(_source.get_acked_packet());
+
+			/*
+			 * In write-behind mode, use the freed slots right away.
+			 * Otherwise, resume only the flushes that were blocked.
+			 */
+			if (!_attr.flush_ms || _flush_blocked)
+				_flush_all();
+
+			if (_dropped) {
+				warning(_dropped, " log messages dropped, file system too slow");
+				_dropped = 0;
+			}
+
+			_destroy_closed_files();
+		}
+
+		void _append(Log_file &file, char const *src, size_t len)
+		{
+			memcpy(_source.packet_content(file._packet) + file._fill, src, len);
+			file._fill += len;
+		}
+
+	public:
+
+		Writer(Env &env, Allocator &alloc, File_system::Connection &fs,
+		       Attr const &attr)
+		:
+			_env(env), _alloc(alloc), _fs(fs), _attr(attr)
+		{
+			_fs.sigh_ack_avail(_ack_handler);
+
+			if (_attr.flush_ms) {
+				_timer.construct(env);
+				_timer->sigh(_timeout_handler);
+			}
+		}
+
+		/**
+		 * Open log file, or share the already open file with the same path
+		 *
+		 * \throw File_system exceptions
+		 */
+		Log_file &open(Path const &dir_path, Name const &name, bool truncate)
+		{
+			_destroy_closed_files();
+
+			for (Log_file *file = _files.first(); file; file = file->next()) {
+				if (file->_matches(dir_path, name)) {
+					file->_users++;
+					return *file;
+				}
+			}
+
+			using namespace File_system;
+
+			Dir_handle   dir_handle = ensure_dir(_fs, dir_path.base());
+			Handle_guard dir_guard(_fs, dir_handle);
+
+			Constructible<File_handle> handle;
+			try {
+				handle.construct(_fs.file(dir_handle, name.string(), WRITE_ONLY, false));
+
+				if (truncate)
+					_fs.truncate(*handle, 0);
+			}
+			catch (Lookup_failed) {
+				handle.construct(_fs.file(dir_handle, name.string(), WRITE_ONLY, true));
+			}
+
+			file_size_t size = 0;
+			try { size = _fs.status(*handle).size; }
+			catch (...) { }
+
+			try {
+				Log_file &file = *new (_alloc) Log_file(dir_path, name, *handle, size);
+				_files.insert(&file);
+				return file;
+			}
+			catch (...) {
+				_fs.close(*handle);
+				throw;
+			}
+		}
+
+		/**
+		 * Release log file, the file is synced and closed by its last user
+		 */
+		void close(Log_file &file)
+		{
+			if (--file._users)
+				return;
+
+			file._closing      = true;
+			file._sync_pending = true;
+			_flush_and_sync(file);
+		}
+
+		void write(Log_file &file, char const *prefix, size_t prefix_len,
+		           char const *msg, size_t msg_len)
+		{
+			prefix_len = min(prefix_len, _attr.packet_size);
+			msg_len    = min(msg_len,    _attr.packet_size - prefix_len);
+
+			/* keep message and prefix within one packet */
+			bool const fits = file._fill + prefix_len + msg_len <= _attr.packet_size;
+
+			if ((!fits && !_flush(file))
+			 || (!file._packet.size() && !_alloc_packet(file))) {
+				_dropped++;
+				return;
+			}
+
+			_append(file, prefix, prefix_len);
+			_append(file, msg, msg_len);
+
+			if (!_attr.flush_ms) {
+				if (_in_flight < _attr.packets)
+					_flush(file);
+			} else {
+				_schedule_flush();
+			}
+		}
+};
+
+#endif /* _FS_LOG__LOG_FILE_H_ */
@@ -32,15 +32,6 @@ namespace Fs_log {
 	using namespace File_system;
 
 	class  Root_component;
-
-	enum {
-		PACKET_SIZE = Log_session::String::MAX_SIZE,
-		 QUEUE_SIZE = File_system::Session::TX_QUEUE_SIZE,
-		TX_BUF_SIZE = PACKET_SIZE * (QUEUE_SIZE+2)
-	};
-
-	typedef Genode::Path<File_system::MAX_PATH_LEN> Path;
-
 }
 
 
@@ -53,8 +44,15 @@ class Fs_log::Root_component :
 		Genode::Attached_rom_dataspace  _config_rom { _env, "config" };
 		Genode::Heap                    _heap { _env.ram(), _env.rm() };
 		Allocator_avl                   _tx_alloc { &_heap };
-		File_system::Connection         _fs
-			{ _env, _tx_alloc, "", "/", true, TX_BUF_SIZE };
+
+		/* the buffer configuration is evaluated once at startup */
+		Writer::Attr const _writer_attr =
+			Writer::Attr::from_xml(_config_rom.xml());
+
+		File_system::Connection _fs
+			{ _env, _tx_alloc, "", "/", true, _writer_attr.tx_buf_size() };
+
+		Writer _writer { _env, _heap, _fs, _writer_attr };
 
 		void _update_config() { _config_rom.update(); }
 
@@ -131,24 +129,14 @@ class Fs_log::Root_component :
 			char const *errstr;
 			try {
 
-				Dir_handle   dir_handle = ensure_dir(_fs, dir_path.base());
-				Handle_guard dir_guard(_fs, dir_handle);
-
-				Genode::Constructible<File_handle> handle;
+				/* don't truncate at every new child session */
+				Log_file &file = _writer.open(dir_path, file_name,
+				                              truncate && !strcmp(label_prefix, ""));
 				try {
-					handle.construct(_fs.file(dir_handle, file_name,
-					                 File_system::WRITE_ONLY, false));
-
-					/* don't truncate at every new child session */
-					if (truncate && (strcmp(label_prefix, "") == 0))
-						_fs.truncate(*handle, 0);
-				}
-				catch (File_system::Lookup_failed) {
-					handle.construct(_fs.file(dir_handle, file_name,
-					                 File_system::WRITE_ONLY, true));
+					return new (md_alloc())
+						Session_component(_env, _writer, file, label_prefix);
 				}
-
-				return new (md_alloc()) Session_component(_fs, *handle, label_prefix);
+				catch (...) { _writer.close(file); throw; }
 			}
 			catch (Permission_denied) {
 				errstr = "permission denied"; }
@@ -171,6 +159,11 @@ class Fs_log::Root_component :
 			throw Service_denied();
 		}
 
+		void _upgrade_session(Session_component *s, const char *args) override
+		{
+			s->upgrade(Arg_string::find_arg(args, "ram_quota").ulong_value(0));
+		}
+
 	public:
 
 		/**
@@ -183,11 +176,6 @@ class Fs_log::Root_component :
 		{
 			_config_rom.sigh(_config_handler);
 
-			/* fill the ack queue with packets so sessions never need to alloc */
-			File_system::Session::Tx::Source &source = *_fs.tx();
-			for (int i = 0; i < QUEUE_SIZE-1; ++i)
-				source.submit_packet(source.alloc_packet(PACKET_SIZE));
-
 			env.parent().announce(env.ep().manage(*this));
 		}
 
@@ -4,7 +4,8 @@
  * \date   2015-05-16
  *
  * Message writing is fire-and-forget to prevent
- * logging from becoming I/O bound.
+ * logging from becoming I/O bound. Messages are
+ * buffered by the writer of the log file.
  */
 
 /*
@@ -19,10 +20,13 @@
 
 /* Genode includes */
 #include <log_session/log_session.h>
-#include <file_system_session/file_system_session.h>
 #include <base/rpc_server.h>
 #include <base/snprintf.h>
 #include <base/log.h>
+#include <os/log_ring_buffer.h>
+
+/* local includes */
+#include "log_file.h"
 
 namespace Fs_log {
 
@@ -31,24 +35,38 @@ namespace Fs_log {
 	class Session_component;
 }
 
-class Fs_log::Session_component : public Genode::Rpc_object<Genode::Log_session>
+class Fs_log::Session_component : public Genode::Rpc_object<Genode::Log_session>,
+                                  private Genode::Log_ring_buffer::Output
 {
 	private:
 
 		char _label_buf[MAX_LABEL_LEN];
 		Genode::size_t const _label_len;
 
-		File_system::Session          &_fs;
-		File_system::File_handle const _handle;
+		Writer   &_writer;
+		Log_file &_file;
+
+		Genode::Log_ring_buffer _ring;
+
+		void _output(char const *string, Genode::size_t len) {
+			_writer.write(_file, _label_buf, _label_len, string, len); }
+
+		/**
+		 * Log_ring_buffer::Output interface
+		 */
+		void output_from_ring(char const *string) override {
+			_output(string, Genode::strlen(string)); }
 
 	public:
 
-		Session_component(File_system::Session     &fs,
-		                  File_system::File_handle  handle,
-		                  char               const *label)
+		Session_component(Genode::Env &env, Writer &writer, Log_file &file,
+		                  char const *label)
 		:
-			_label_len(Genode::strlen(label) ? Genode::strlen(label)+3 : 0),
-			_fs(fs), _handle(handle)
+			_label_len(Genode::strlen(label)
+			           ? Genode::min(Genode::strlen(label)+3, (Genode::size_t)MAX_LABEL_LEN-1)
+			           : 0),
+			_writer(writer), _file(file),
+			_ring(env.ram(), env.rm(), env.ep(), *this)
 		{
 			if (_label_len)
 				Genode::snprintf(_label_buf, MAX_LABEL_LEN, "[%s] ", label);
@@ -56,21 +74,12 @@ class Fs_log::Session_component : public Genode::Rpc_object<Genode::Log_session>
 
 		~Session_component()
 		{
-			/* sync */
-
-			File_system::Session::Tx::Source &source = *_fs.tx();
-
-			File_system::Packet_descriptor packet = source.get_acked_packet();
-
-			if (packet.operation() == File_system::Packet_descriptor::SYNC)
-				_fs.close(packet.handle());
-
-			packet = File_system::Packet_descriptor(
-				packet, _handle, File_system::Packet_descriptor::SYNC, 0, 0);
-
-			source.submit_packet(packet);
+			_ring.drain();
+			_writer.close(_file);
 		}
 
+		void upgrade(Genode::size_t ram_quota) { _ring.upgrade(ram_quota); }
+
 
 		/*****************
 		 ** Log session **
@@ -87,44 +96,18 @@ class Fs_log::Session_component : public Genode::Rpc_object<Genode::Log_session>
 
 			size_t msg_len = strlen(msg.string());
 
-			File_system::Session::Tx::Source &source = *_fs.tx();
-
-			File_system::Packet_descriptor packet = source.get_acked_packet();
-
-			if (packet.operation() == File_system::Packet_descriptor::SYNC)
-				_fs.close(packet.handle());
+			/* output the messages of the ring first to retain the order */
+			_ring.drain();
 
-			packet = File_system::Packet_descriptor(
-				packet, _handle, File_system::Packet_descriptor::WRITE,
-				msg_len, File_system::SEEK_TAIL);
-
-			char *buf = source.packet_content(packet);
-
-			if (_label_len) {
-				memcpy(buf, _label_buf, _label_len);
-
-				if (_label_len+msg_len > Log_session::String::MAX_SIZE) {
-					packet.length(msg_len);
-					source.submit_packet(packet);
-
-					packet =  File_system::Packet_descriptor(
-						source.get_acked_packet(),
-				       _handle, File_system::Packet_descriptor::WRITE,
-				       msg_len, File_system::SEEK_TAIL);
-
-					buf = source.packet_content(packet);
-
-				} else {
-					buf += _label_len;
-					packet.length(_label_len+msg_len);
-				}
-			}
-
-			memcpy(buf, msg.string(), msg_len);
-
-			source.submit_packet(packet);
+			_output(msg.string(), msg_len);
 			return msg_len;
 		}
+
+		Genode::Dataspace_capability ring(Genode::size_t size) override {
+			return _ring.dataspace(size); }
+
+		Genode::Signal_context_capability ring_sigh() override {
+			return _ring.sigh(); }
 };
 
 #endif
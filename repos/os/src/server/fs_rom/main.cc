@@ -90,6 +90,52 @@ class Fs_rom::Rom_session_component : public  Rpc_object<Rom_session>
 		 */
 		Attached_ram_dataspace _file_ds;
 
+		/**
+		 * File content provided as dataspace by the file-system server
+		 *
+		 * If the server supports it, the file content is not copied into
+		 * '_file_ds'. The file handle stays open while the dataspace is
+		 * handed out because the server frees the dataspace when the
+		 * handle is closed.
+		 */
+		struct Mapped_file
+		{
+			File_system::Session          &fs;
+			File_system::File_handle const handle;
+			Dataspace_capability     const ds;
+
+			Mapped_file(File_system::Session &fs,
+			            File_system::File_handle handle,
+			            Dataspace_capability ds)
+			: fs(fs), handle(handle), ds(ds) { }
+
+			~Mapped_file() { fs.close(handle); }
+		};
+
+		Constructible<Mapped_file> _mapped_file { };
+
+		/**
+		 * Request file content as dataspace, return true on success
+		 */
+		bool _map_file(File_system::Dir_handle parent, char const *name)
+		{
+			using namespace File_system;
+
+			_mapped_file.destruct();
+
+			File_handle const handle = _fs.file(parent, name, READ_ONLY, false);
+
+			try {
+				_mapped_file.construct(_fs, handle, _fs.dataspace(handle));
+				return true;
+			}
+			catch (...) { }
+
+			/* server does not support the mapping, copy the content */
+			_fs.close(handle);
+			return false;
+		}
+
 		/**
 		 * Signal destination for ROM file changes
 		 */
@@ -173,6 +219,10 @@ class Fs_rom::Rom_session_component : public  Rpc_object<Rom_session>
 		{
 			using namespace File_system;
 
+			/* the content of a mapped file cannot be updated in place */
+			if (update_only && _mapped_file.constructed())
+				return false;
+
 			Genode::Path<PATH_MAX_LEN> dir_path(_file_path);
 			dir_path.strip_last_element();
 			Genode::Path<PATH_MAX_LEN> file_name(_file_path);
@@ -193,6 +243,15 @@ class Fs_rom::Rom_session_component : public  Rpc_object<Rom_session>
 			_file_seek = 0;
 			_file_size = _fs.status(_file_handle).size;
 
+			if (!update_only && _file_size > 0
+			 && _map_file(parent_handle, file_name.base() + 1)) {
+
+				_handed_out_version = _curr_version;
+				return true;
+			}
+
+			_mapped_file.destruct();
+
 			if (_file_size > _file_ds.size()) {
 				/* allocate new RAM dataspace according to file size */
 				if (update_only)
@@ -280,7 +339,10 @@ class Fs_rom::Rom_session_component : public  Rpc_object<Rom_session>
 				/* notify if the file is removed */
 				catch (File_system::Lookup_failed) {
 					if (_file_size > 0) {
-						memset(_file_ds.local_addr<char>(), 0x00, _file_size);
+						if (_mapped_file.constructed())
+							_mapped_file.destruct();
+						else
+							memset(_file_ds.local_addr<char>(), 0x00, _file_size);
 						_file_size = 0;
 						Signal_transmitter(_sigh).submit();
 					}
@@ -340,6 +402,9 @@ class Fs_rom::Rom_session_component : public  Rpc_object<Rom_session>
 
 			_try_read_dataspace(UPDATE_OR_REPLACE);
 
+			if (_mapped_file.constructed())
+				return static_cap_cast<Rom_dataspace>(_mapped_file->ds);
+
 			/* always serve a valid, even empty, dataspace */
 			if (_file_ds.size() < 1) {
 				_file_ds.realloc(&_env.ram(), 1);
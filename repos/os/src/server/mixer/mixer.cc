@@ -13,7 +13,8 @@
  * contains multiple input sessions (Audio_out::Session_elem). For every packet
  * in the output queue the mixer sums the corresponding packets from all input
  * sessions up. The volume level of an input packet is applied in a linear way
- * (sample_value * volume_level) and the output packet is clipped at [1.0,-1.0].
+ * (sample_value * volume_level), the sum is clipped at [1.0,-1.0] and finally
+ * scaled by the output volume level.
  */
 
 /*
@@ -27,7 +28,6 @@
 #include <mixer/channel.h>
 #include <os/reporter.h>
 #include <root/component.h>
-#include <util/retry.h>
 #include <util/string.h>
 #include <util/xml_node.h>
 #include <audio_out_session/connection.h>
@@ -173,11 +173,6 @@ class Audio_out::Mixer
 		float _default_volume     { 0.f };
 		bool  _default_muted      { true };
 
-		/**
-		 * Remix all exception
-		 */
-		struct Remix_all { };
-
 		/**
 		 * A channel contains multiple session components
 		 */
@@ -306,35 +301,60 @@ class Audio_out::Mixer
 		}
 
 		/*
-		 * Mix input packet into output packet
+		 * Intermediate buffer used to sum up all input packets of one
+		 * output packet before volume and clipping are applied
 		 *
-		 * Packets are mixed in a linear way with min/max clipping.
+		 * The buffer is used by plain loops over contiguous float arrays
+		 * without data-dependent branches, which allows the compiler to
+		 * vectorize them.
 		 */
-		void _mix_packet(Packet *out, Packet *in, bool clear,
-		                 float const out_vol, float const vol)
-		{
-			if (clear) {
-				for_each_index(Audio_out::PERIOD, [&] (int const i) {
-					out->content()[i]  = (in->content()[i] * vol);
+		float _mix_buffer[Audio_out::PERIOD] __attribute__((aligned(16)));
 
-					if (out->content()[i] > 1) out->content()[i] = 1;
-					if (out->content()[i] < -1) out->content()[i] = -1;
+		/*
+		 * Accumulate input packet into the mix buffer
+		 */
+		void _mix_packet(Packet *in, bool clear, float const vol)
+		{
+			float       * const acc  = _mix_buffer;
+			float const * const data = in->content();
 
-					out->content()[i] *= out_vol;
-				});
-			} else {
-				for_each_index(Audio_out::PERIOD, [&] (int const i) {
-					out->content()[i] += (in->content()[i] * vol);
+			if (clear)
+				for (Genode::size_t i = 0; i < Audio_out::PERIOD; i++)
+					acc[i] = data[i] * vol;
+			else
+				for (Genode::size_t i = 0; i < Audio_out::PERIOD; i++)
+					acc[i] += data[i] * vol;
 
-					if (out->content()[i] > 1) out->content()[i] = 1;
-					if (out->content()[i] < -1) out->content()[i] = -1;
+			/* mark the packet as processed by invalidating it */
+			in->invalidate();
+		}
 
-					out->content()[i] *= out_vol;
-				});
+		/*
+		 * Write mix buffer to output packet
+		 *
+		 * The sum of all input packets is clipped at [-1.0, 1.0] and
+		 * scaled by the output volume.
+		 */
+		void _finish_packet(Packet *out, float const out_vol)
+		{
+			float const * const acc  = _mix_buffer;
+			float       * const data = out->content();
+
+			for (Genode::size_t i = 0; i < Audio_out::PERIOD; i++) {
+				float v = acc[i];
+				v = v >  1.f ?  1.f : v;
+				v = v < -1.f ? -1.f : v;
+				data[i] = v * out_vol;
 			}
+		}
 
-			/* mark the packet as processed by invalidating it */
-			in->invalidate();
+		/*
+		 * Check if a session contributes to the output
+		 */
+		static bool _audible(Session_elem const &session)
+		{
+			return !session.stopped() && !session.muted
+			    && !(session.volume < 0.01f);
 		}
 
 		/*
@@ -348,41 +368,38 @@ class Audio_out::Mixer
 
 			float const out_vol  = _out_volume[nr];
 
-			bool       clear     = true;
-			bool       mix_all   = remix;
-			bool const out_valid = out->valid();
+			bool mix_all = remix;
 
-			Genode::retry<Remix_all>(
-				/*
-				 * Mix the input packet at the given position of every input
-				 * session to one output packet.
-				 */
-				[&] {
-					sc->for_each_session([&] (Session_elem &session) {
-						if (session.stopped() || session.muted || session.volume < 0.01f)
-							return;
+			/*
+			 * If an input packet of an already mixed output packet has
+			 * changed, we have to remix all input packets again.
+			 */
+			if (!mix_all && out->valid())
+				sc->for_each_session([&] (Session_elem &session) {
+					if (_audible(session) && session.get_packet(offset)->valid())
+						mix_all = true; });
 
-						Packet *in = session.get_packet(offset);
+			/*
+			 * Mix the input packet at the given position of every input
+			 * session to one output packet.
+			 */
+			bool clear = true;
+			sc->for_each_session([&] (Session_elem &session) {
+				if (!_audible(session))
+					return;
 
-						/* remix again if input has changed for already mixed packet */
-						if (in->valid() && out_valid && !mix_all) throw Remix_all();
+				Packet *in = session.get_packet(offset);
 
-						/* skip if packet has been processed or was already played */
-						if ((!in->valid() && !mix_all) || in->played()) return;
+				/* skip if packet has been processed or was already played */
+				if ((!in->valid() && !mix_all) || in->played()) return;
 
-						_mix_packet(out, in, clear, out_vol, session.volume);
+				_mix_packet(in, clear, session.volume);
 
-						clear = false;
-					});
-				},
-				/*
-				 * An input packet of an already mixed output packet has
-				 * changed, we have to remix all input packets again.
-				 */
-				[&] {
-					clear   = true;
-					mix_all = true;
-				});
+				clear = false;
+			});
+
+			if (!clear)
+				_finish_packet(out, out_vol);
 
 			return !clear;
 		}
@@ -1,3 +1,6 @@
 TARGET = mixer
 SRC_CC = mixer.cc
 LIBS = base
+
+# enable auto-vectorization of the mixing loops
+CC_OPT_mixer += -ftree-vectorize
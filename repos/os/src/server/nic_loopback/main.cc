@@ -32,6 +32,10 @@ namespace Nic_loopback {
 
 class Nic_loopback::Session_component : public Nic::Session_component
 {
+	private:
+
+		Nic::Offload _offload { 0 };
+
 	public:
 
 		/**
@@ -64,14 +68,32 @@ class Nic_loopback::Session_component : public Nic::Session_component
 			return true;
 		}
 
+		/*
+		 * Packets are echoed to the same client. So an offload feature
+		 * can be enabled only if the client supports it in both
+		 * directions.
+		 */
+		Nic::Offload offload(Nic::Offload requested) override
+		{
+			using Nic::Offload;
+
+			_offload.value = 0;
+
+			if (requested.has(Offload::TX_CHECKSUM | Offload::RX_CHECKSUM))
+				_offload.value |= Offload::TX_CHECKSUM | Offload::RX_CHECKSUM;
+
+			if (requested.has(Offload::TX_LARGE | Offload::RX_LARGE))
+				_offload.value |= Offload::TX_LARGE | Offload::RX_LARGE;
+
+			return _offload;
+		}
+
 		void _handle_packet_stream() override;
 };
 
 
 void Nic_loopback::Session_component::_handle_packet_stream()
 {
-	size_t const alloc_size = Nic::Packet_allocator::DEFAULT_PACKET_SIZE;
-
 	/* loop while we can make progress */
 	for (;;) {
 
@@ -109,14 +131,19 @@ void Nic_loopback::Session_component::_handle_packet_stream()
 		 */
 
 
-		Packet_descriptor packet_to_client;
+		/* large segments need a packet of their size */
+		Nic::Packet_descriptor const next_packet = _tx.sink()->peek_packet();
+		size_t const alloc_size = max(next_packet.size(),
+		                              (size_t)Nic::Packet_allocator::DEFAULT_PACKET_SIZE);
+
+		Nic::Packet_descriptor packet_to_client;
 		try {
 			packet_to_client = _rx.source()->alloc_packet(alloc_size); }
 		catch (Session::Rx::Source::Packet_alloc_failed) {
 			continue; }
 
 		/* obtain packet */
-		Packet_descriptor const packet_from_client = _tx.sink()->get_packet();
+		Nic::Packet_descriptor const packet_from_client = _tx.sink()->get_packet();
 		if (!packet_from_client.size() || !_tx.sink()->packet_valid(packet_from_client)) {
 			warning("received invalid packet");
 			_rx.source()->release_packet(packet_to_client);
@@ -127,8 +154,16 @@ void Nic_loopback::Session_component::_handle_packet_stream()
 		       _tx.sink()->packet_content(packet_from_client),
 		       packet_from_client.size());
 
-		packet_to_client = Packet_descriptor(packet_to_client.offset(),
-		                                     packet_from_client.size());
+		packet_to_client = Nic::Packet_descriptor(packet_to_client.offset(),
+		                                          packet_from_client.size());
+
+		/* pass offload meta data of the enabled features */
+		if (_offload.has(Nic::Offload::TX_CHECKSUM))
+			packet_to_client.checksum(packet_from_client.checksum());
+
+		if (_offload.has(Nic::Offload::TX_LARGE))
+			packet_to_client.segment_size(packet_from_client.segment_size());
+
 		_rx.source()->submit_packet(packet_to_client);
 
 		_tx.sink()->acknowledge_packet(packet_from_client);
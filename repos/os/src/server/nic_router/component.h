@@ -310,6 +310,8 @@ class Net::Session_component : private Session_component_base,
 		bool link_state() override { return _interface.link_state(); }
 		void link_state_sigh(Genode::Signal_context_capability sigh) override {
 			_interface.session_link_state_sigh(sigh); }
+		Nic::Offload offload(Nic::Offload requested) override {
+			return _interface.offload(requested); }
 
 
 		/***************
@@ -273,25 +273,168 @@ void Interface::_destroy_link(Link &link)
 }
 
 
-void Interface::_pass_prot(Ethernet_frame       &eth,
-                           Size_guard           &size_guard,
-                           Ipv4_packet          &ip,
-                           L3_protocol    const  prot,
-                           void          *const  prot_base,
-                           size_t         const  prot_size)
+void Interface::_pass_prot(Ethernet_frame          &eth,
+                           Size_guard              &size_guard,
+                           Ipv4_packet             &ip,
+                           Packet_descriptor const &pkt,
+                           L3_protocol       const  prot,
+                           void             *const  prot_base,
+                           size_t            const  prot_size)
 {
 	eth.src(_router_mac);
-	_update_checksum(prot, prot_base, prot_size, ip.src(), ip.dst(), ip.total_length());
-	_pass_ip(eth, size_guard, ip);
+
+	bool const tcp_or_udp = prot == L3_protocol::TCP ||
+	                        prot == L3_protocol::UDP;
+
+	/*
+	 * A partial checksum, which only a sender with checksum offloading
+	 * may submit, is completed by '_send_offloaded' if needed. Any other
+	 * packet keeps a complete checksum.
+	 */
+	Packet_descriptor offload_info = pkt;
+	if (!tcp_or_udp || pkt.checksum() != Packet_descriptor::CHECKSUM_PARTIAL) {
+		_update_checksum(prot, prot_base, prot_size, ip.src(), ip.dst(), ip.total_length());
+		offload_info.checksum(Packet_descriptor::CHECKSUM_COMPLETE);
+	}
+	_pass_ip(eth, size_guard, ip, offload_info);
 }
 
 
-void Interface::_pass_ip(Ethernet_frame &eth,
-                         Size_guard     &size_guard,
-                         Ipv4_packet    &ip)
+void Interface::_pass_ip(Ethernet_frame          &eth,
+                         Size_guard              &size_guard,
+                         Ipv4_packet             &ip,
+                         Packet_descriptor const &pkt)
 {
 	ip.update_checksum();
-	send(eth, size_guard);
+	_send_offloaded(eth, size_guard, ip, pkt);
+}
+
+
+void Interface::_limit_offload_info(Packet_descriptor &pkt) const
+{
+	if (!_offload.has(Nic::Offload::TX_CHECKSUM)) {
+		pkt.checksum(Packet_descriptor::CHECKSUM_COMPLETE); }
+
+	if (!_offload.has(Nic::Offload::TX_LARGE)) {
+		pkt.segment_size(0); }
+}
+
+
+void Interface::_send_offloaded(Ethernet_frame          &eth,
+                                Size_guard              &size_guard,
+                                Ipv4_packet             &ip,
+                                Packet_descriptor const &pkt)
+{
+	L3_protocol const prot = ip.protocol();
+	if (prot != L3_protocol::TCP && prot != L3_protocol::UDP) {
+		send(eth, size_guard);
+		return;
+	}
+	/* split large segments that the client cannot receive */
+	Packet_descriptor offload_info { };
+	if (prot == L3_protocol::TCP && pkt.segment_size()) {
+		if (!_offload.has(Nic::Offload::RX_LARGE)) {
+			_send_tcp_segments(eth, size_guard, ip, pkt);
+			return;
+		}
+		offload_info.segment_size(pkt.segment_size());
+	}
+	/* complete checksums that the client would verify */
+	if (pkt.checksum() == Packet_descriptor::CHECKSUM_PARTIAL) {
+		if (_offload.has(Nic::Offload::RX_CHECKSUM)) {
+			offload_info.checksum(Packet_descriptor::CHECKSUM_PARTIAL);
+		} else {
+			size_t const ip_size = ip.total_length();
+			if (ip_size < sizeof(Ipv4_packet) ||
+			    ip_size > size_guard.total_size() - sizeof(Ethernet_frame)) {
+				throw Drop_packet("bad IPv4 total length"); }
+
+			_update_checksum(prot, (void *)((addr_t)&ip + sizeof(Ipv4_packet)),
+			                 ip_size - sizeof(Ipv4_packet), ip.src(), ip.dst(),
+			                 ip_size);
+		}
+	}
+	send(eth, size_guard, offload_info);
+}
+
+
+void Interface::_send_tcp_segments(Ethernet_frame          &eth,
+                                   Size_guard              &size_guard,
+                                   Ipv4_packet             &ip,
+                                   Packet_descriptor const &pkt)
+{
+	size_t const segment_size = pkt.segment_size();
+
+	size_t const ip_size = ip.total_length();
+	if (ip_size < sizeof(Ipv4_packet) + sizeof(Tcp_packet) ||
+	    ip_size > size_guard.total_size() - sizeof(Ethernet_frame)) {
+		throw Drop_packet("bad IPv4 total length"); }
+
+	Tcp_packet const &tcp = *(Tcp_packet *)((addr_t)&ip + sizeof(Ipv4_packet));
+	size_t const tcp_hdr_size = tcp.data_offset() * 4;
+	size_t const hdr_size     = sizeof(Ethernet_frame) + sizeof(Ipv4_packet) +
+	                            tcp_hdr_size;
+
+	if (tcp_hdr_size < sizeof(Tcp_packet) ||
+	    sizeof(Ethernet_frame) + ip_size < hdr_size) {
+		throw Drop_packet("bad TCP header length"); }
+
+	size_t      const data_size = sizeof(Ethernet_frame) + ip_size - hdr_size;
+	char const *const data      = (char const *)&eth + hdr_size;
+
+	/* segments of a partial-checksum packet may stay partial */
+	Packet_descriptor offload_info { };
+	bool const checksum = pkt.checksum() != Packet_descriptor::CHECKSUM_PARTIAL ||
+	                      !_offload.has(Nic::Offload::RX_CHECKSUM);
+	if (!checksum) {
+		offload_info.checksum(Packet_descriptor::CHECKSUM_PARTIAL); }
+
+	uint32_t         const seq_nr = tcp.seq_nr();
+	Genode::uint16_t const id     = ip.identification();
+
+	size_t offset = 0;
+	for (unsigned i = 0; offset < data_size; i++) {
+
+		size_t const seg_data_size = Genode::min(segment_size, data_size - offset);
+		bool   const last          = offset + seg_data_size == data_size;
+
+		send(hdr_size + seg_data_size, offload_info,
+		     [&] (void *pkt_base, Size_guard &)
+		{
+			Genode::memcpy(pkt_base, &eth, hdr_size);
+			Genode::memcpy((char *)pkt_base + hdr_size, data + offset,
+			               seg_data_size);
+
+			Ipv4_packet &seg_ip  = *(Ipv4_packet *)((addr_t)pkt_base +
+			                                        sizeof(Ethernet_frame));
+			Tcp_packet  &seg_tcp = *(Tcp_packet *)((addr_t)&seg_ip +
+			                                       sizeof(Ipv4_packet));
+
+			seg_tcp.seq_nr(seq_nr + (uint32_t)offset);
+			if (!last) {
+				seg_tcp.fin(false);
+				seg_tcp.psh(false);
+			}
+			if (checksum) {
+				seg_tcp.update_checksum(seg_ip.src(), seg_ip.dst(),
+				                        tcp_hdr_size + seg_data_size); }
+
+			seg_ip.total_length(hdr_size - sizeof(Ethernet_frame) + seg_data_size);
+			seg_ip.identification((Genode::uint16_t)(id + i));
+			seg_ip.update_checksum();
+		});
+		offset += seg_data_size;
+	}
+}
+
+
+Nic::Offload Interface::offload(Nic::Offload requested)
+{
+	_offload.value = requested.value & (Nic::Offload::TX_CHECKSUM |
+	                                    Nic::Offload::RX_CHECKSUM |
+	                                    Nic::Offload::TX_LARGE    |
+	                                    Nic::Offload::RX_LARGE);
+	return _offload;
 }
 
 
@@ -525,15 +668,16 @@ void Interface::_adapt_eth(Ethernet_frame          &eth,
 }
 
 
-void Interface::_nat_link_and_pass(Ethernet_frame        &eth,
-                                   Size_guard            &size_guard,
-                                   Ipv4_packet           &ip,
-                                   L3_protocol     const  prot,
-                                   void           *const  prot_base,
-                                   size_t          const  prot_size,
-                                   Link_side_id    const &local_id,
-                                   Domain                &local_domain,
-                                   Domain                &remote_domain)
+void Interface::_nat_link_and_pass(Ethernet_frame          &eth,
+                                   Size_guard              &size_guard,
+                                   Ipv4_packet             &ip,
+                                   Packet_descriptor const &pkt,
+                                   L3_protocol       const  prot,
+                                   void             *const  prot_base,
+                                   size_t            const  prot_size,
+                                   Link_side_id      const &local_id,
+                                   Domain                  &local_domain,
+                                   Domain                  &remote_domain)
 {
 	try {
 		Pointer<Port_allocator_guard> remote_port_alloc;
@@ -551,7 +695,7 @@ void Interface::_nat_link_and_pass(Ethernet_frame        &eth,
 		                                 ip.src(), _src_port(prot, prot_base) };
 		_new_link(prot, local_id, remote_port_alloc, remote_domain, remote_id);
 		remote_domain.interfaces().for_each([&] (Interface &interface) {
-			interface._pass_prot(eth, size_guard, ip, prot, prot_base, prot_size);
+			interface._pass_prot(eth, size_guard, ip, pkt, prot, prot_base, prot_size);
 		});
 	} catch (Port_allocator_guard::Out_of_indices) {
 		switch (prot) {
@@ -799,6 +943,21 @@ void Interface::_domain_broadcast(Ethernet_frame &eth,
 }
 
 
+void Interface::_domain_broadcast(Ethernet_frame          &eth,
+                                  Size_guard              &size_guard,
+                                  Ipv4_packet             &ip,
+                                  Packet_descriptor const &pkt,
+                                  Domain                  &local_domain)
+{
+	eth.src(_router_mac);
+	local_domain.interfaces().for_each([&] (Interface &interface) {
+		if (&interface != this) {
+			interface._send_offloaded(eth, size_guard, ip, pkt);
+		}
+	});
+}
+
+
 void Interface::_send_icmp_dst_unreachable(Ipv4_address_prefix const &local_intf,
                                            Ethernet_frame      const &req_eth,
                                            Ipv4_packet         const &req_ip,
@@ -930,7 +1089,7 @@ void Interface::_handle_icmp_query(Ethernet_frame          &eth,
 		_dst_port(prot, prot_base, remote_side.src_port());
 
 		remote_domain.interfaces().for_each([&] (Interface &interface) {
-			interface._pass_prot(eth, size_guard, ip, prot, prot_base, prot_size);
+			interface._pass_prot(eth, size_guard, ip, pkt, prot, prot_base, prot_size);
 		});
 		_link_packet(prot, prot_base, link, client);
 		return;
@@ -947,7 +1106,7 @@ void Interface::_handle_icmp_query(Ethernet_frame          &eth,
 
 		Domain &remote_domain = rule.domain();
 		_adapt_eth(eth, local_id.dst_ip, pkt, remote_domain);
-		_nat_link_and_pass(eth, size_guard, ip, prot, prot_base, prot_size,
+		_nat_link_and_pass(eth, size_guard, ip, pkt, prot, prot_base, prot_size,
 		                   local_id, local_domain, remote_domain);
 
 		return;
@@ -1073,7 +1232,7 @@ void Interface::_handle_ip(Ethernet_frame          &eth,
 		 * Packet targets IP local to the domain's subnet and doesn't target
 		 * the router. Thus, forward it to all other interfaces of the domain.
 		 */
-		_domain_broadcast(eth, size_guard, local_domain);
+		_domain_broadcast(eth, size_guard, ip, pkt, local_domain);
 		return;
 	}
 
@@ -1130,7 +1289,7 @@ void Interface::_handle_ip(Ethernet_frame          &eth,
 			_dst_port(prot, prot_base, remote_side.src_port());
 
 			remote_domain.interfaces().for_each([&] (Interface &interface) {
-				interface._pass_prot(eth, size_guard, ip, prot, prot_base, prot_size);
+				interface._pass_prot(eth, size_guard, ip, pkt, prot, prot_base, prot_size);
 			});
 			_link_packet(prot, prot_base, link, client);
 			return;
@@ -1153,7 +1312,7 @@ void Interface::_handle_ip(Ethernet_frame          &eth,
 				if (!(rule.to_port() == Port(0))) {
 					_dst_port(prot, prot_base, rule.to_port());
 				}
-				_nat_link_and_pass(eth, size_guard, ip, prot, prot_base,
+				_nat_link_and_pass(eth, size_guard, ip, pkt, prot, prot_base,
 				                   prot_size, local_id, local_domain, remote_domain);
 				return;
 			}
@@ -1173,7 +1332,7 @@ void Interface::_handle_ip(Ethernet_frame          &eth,
 			}
 			Domain &remote_domain = permit_rule.domain();
 			_adapt_eth(eth, local_id.dst_ip, pkt, remote_domain);
-			_nat_link_and_pass(eth, size_guard, ip, prot, prot_base, prot_size,
+			_nat_link_and_pass(eth, size_guard, ip, pkt, prot, prot_base, prot_size,
 			                   local_id, local_domain, remote_domain);
 			return;
 		}
@@ -1193,7 +1352,7 @@ void Interface::_handle_ip(Ethernet_frame          &eth,
 		Domain &remote_domain = rule.domain();
 		_adapt_eth(eth, ip.dst(), pkt, remote_domain);
 		remote_domain.interfaces().for_each([&] (Interface &interface) {
-			interface._pass_ip(eth, size_guard, ip);
+			interface._pass_ip(eth, size_guard, ip, pkt);
 		});
 
 		return;
@@ -1375,7 +1534,8 @@ void Interface::_handle_arp(Ethernet_frame &eth,
 
 void Interface::_handle_pkt()
 {
-	Packet_descriptor const pkt = _sink.get_packet();
+	Packet_descriptor pkt = _sink.get_packet();
+	_limit_offload_info(pkt);
 	Size_guard size_guard(pkt.size());
 	try {
 		_handle_eth(_sink.packet_content(pkt), size_guard, pkt);
@@ -1581,10 +1741,13 @@ void Interface::_handle_eth(void              *const  eth_base,
 }
 
 
-void Interface::send(Ethernet_frame &eth,
-                     Size_guard     &size_guard)
+void Interface::send(Ethernet_frame          &eth,
+                     Size_guard              &size_guard,
+                     Packet_descriptor const &offload_info)
 {
-	send(size_guard.total_size(), [&] (void *pkt_base, Size_guard &size_guard) {
+	send(size_guard.total_size(), offload_info,
+	     [&] (void *pkt_base, Size_guard &size_guard)
+	{
 		Genode::memcpy(pkt_base, (void *)&eth, size_guard.total_size());
 	});
 }
@@ -159,6 +159,7 @@ class Net::Interface : private Interface_list::Element
 		Interface_link_stats                  _icmp_stats                { };
 		Interface_object_stats                _arp_stats                 { };
 		Interface_object_stats                _dhcp_stats                { };
+		Nic::Offload                          _offload                   { 0 };
 
 		void _new_link(L3_protocol             const  protocol,
 		               Link_side_id            const &local_id,
@@ -258,15 +259,16 @@ class Net::Interface : private Interface_list::Element
 		                Packet_descriptor const &pkt,
 		                Domain                  &remote_domain);
 
-		void _nat_link_and_pass(Ethernet_frame         &eth,
-		                        Size_guard             &size_guard,
-		                        Ipv4_packet            &ip,
-		                        L3_protocol      const  prot,
-		                        void            *const  prot_base,
-		                        Genode::size_t   const  prot_size,
-		                        Link_side_id     const &local_id,
-		                        Domain                 &local_domain,
-		                        Domain                 &remote_domain);
+		void _nat_link_and_pass(Ethernet_frame          &eth,
+		                        Size_guard              &size_guard,
+		                        Ipv4_packet             &ip,
+		                        Packet_descriptor const &pkt,
+		                        L3_protocol       const  prot,
+		                        void             *const  prot_base,
+		                        Genode::size_t    const  prot_size,
+		                        Link_side_id      const &local_id,
+		                        Domain                  &local_domain,
+		                        Domain                  &remote_domain);
 
 		void _broadcast_arp_request(Ipv4_address const &src_ip,
 		                            Ipv4_address const &dst_ip);
@@ -275,16 +277,46 @@ class Net::Interface : private Interface_list::Element
 		                       Size_guard     &size_guard,
 		                       Domain         &local_domain);
 
-		void _pass_prot(Ethernet_frame         &eth,
-		                Size_guard             &size_guard,
-		                Ipv4_packet            &ip,
-		                L3_protocol      const  prot,
-		                void            *const  prot_base,
-		                Genode::size_t   const  prot_size);
+		void _domain_broadcast(Ethernet_frame          &eth,
+		                       Size_guard              &size_guard,
+		                       Ipv4_packet             &ip,
+		                       Packet_descriptor const &pkt,
+		                       Domain                  &local_domain);
 
-		void _pass_ip(Ethernet_frame       &eth,
-		              Size_guard           &size_guard,
-		              Ipv4_packet          &ip);
+		void _pass_prot(Ethernet_frame          &eth,
+		                Size_guard              &size_guard,
+		                Ipv4_packet             &ip,
+		                Packet_descriptor const &pkt,
+		                L3_protocol       const  prot,
+		                void             *const  prot_base,
+		                Genode::size_t    const  prot_size);
+
+		void _pass_ip(Ethernet_frame          &eth,
+		              Size_guard              &size_guard,
+		              Ipv4_packet             &ip,
+		              Packet_descriptor const &pkt);
+
+		/**
+		 * Drop offload meta data of features not enabled for the client
+		 */
+		void _limit_offload_info(Packet_descriptor &pkt) const;
+
+		/**
+		 * Send IP packet with the offload meta data of the received 'pkt'
+		 *
+		 * Checksums and large segments that the client cannot handle are
+		 * resolved by the router. A checksum is passed on as partial only
+		 * if it was submitted as partial.
+		 */
+		void _send_offloaded(Ethernet_frame          &eth,
+		                     Size_guard              &size_guard,
+		                     Ipv4_packet             &ip,
+		                     Packet_descriptor const &pkt);
+
+		void _send_tcp_segments(Ethernet_frame          &eth,
+		                        Size_guard              &size_guard,
+		                        Ipv4_packet             &ip,
+		                        Packet_descriptor const &pkt);
 
 		void _handle_pkt();
 
@@ -304,13 +336,13 @@ class Net::Interface : private Interface_list::Element
 
 		void _ack_packet(Packet_descriptor const &pkt);
 
-		void _send_alloc_pkt(Genode::Packet_descriptor   &pkt,
-		                     void                      * &pkt_base,
-		                     Genode::size_t               pkt_size);
+		void _send_alloc_pkt(Packet_descriptor   &pkt,
+		                     void              * &pkt_base,
+		                     Genode::size_t       pkt_size);
 
-		void _send_submit_pkt(Genode::Packet_descriptor   &pkt,
-		                      void                      * &pkt_base,
-		                      Genode::size_t               pkt_size);
+		void _send_submit_pkt(Packet_descriptor   &pkt,
+		                      void              * &pkt_base,
+		                      Genode::size_t       pkt_size);
 
 		void _update_dhcp_allocations(Domain &old_domain,
                                       Domain &new_domain);
@@ -392,7 +424,9 @@ class Net::Interface : private Interface_list::Element
 		void dhcp_allocation_expired(Dhcp_allocation &allocation);
 
 		template <typename FUNC>
-		void send(Genode::size_t pkt_size, FUNC && write_to_pkt)
+		void send(Genode::size_t            pkt_size,
+		          Packet_descriptor const  &offload_info,
+		          FUNC                    &&write_to_pkt)
 		{
 			if (!link_state()) {
 				_failed_to_send_packet_link();
@@ -405,6 +439,7 @@ class Net::Interface : private Interface_list::Element
 				_send_alloc_pkt(pkt, pkt_base, pkt_size);
 				Size_guard size_guard(pkt_size);
 				write_to_pkt(pkt_base, size_guard);
+				pkt.offload_info(offload_info);
 				_send_submit_pkt(pkt, pkt_base, pkt_size);
 			}
 			catch (Packet_stream_source::Packet_alloc_failed) {
@@ -412,8 +447,20 @@ class Net::Interface : private Interface_list::Element
 			}
 		}
 
-		void send(Ethernet_frame &eth,
-		          Size_guard     &size_guard);
+		template <typename FUNC>
+		void send(Genode::size_t pkt_size, FUNC && write_to_pkt)
+		{
+			send(pkt_size, Packet_descriptor(), write_to_pkt);
+		}
+
+		void send(Ethernet_frame          &eth,
+		          Size_guard              &size_guard,
+		          Packet_descriptor const &offload_info = Packet_descriptor());
+
+		/**
+		 * Enable the offload features requested by the client
+		 */
+		Nic::Offload offload(Nic::Offload requested);
 
 		Link_list &dissolved_links(L3_protocol const protocol);
 
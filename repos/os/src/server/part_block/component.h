@@ -57,16 +57,48 @@ class Block::Session_component : public  Block::Session_rpc_object,
 		Block::Driver                    &_driver;
 		bool                              _writeable;
 
+		Registry<Block_dispatcher>::Element _dispatcher_elem { _driver.dispatchers(), *this };
+
+		/*
+		 * Acknowledgements that did not fit into the ack queue, they are
+		 * delivered as soon as the client frees ack slots
+		 */
+		enum { MAX_PENDING_ACKS = Session::TX_QUEUE_SIZE };
+
+		Packet_descriptor _pending_acks[MAX_PENDING_ACKS];
+		unsigned          _pending_head { 0 };
+		unsigned          _pending_cnt  { 0 };
+
+		void _flush_acks()
+		{
+			for (; _pending_cnt; _pending_cnt--, _p_in_fly--) {
+				if (!tx_sink()->try_ack_packet(_pending_acks[_pending_head]))
+					return;
+
+				_pending_head = (_pending_head + 1) % MAX_PENDING_ACKS;
+			}
+		}
+
 		/**
 		 * Acknowledge a packet already handled
 		 */
 		inline void _ack_packet(Packet_descriptor &packet)
 		{
-			if (!tx_sink()->ready_to_ack())
-				error("Not ready to ack!");
+			/* preserve the order of acknowledgements */
+			if (!_pending_cnt && tx_sink()->try_ack_packet(packet)) {
+				_p_in_fly--;
+				return;
+			}
 
-			tx_sink()->acknowledge_packet(packet);
-			_p_in_fly--;
+			/* the number of packets in flight is limited by the queue size */
+			if (_pending_cnt == MAX_PENDING_ACKS) {
+				error("ack queue overflow, dropping acknowledgement");
+				_p_in_fly--;
+				return;
+			}
+
+			_pending_acks[(_pending_head + _pending_cnt) % MAX_PENDING_ACKS] = packet;
+			_pending_cnt++;
 		}
 
 		/**
@@ -92,6 +124,15 @@ class Block::Session_component : public  Block::Session_rpc_object,
 			sector_t const off = _p_to_handle.block_number() + _partition->lba;
 			size_t   const cnt = _p_to_handle.block_count();
 
+			/* retry the request once the back end is ready again */
+			auto wait_for_driver = [&] ()
+			{
+				if (!_req_queue_full) {
+					_req_queue_full = true;
+					Session_component::wait_queue().insert(this);
+				}
+			};
+
 			auto perform_io = [&] ()
 			{
 				bool const write =
@@ -102,10 +143,7 @@ class Block::Session_component : public  Block::Session_rpc_object,
 					           tx_sink()->packet_content(_p_to_handle),
 					           *this, _p_to_handle);
 				} catch (Block::Session::Tx::Source::Packet_alloc_failed) {
-					if (!_req_queue_full) {
-						_req_queue_full = true;
-						Session_component::wait_queue().insert(this);
-					}
+					wait_for_driver();
 				} catch (Genode::Packet_descriptor::Invalid_packet) {
 					Genode::error("dropping invalid Block packet");
 					_p_to_handle = Packet_descriptor();
@@ -129,7 +167,9 @@ class Block::Session_component : public  Block::Session_rpc_object,
 				break;
 
 			case Packet_descriptor::SYNC:
-				_driver.sync_all(*this, _p_to_handle);
+				try { _driver.sync_all(*this, _p_to_handle); }
+				catch (Block::Session::Tx::Source::Packet_alloc_failed) {
+					wait_for_driver(); }
 				break;
 
 			case Packet_descriptor::TRIM:
@@ -157,12 +197,20 @@ class Block::Session_component : public  Block::Session_rpc_object,
 					 !_ack_queue_full; _p_in_fly++,
 					 _ack_queue_full = _p_in_fly >= tx_sink()->ack_slots_free())
 					_handle_packet(tx_sink()->get_packet());
+
+			/* signal the back end and the client once per batch */
+			_driver.wakeup();
+			wakeup_client();
 		}
 
 		/**
 		 * Triggered when an ack got removed from the full ack queue
 		 */
-		void _ready_to_ack() { _packet_avail(); }
+		void _ready_to_ack()
+		{
+			_flush_acks();
+			_packet_avail();
+		}
 
 	public:
 
@@ -223,6 +271,8 @@ class Block::Session_component : public  Block::Session_rpc_object,
 				_packet_avail();
 		}
 
+		void wakeup_client() override { tx_sink()->wakeup(); }
+
 		static List<Session_component>& wait_queue()
 		{
 			static List<Session_component> l;
@@ -236,6 +286,11 @@ class Block::Session_component : public  Block::Session_rpc_object,
 				wait_queue().remove(c);
 				c->_req_queue_full = false;
 				c->_handle_packet(c->_p_to_handle);
+
+				/* the back end is still busy, the session waits again */
+				if (c->_req_queue_full)
+					return;
+
 				c->_packet_avail();
 			}
 		}
@@ -17,9 +17,10 @@
 #include <base/env.h>
 #include <base/allocator_avl.h>
 #include <base/signal.h>
-#include <base/tslab.h>
 #include <base/heap.h>
-#include <util/list.h>
+#include <base/registry.h>
+#include <base/log.h>
+#include <util/reconstructible.h>
 #include <block_session/connection.h>
 
 namespace Block {
@@ -31,6 +32,11 @@ namespace Block {
 struct Block::Block_dispatcher : Genode::Interface
 {
 	virtual void dispatch(Packet_descriptor&, Packet_descriptor&) = 0;
+
+	/**
+	 * Deliver pending signals to the client after a batch of dispatches
+	 */
+	virtual void wakeup_client() = 0;
 };
 
 
@@ -45,11 +51,17 @@ class Block::Driver
 {
 	public:
 
-	class Request : public Genode::List<Request>::Element
+	class Request
 	{
 		private:
 
-			Block_dispatcher &_dispatcher;
+			/*
+			 * Noncopyable
+			 */
+			Request(Request const &);
+			Request &operator = (Request const &);
+
+			Block_dispatcher *_dispatcher;
 			Packet_descriptor _cli;
 			Packet_descriptor _srv;
 
@@ -58,31 +70,48 @@ class Block::Driver
 			Request(Block_dispatcher &d,
 			        Packet_descriptor const &cli,
 			        Packet_descriptor const &srv)
-			: _dispatcher(d), _cli(cli), _srv(srv) {}
+			: _dispatcher(&d), _cli(cli), _srv(srv) {}
 
 			bool handle(Packet_descriptor& reply)
 			{
 				bool ret = (reply == _srv);
-				if (ret) _dispatcher.dispatch(_cli, reply);
+				if (ret && _dispatcher) _dispatcher->dispatch(_cli, reply);
 				return ret;
 			}
 
 			bool same_dispatcher(Block_dispatcher &same) {
-				return &same == &_dispatcher; }
+				return &same == _dispatcher; }
+
+			/**
+			 * Detach request from its vanished client
+			 *
+			 * The request stays allocated until the back end acknowledges
+			 * it to prevent the reuse of its tag.
+			 */
+			void orphan() { _dispatcher = nullptr; }
 	};
 
 	private:
 
-		enum { BLK_SZ = Session::TX_QUEUE_SIZE*sizeof(Request) };
+		/*
+		 * Outstanding back-end requests are kept in a fixed array indexed
+		 * by the tag of the back-end packet. Hence, acknowledgements are
+		 * matched to their requests in constant time regardless of the
+		 * number of requests in flight and the order of their completion.
+		 */
+		enum { MAX_REQUESTS = Session::TX_QUEUE_SIZE };
+
+		Genode::Constructible<Request> _requests[MAX_REQUESTS];
+		unsigned                       _free_slots[MAX_REQUESTS];
+		unsigned                       _free_cnt { 0 };
 
-		Genode::Tslab<Request, BLK_SZ> _r_slab;
-		Genode::List<Request>          _r_list { };
 		Genode::Allocator_avl          _block_alloc;
 		Block::Connection<>            _session;
 		Block::Session::Info     const _info { _session.info() };
 		Genode::Signal_handler<Driver> _source_ack;
 		Genode::Signal_handler<Driver> _source_submit;
-		unsigned long                  _tag_cnt { 0 };
+
+		Genode::Registry<Block_dispatcher> _dispatchers { };
 
 		void _ready_to_submit();
 
@@ -91,39 +120,78 @@ class Block::Driver
 			/* check for acknowledgements */
 			while (_session.tx()->ack_avail()) {
 				Packet_descriptor p = _session.tx()->get_acked_packet();
-				for (Request *r = _r_list.first(); r; r = r->next()) {
-					if (r->handle(p)) {
-						_r_list.remove(r);
-						Genode::destroy(&_r_slab, r);
-						break;
-					}
+				unsigned long const slot = p.tag().value;
+
+				/*
+				 * The back end is done with the request, so its slot is
+				 * freed even if the acknowledgement does not match.
+				 */
+				if (slot < MAX_REQUESTS && _requests[slot].constructed()) {
+					if (!_requests[slot]->handle(p))
+						Genode::warning("unexpected acknowledgement of request ", slot);
+					_free_tag(p.tag());
 				}
 				_session.tx()->release_packet(p);
 			}
 
+			/* signal all clients that received acknowledgements at once */
+			_dispatchers.for_each([&] (Block_dispatcher &d) {
+				d.wakeup_client(); });
+
 			_ready_to_submit();
 		}
 
+		/**
+		 * Allocate request slot, the slot index is used as packet tag
+		 *
+		 * \throw Packet_alloc_failed  all request slots are in use
+		 */
 		Block::Session::Tag _alloc_tag()
 		{
-			/*
-			 * The wrapping of '_tag_cnt' is no problem because the number
-			 * of consecutive outstanding requests is much lower than the
-			 * value range of tags.
-			 */
-			_tag_cnt++;
-			return Block::Session::Tag { _tag_cnt };
+			if (!_free_cnt)
+				throw Block::Session::Tx::Source::Packet_alloc_failed();
+
+			return Block::Session::Tag { _free_slots[--_free_cnt] };
+		}
+
+		void _free_tag(Block::Session::Tag tag)
+		{
+			_requests[tag.value].destruct();
+			_free_slots[_free_cnt++] = (unsigned)tag.value;
+		}
+
+		/**
+		 * Submit request to the back end
+		 *
+		 * \throw Packet_alloc_failed  submit queue is full, the caller
+		 *                             retries once the back end is ready
+		 */
+		void _submit(Block_dispatcher &dispatcher, Packet_descriptor const &cli,
+		             Packet_descriptor const &srv)
+		{
+			_requests[srv.tag().value].construct(dispatcher, cli, srv);
+
+			if (_session.tx()->try_submit_packet(srv))
+				return;
+
+			_free_tag(srv.tag());
+			if (srv.size())
+				_session.tx()->release_packet(srv);
+
+			throw Block::Session::Tx::Source::Packet_alloc_failed();
 		}
 
 	public:
 
 		Driver(Genode::Env &env, Genode::Heap &heap)
-		: _r_slab(&heap),
-		  _block_alloc(&heap),
+		: _block_alloc(&heap),
 		  _session(env, &_block_alloc, 4 * 1024 * 1024),
 		  _source_ack(env.ep(), *this, &Driver::_ack_avail),
 		  _source_submit(env.ep(), *this, &Driver::_ready_to_submit)
-		{ }
+		{
+			for (unsigned i = 0; i < MAX_REQUESTS; i++)
+				_free_slots[_free_cnt++] = MAX_REQUESTS - 1 - i;
+		}
 
 		Genode::size_t blk_size()  const { return _info.block_size; }
 		Genode::size_t blk_cnt()   const { return _info.block_count; }
@@ -131,63 +199,61 @@ class Block::Driver
 
 		Session_client& session() { return _session;  }
 
+		Genode::Registry<Block_dispatcher> &dispatchers() {
+			return _dispatchers; }
+
 		void work_asynchronously()
 		{
 			_session.tx_channel()->sigh_ack_avail(_source_ack);
 			_session.tx_channel()->sigh_ready_to_submit(_source_submit);
 		}
 
+		/**
+		 * Notify back end about a batch of submitted requests
+		 */
+		void wakeup() { _session.tx()->wakeup(); }
+
 		static Driver& driver();
 
 		void io(bool write, sector_t nr, Genode::size_t cnt, void* addr,
 		        Block_dispatcher &dispatcher, Packet_descriptor& cli)
 		{
-			if (!_session.tx()->ready_to_submit())
+			if (!_session.tx()->ready_to_submit() || !_free_cnt)
 				throw Block::Session::Tx::Source::Packet_alloc_failed();
 
 			Block::Packet_descriptor::Opcode op = write
 			    ? Block::Packet_descriptor::WRITE
 			    : Block::Packet_descriptor::READ;
 			Genode::size_t const size = _info.block_size * cnt;
-			Packet_descriptor p(_session.alloc_packet(size),
-			                    op,  nr, cnt, _alloc_tag());
-			Request *r = new (&_r_slab) Request(dispatcher, cli, p);
-			_r_list.insert(r);
+
+			/* allocate the packet first to not lose the tag if it fails */
+			Packet_descriptor const packet = _session.alloc_packet(size);
+			Packet_descriptor p(packet, op,  nr, cnt, _alloc_tag());
 
 			if (write)
 				Genode::memcpy(_session.tx()->packet_content(p),
 				               addr, size);
 
-			_session.tx()->submit_packet(p);
+			_submit(dispatcher, cli, p);
 		}
 
 		void sync_all(Block_dispatcher &dispatcher, Packet_descriptor &cli)
 		{
-			if (!_session.tx()->ready_to_submit())
+			if (!_session.tx()->ready_to_submit() || !_free_cnt)
 				throw Block::Session::Tx::Source::Packet_alloc_failed();
 
 			Packet_descriptor const p =
 				Block::Session::sync_all_packet_descriptor(_info, _alloc_tag());
 
-			_r_list.insert(new (&_r_slab) Request(dispatcher, cli, p));
-
-			_session.tx()->submit_packet(p);
+			_submit(dispatcher, cli, p);
 		}
 
 		void remove_dispatcher(Block_dispatcher &dispatcher)
 		{
-			for (Request *r = _r_list.first(); r;) {
-				if (!r->same_dispatcher(dispatcher)) {
-					r = r->next();
-					continue;
-				}
-
-				Request *remove = r;
-				r = r->next();
-
-				_r_list.remove(remove);
-				Genode::destroy(&_r_slab, remove);
-			}
+			for (unsigned i = 0; i < MAX_REQUESTS; i++)
+				if (_requests[i].constructed()
+				 && _requests[i]->same_dispatcher(dispatcher))
+					_requests[i]->orphan();
 		}
 };
 
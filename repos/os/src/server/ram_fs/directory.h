@@ -29,28 +29,16 @@ class Ram_fs::Directory : public Node
 {
 	private:
 
-		List<Node> _entries { };
-		size_t     _num_entries = 0;
-
-		Node *_entry_unsynchronized(size_t index)
-		{
-			Node *node = _entries.first();
-			for (unsigned i = 0; i < index && node; node = node->next(), i++);
-			return node;
-		}
+		File_system::Dir_index<Node> _entries;
 
 	public:
 
-		Directory(char const *name) { Node::name(name); }
+		Directory(Allocator &alloc, char const *name)
+		: _entries(alloc) { Node::name(name); }
 
 		bool has_sub_node_unsynchronized(char const *name) const override
 		{
-			Node const *sub_node = _entries.first();
-			for (; sub_node; sub_node = sub_node->next())
-				if (strcmp(sub_node->name(), name) == 0)
-					return true;
-
-			return false;
+			return _entries.lookup(name) != nullptr;
 		}
 
 		void adopt_unsynchronized(Node *node) override
@@ -58,8 +46,7 @@ class Ram_fs::Directory : public Node
 			/*
 			 * XXX inc ref counter
 			 */
-			_entries.insert(node);
-			_num_entries++;
+			_entries.insert(*node);
 
 			mark_as_updated();
 			notify_listeners();
@@ -67,8 +54,18 @@ class Ram_fs::Directory : public Node
 
 		void discard(Node *node) override
 		{
-			_entries.remove(node);
-			_num_entries--;
+			_entries.remove(*node);
+
+			mark_as_updated();
+			notify_listeners();
+		}
+
+		void rename_sub_node(Node *node, char const *name) override
+		{
+			/* re-insert the node to index it under its new name */
+			_entries.remove(*node);
+			node->name(name);
+			_entries.insert(*node);
 
 			mark_as_updated();
 			notify_listeners();
@@ -102,11 +99,7 @@ class Ram_fs::Directory : public Node
 			 */
 
 			/* try to find entry that matches the first path element */
-			Node *sub_node = _entries.first();
-			for (; sub_node; sub_node = sub_node->next())
-				if ((strlen(sub_node->name()) == i) &&
-					(strcmp(sub_node->name(), path, i) == 0))
-					break;
+			Node *sub_node = _entries.lookup(path, i);
 
 			if (!sub_node)
 				throw File_system::Lookup_failed();
@@ -197,7 +190,7 @@ class Ram_fs::Directory : public Node
 				return 0;
 			}
 
-			Node *node = _entry_unsynchronized(index);
+			Node *node = _entries.at(index);
 
 			/* index out of range */
 			if (!node)
@@ -226,7 +219,7 @@ class Ram_fs::Directory : public Node
 		{
 			Status s;
 			s.inode = inode();
-			s.size = _num_entries * sizeof(File_system::Directory_entry);
+			s.size = _entries.count() * sizeof(File_system::Directory_entry);
 			s.mode = File_system::Status::MODE_DIRECTORY;
 			return s;
 		}
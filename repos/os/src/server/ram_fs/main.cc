@@ -15,6 +15,7 @@
 #include <file_system/open_node.h>
 #include <file_system_session/rpc_object.h>
 #include <base/component.h>
+#include <base/attached_dataspace.h>
 #include <base/attached_rom_dataspace.h>
 #include <base/heap.h>
 #include <root/component.h>
@@ -46,15 +47,60 @@ class Ram_fs::Session_component : public File_system::Session_rpc_object
 
 		typedef File_system::Open_node<Node> Open_node;
 
+		/**
+		 * Copy of the file content handed out by 'dataspace'
+		 *
+		 * A snapshot is indexed by the file handle it was requested for and
+		 * freed when the handle is closed. It is paid from the RAM quota of
+		 * the session.
+		 */
+		struct Snapshot
+		{
+			typedef Id_space<Snapshot> Space;
+
+			Space::Element const           elem;
+			Ram_dataspace_capability const ds;
+			Listener::Version const        version;
+			size_t const                   quota;
+
+			Snapshot(Space &space, File_handle handle,
+			         Ram_dataspace_capability ds, Listener::Version version,
+			         size_t quota)
+			:
+				elem(*this, space, Space::Id { handle.value }),
+				ds(ds), version(version), quota(quota)
+			{ }
+		};
+
 		Genode::Entrypoint               &_ep;
 		Genode::Ram_allocator            &_ram;
+		Genode::Region_map               &_rm;
 		Genode::Allocator                &_alloc;
 		Directory                        &_root;
 		Id_space<File_system::Node>       _open_node_registry { };
+		Snapshot::Space                   _snapshots { };
 		bool                              _writable;
 
+		/* RAM quota of the session still available for snapshots */
+		size_t _snapshot_quota;
+
 		Signal_handler<Session_component> _process_packet_handler;
 
+		void _free_snapshot(Snapshot &snapshot)
+		{
+			_snapshot_quota += snapshot.quota;
+			_ram.free(snapshot.ds);
+			destroy(_alloc, &snapshot);
+		}
+
+		void _free_snapshot(Node_handle handle)
+		{
+			try {
+				_snapshots.apply<Snapshot>(Snapshot::Space::Id { handle.value },
+					[&] (Snapshot &snapshot) { _free_snapshot(snapshot); });
+			} catch (Snapshot::Space::Unknown_id) { }
+		}
+
 
 		/******************************
 		 ** Packet-stream processing **
@@ -196,14 +242,17 @@ class Ram_fs::Session_component : public File_system::Session_rpc_object
 		Session_component(size_t tx_buf_size, Genode::Entrypoint &ep,
 		                  Genode::Ram_allocator &ram, Genode::Region_map &rm,
 		                  Genode::Allocator &alloc,
-		                  Directory &root, bool writable)
+		                  Directory &root, bool writable,
+		                  size_t snapshot_quota)
 		:
 			Session_rpc_object(ram.alloc(tx_buf_size), rm, ep.rpc_ep()),
 			_ep(ep),
 			_ram(ram),
+			_rm(rm),
 			_alloc(alloc),
 			_root(root),
 			_writable(writable),
+			_snapshot_quota(snapshot_quota),
 			_process_packet_handler(_ep, *this, &Session_component::_process_packets)
 		{
 			/*
@@ -219,9 +268,17 @@ class Ram_fs::Session_component : public File_system::Session_rpc_object
 		 */
 		~Session_component()
 		{
+			while (_snapshots.apply_any<Snapshot>([&] (Snapshot &snapshot) {
+				_free_snapshot(snapshot); }));
+
 			Dataspace_capability ds = tx_sink()->dataspace();
 			_ram.free(static_cap_cast<Ram_dataspace>(ds));
 		}
+		/**
+		 * Increase quota available for snapshots by session upgrade
+		 */
+		void upgrade(size_t ram_quota) { _snapshot_quota += ram_quota; }
+
 
 
 		/***************************
@@ -265,7 +322,7 @@ class Ram_fs::Session_component : public File_system::Session_rpc_object
 				File *file = dir->lookup_file(name.string());
 
 				Open_node *open_file =
-					new (_alloc) Open_node(file->weak_ptr(), _open_node_registry);
+					new (_alloc) Open_node(file->weak_ptr(), _open_node_registry, mode);
 
 				return open_file->id();
 			};
@@ -350,7 +407,7 @@ class Ram_fs::Session_component : public File_system::Session_rpc_object
 					throw Node_already_exists();
 
 				try {
-					parent->adopt_unsynchronized(new (_alloc) Directory(name));
+					parent->adopt_unsynchronized(new (_alloc) Directory(_alloc, name));
 				} catch (Allocator::Out_of_memory) {
 					throw No_space();
 				}
@@ -397,6 +454,7 @@ class Ram_fs::Session_component : public File_system::Session_rpc_object
 		void close(Node_handle handle) override
 		{
 			auto close_fn = [&] (Open_node &open_node) {
+				_free_snapshot(handle);
 				destroy(_alloc, &open_node);
 			};
 
@@ -496,9 +554,11 @@ class Ram_fs::Session_component : public File_system::Session_rpc_object
 						throw Unavailable();
 
 					Node *node = from_dir->lookup(from_name.string());
-					node->name(to_name.string());
 
-					if (!(open_to_dir_node.node() == open_from_dir_node.node())) {
+					if (open_to_dir_node.node() == open_from_dir_node.node()) {
+						from_dir->rename_sub_node(node, to_name.string());
+
+					} else {
 
 						Locked_ptr<Node> to_dir { open_to_dir_node.node() };
 
@@ -506,6 +566,7 @@ class Ram_fs::Session_component : public File_system::Session_rpc_object
 							throw Unavailable();
 
 						from_dir->discard(node);
+						node->name(to_name.string());
 						to_dir->adopt_unsynchronized(node);
 
 						node->mark_as_updated();
@@ -526,6 +587,67 @@ class Ram_fs::Session_component : public File_system::Session_rpc_object
 				throw Invalid_handle();
 			}
 		}
+
+		Dataspace_capability dataspace(File_handle file_handle) override
+		{
+			auto dataspace_fn = [&] (Open_node &open_node) {
+
+				Locked_ptr<Node> node { open_node.node() };
+				if (!node.valid())
+					throw Unavailable();
+
+				Status const status = node->status();
+				if (status.mode != Status::MODE_FILE)
+					throw Invalid_handle();
+
+				if (open_node.mode() != READ_ONLY && open_node.mode() != READ_WRITE)
+					throw Permission_denied();
+
+				/* hand out the previous snapshot if the file is unchanged */
+				Dataspace_capability ds;
+				try {
+					_snapshots.apply<Snapshot>(Snapshot::Space::Id { file_handle.value },
+						[&] (Snapshot &snapshot) {
+							if (snapshot.version.value == node->curr_version().value)
+								ds = snapshot.ds;
+							else
+								_free_snapshot(snapshot);
+						});
+				} catch (Snapshot::Space::Unknown_id) { }
+
+				if (ds.valid())
+					return ds;
+
+				/* the dataspace must be valid even if the file is empty */
+				size_t const ds_size = max((size_t)status.size, (size_t)1);
+				size_t const quota   = align_addr(ds_size, 12) + sizeof(Snapshot);
+
+				if (quota > _snapshot_quota)
+					throw Out_of_ram();
+
+				Ram_dataspace_capability const ram_ds = _ram.alloc(ds_size);
+
+				try {
+					Attached_dataspace content(_rm, ram_ds);
+					node->read(content.local_addr<char>(), (size_t)status.size, 0);
+
+					new (_alloc) Snapshot(_snapshots, file_handle, ram_ds,
+					                      node->curr_version(), quota);
+					_snapshot_quota -= quota;
+				}
+				catch (Out_of_ram)  { _ram.free(ram_ds); throw; }
+				catch (Out_of_caps) { _ram.free(ram_ds); throw; }
+				catch (...)         { _ram.free(ram_ds); throw Unavailable(); }
+
+				return Dataspace_capability(ram_ds);
+			};
+
+			try {
+				return _open_node_registry.apply<Open_node>(file_handle, dataspace_fn);
+			} catch (Id_space<File_system::Node>::Unknown_id const &) {
+				throw Invalid_handle();
+			}
+		}
 };
 
 
@@ -630,7 +752,13 @@ class Ram_fs::Root : public Root_component<Session_component>
 			}
 			return new (md_alloc())
 				Session_component(tx_buf_size, _ep, _ram, _rm, _alloc,
-				                  *session_root_dir, writeable);
+				                  *session_root_dir, writeable,
+				                  ram_quota - session_size);
+		}
+
+		void _upgrade_session(Session_component *s, const char *args) override
+		{
+			s->upgrade(Arg_string::find_arg(args, "ram_quota").ulong_value(0));
 		}
 
 	public:
@@ -676,7 +804,7 @@ static void preload_content(Genode::Env            &env,
 		 */
 		if (sub_node.has_type("dir")) {
 
-			Ram_fs::Directory *sub_dir = new (&alloc) Ram_fs::Directory(name.string());
+			Ram_fs::Directory *sub_dir = new (&alloc) Ram_fs::Directory(alloc, name.string());
 
 			/* traverse into the new directory */
 			preload_content(env, alloc, sub_node, *sub_dir);
@@ -726,8 +854,6 @@ struct Ram_fs::Main
 {
 	Genode::Env &_env;
 
-	Directory _root_dir { "" };
-
 	Genode::Attached_rom_dataspace _config { _env, "config" };
 
 	/*
@@ -737,6 +863,8 @@ struct Ram_fs::Main
 
 	Genode::Heap _heap { _env.ram(), _env.rm() };
 
+	Directory _root_dir { _heap, "" };
+
 	Root _fs_root { _env.ep(), _env.ram(), _env.rm(), _config.xml(),
 	                _sliced_heap, _heap, _root_dir };
 
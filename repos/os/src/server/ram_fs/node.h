@@ -17,7 +17,7 @@
 /* Genode includes */
 #include <file_system/listener.h>
 #include <file_system/node.h>
-#include <util/list.h>
+#include <ram_fs/dir_index.h>
 
 namespace Ram_fs {
 	using namespace Genode;
@@ -31,19 +31,18 @@ namespace Ram_fs {
 
 class Ram_fs::Node : public  File_system::Node_base,
                      private Weak_object<Node>,
-                     private List<Node>::Element
+                     private File_system::Dir_index<Node>::Element
 {
 	public:
 
 		typedef char Name[128];
 
-		using List<Node>::Element::next;
 		using Weak_object<Node>::weak_ptr;
 
 	private:
 
-		friend class List<Node>;
 		friend class Locked_ptr<Node>;
+		friend class File_system::Dir_index<Node>;
 
 		int                 _ref_count;
 		Name                _name;
@@ -124,6 +123,11 @@ class Ram_fs::Node : public  File_system::Node_base,
 			Genode::error(__PRETTY_FUNCTION__, " called on a non-directory node");
 		}
 
+		virtual void rename_sub_node(Node *, char const *)
+		{
+			Genode::error(__PRETTY_FUNCTION__, " called on a non-directory node");
+		}
+
 
 };
 
@@ -18,6 +18,7 @@
 #include <report_rom/report_service.h>
 #include <base/attached_rom_dataspace.h>
 #include <base/component.h>
+#include <rm_session/connection.h>
 
 /* local includes */
 #include "rom_registry.h"
@@ -32,7 +33,37 @@ struct Report_rom::Main
 
 	Genode::Sliced_heap sliced_heap { env.ram(), env.rm() };
 
-	Rom::Registry rom_registry { sliced_heap, env.ram(), env.rm(), config_rom };
+	/*
+	 * RM session used to hand out module snapshots read-only to multiple
+	 * readers, without it each reader obtains a private copy
+	 *
+	 * The session quota and its upgrades on the creation of snapshots are
+	 * paid from the component's own RAM, like the modules' backing store.
+	 */
+	Genode::Constructible<Genode::Rm_connection> rm_connection { };
+
+	Genode::Rm_session *init_rm_session()
+	{
+		using namespace Genode;
+
+		char const *reason = nullptr;
+
+		try {
+			rm_connection.construct(env);
+			return &*rm_connection;
+		}
+		catch (Service_denied)         { reason = "denied"; }
+		catch (Out_of_ram)             { reason = "out of RAM"; }
+		catch (Out_of_caps)            { reason = "out of caps"; }
+		catch (Insufficient_ram_quota) { reason = "insufficient RAM quota"; }
+		catch (Insufficient_cap_quota) { reason = "insufficient cap quota"; }
+
+		warning("RM session unavailable (", reason, "), snapshot sharing disabled");
+		return nullptr;
+	}
+
+	Rom::Registry rom_registry { sliced_heap, env.ram(), env.rm(),
+	                             init_rm_session(), config_rom };
 
 	Genode::Attached_rom_dataspace config_rom { env, "config" };
 
@@ -25,12 +25,35 @@ struct Rom::Registry : Registry_for_reader, Registry_for_writer, Genode::Noncopy
 {
 	private:
 
+		/*
+		 * Noncopyable
+		 */
+		Registry(Registry const &);
+		Registry &operator = (Registry const &);
+
 		Genode::Allocator              &_md_alloc;
 		Genode::Ram_allocator          &_ram;
 		Genode::Region_map             &_rm;
+		Genode::Rm_session      * const _rm_session;
 		Genode::Attached_rom_dataspace &_config_rom;
 
-		Module_list _modules { };
+		/*
+		 * Modules are kept in buckets indexed by the hash of their name
+		 */
+		enum { NUM_BUCKETS = 64 };
+
+		Module_list _buckets[NUM_BUCKETS] { };
+
+		static Module_list &_bucket(Module_list (&buckets)[NUM_BUCKETS],
+		                            Module::Name const &name)
+		{
+			/* FNV-1a */
+			unsigned long hash = 2166136261UL;
+			for (char const *s = name.string(); *s; s++)
+				hash = (hash ^ (unsigned char)*s) * 16777619UL;
+
+			return buckets[hash % NUM_BUCKETS];
+		}
 
 		struct Read_write_policy : Module::Read_policy, Module::Write_policy
 		{
@@ -62,7 +85,9 @@ struct Rom::Registry : Registry_for_reader, Registry_for_writer, Genode::Noncopy
 
 		Module &_lookup(Module::Name const name)
 		{
-			for (Module *m = _modules.first(); m; m = m->next())
+			Module_list &modules = _bucket(_buckets, name);
+
+			for (Module *m = modules.first(); m; m = m->next())
 				if (m->_has_name(name))
 					return *m;
 
@@ -71,10 +96,13 @@ struct Rom::Registry : Registry_for_reader, Registry_for_writer, Genode::Noncopy
 			/* XXX proper accounting for the used memory is missing */
 			/* XXX if we run out of memory, the server will abort */
 
-			Module * const module = new (&_md_alloc)
-				Module(_ram, _rm, name, _read_write_policy, _read_write_policy);
+			Module * const module = _rm_session
+				? new (&_md_alloc) Module(_ram, _rm, _md_alloc, *_rm_session, name,
+				                          _read_write_policy, _read_write_policy)
+				: new (&_md_alloc) Module(_ram, _rm, name,
+				                          _read_write_policy, _read_write_policy);
 
-			_modules.insert(module);
+			modules.insert(module);
 			return *module;
 		}
 
@@ -83,7 +111,7 @@ struct Rom::Registry : Registry_for_reader, Registry_for_writer, Genode::Noncopy
 			if (module._in_use())
 				return;
 
-			_modules.remove(&module);
+			_bucket(_buckets, module.name()).remove(&module);
 			Genode::destroy(&_md_alloc, const_cast<Module *>(&module));
 		}
 
@@ -135,9 +163,11 @@ struct Rom::Registry : Registry_for_reader, Registry_for_writer, Genode::Noncopy
 
 		Registry(Genode::Allocator &md_alloc,
 		         Genode::Ram_allocator &ram, Genode::Region_map &rm,
+		         Genode::Rm_session *rm_session,
 		         Genode::Attached_rom_dataspace &config_rom)
 		:
-			_md_alloc(md_alloc), _ram(ram), _rm(rm), _config_rom(config_rom)
+			_md_alloc(md_alloc), _ram(ram), _rm(rm), _rm_session(rm_session),
+			_config_rom(config_rom)
 		{ }
 
 		Module &lookup(Writer &writer, Module::Name const &name) override
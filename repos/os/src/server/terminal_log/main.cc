@@ -18,11 +18,13 @@
 
 #include <terminal_session/connection.h>
 #include <log_session/log_session.h>
+#include <os/log_ring_buffer.h>
 
 
 namespace Genode {
 
-	class Termlog_component : public Rpc_object<Log_session>
+	class Termlog_component : public Rpc_object<Log_session>,
+	                          private Log_ring_buffer::Output
 	{
 		public:
 
@@ -33,18 +35,7 @@ namespace Genode {
 			char                  _label[LABEL_LEN];
 			Terminal::Connection &_terminal;
 
-		public:
-
-			/**
-			 * Constructor
-			 */
-			Termlog_component(const char *label, Terminal::Connection &terminal)
-			: _terminal(terminal) { snprintf(_label, LABEL_LEN, "[%s] ", label); }
-
-
-			/*****************
-			 ** Log session **
-			 *****************/
+			Log_ring_buffer _ring;
 
 			/**
 			 * Write a log-message to the terminal.
@@ -52,14 +43,8 @@ namespace Genode {
 			 * The following function's code is a modified variant of the one in:
 			 * 'base/src/core/include/log_session_component.h'
 			 */
-			size_t write(String const &string_buf) override
+			size_t _output(char const *string)
 			{
-				if (!(string_buf.valid_string())) {
-					Genode::error("corrupted string");
-					return 0;
-				}
-
-				char const *string = string_buf.string();
 				int len = strlen(string);
 
 				/*
@@ -88,6 +73,52 @@ namespace Genode {
 
 				return len;
 			}
+
+			/**
+			 * Log_ring_buffer::Output interface
+			 */
+			void output_from_ring(char const *string) override { _output(string); }
+
+		public:
+
+			/**
+			 * Constructor
+			 */
+			Termlog_component(Env &env, const char *label,
+			                  Terminal::Connection &terminal)
+			:
+				_terminal(terminal), _ring(env.ram(), env.rm(), env.ep(), *this)
+			{
+				snprintf(_label, LABEL_LEN, "[%s] ", label);
+			}
+
+			~Termlog_component() { _ring.drain(); }
+
+			void upgrade(size_t ram_quota) { _ring.upgrade(ram_quota); }
+
+
+			/*****************
+			 ** Log session **
+			 *****************/
+
+			size_t write(String const &string_buf) override
+			{
+				if (!(string_buf.valid_string())) {
+					Genode::error("corrupted string");
+					return 0;
+				}
+
+				/* output the messages of the ring first to retain the order */
+				_ring.drain();
+
+				return _output(string_buf.string());
+			}
+
+			Dataspace_capability ring(size_t size) override {
+				return _ring.dataspace(size); }
+
+			Signal_context_capability ring_sigh() override {
+				return _ring.sigh(); }
 	};
 
 
@@ -95,6 +126,7 @@ namespace Genode {
 	{
 		private:
 
+			Env                 &_env;
 			Terminal::Connection _terminal;
 
 		protected:
@@ -117,7 +149,12 @@ namespace Genode {
 				Arg label_arg = Arg_string::find_arg(args, "label");
 				label_arg.string(label_buf, sizeof(label_buf), "");
 
-				return new (md_alloc()) Termlog_component(label_buf, _terminal);
+				return new (md_alloc()) Termlog_component(_env, label_buf, _terminal);
+			}
+
+			void _upgrade_session(Termlog_component *s, const char *args) override
+			{
+				s->upgrade(Arg_string::find_arg(args, "ram_quota").ulong_value(0));
 			}
 
 		public:
@@ -130,7 +167,7 @@ namespace Genode {
 			 */
 			Termlog_root(Genode::Env &env, Allocator &md_alloc)
 			: Root_component<Termlog_component>(env.ep(), md_alloc),
-			  _terminal(env, "log") { }
+			  _env(env), _terminal(env, "log") { }
 	};
 }
 
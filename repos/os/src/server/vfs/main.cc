@@ -23,6 +23,7 @@
 #include <os/session_policy.h>
 #include <base/allocator_guard.h>
 #include <util/fifo.h>
+#include <util/reconstructible.h>
 #include <vfs/simple_env.h>
 
 /* Local includes */
@@ -36,11 +37,34 @@ namespace Vfs_server {
 
 	class Session_resources;
 	class Session_component;
+	class Io_progress_handler;
+	class Worker;
 	class Vfs_env;
 	class Root;
 
 	typedef Genode::Fifo<Session_component> Session_queue;
 
+	/**
+	 * Lock guard that is a no-op if no lock is given
+	 */
+	struct Serialize_guard
+	{
+		Genode::Lock *_lock;
+
+		Serialize_guard(Genode::Lock *lock) : _lock(lock) {
+			if (_lock) _lock->lock(); }
+
+		~Serialize_guard() { if (_lock) _lock->unlock(); }
+
+		private:
+
+			/*
+			 * Noncopyable
+			 */
+			Serialize_guard(Serialize_guard const &);
+			Serialize_guard &operator = (Serialize_guard const &);
+	};
+
 	/**
 	 * Convenience utities for parsing quotas
 	 */
@@ -88,10 +112,23 @@ class Vfs_server::Session_component : private Session_resources,
 
 	private:
 
+		/*
+		 * Noncopyable
+		 */
+		Session_component(Session_component const &);
+		Session_component &operator = (Session_component const &);
+
 		Vfs::File_system &_vfs;
 
 		Genode::Entrypoint &_ep;
 
+		/*
+		 * Lock that serializes the processing of the session by its worker
+		 * entrypoint with RPC calls, nullptr if the session is served by
+		 * the component's entrypoint
+		 */
+		Genode::Lock * const _worker_lock;
+
 		Packet_stream &_stream { *tx_sink() };
 
 		/* global queue of nodes to process after an I/O signal */
@@ -103,8 +140,18 @@ class Vfs_server::Session_component : private Session_resources,
 		/* collection of open nodes local to this session */
 		Node_space _node_space { };
 
-		Genode::Signal_handler<Session_component> _process_packet_handler {
-			_ep, *this, &Session_component::_process_packets };
+		/*
+		 * Signal handlers executed by the entrypoint of the session
+		 *
+		 * The handlers are dissolved explicitly at destruction time before
+		 * the session is drained, see '~Session_component'.
+		 */
+		typedef Genode::Signal_handler<Session_component> Signal_handler;
+
+		Genode::Constructible<Signal_handler> _process_packet_handler { };
+
+		/* handler for notifications of watch nodes, see 'Watch_node' */
+		Genode::Constructible<Signal_handler> _watch_handler { };
 
 		/*
 		 * The root node needs be allocated with the session struct
@@ -202,6 +249,7 @@ class Vfs_server::Session_component : private Session_resources,
 	protected:
 
 		friend Vfs_server::Root;
+		friend Vfs_server::Io_progress_handler;
 		using Session_queue::Element::enqueued;
 
 		/**
@@ -233,7 +281,7 @@ class Vfs_server::Session_component : private Session_resources,
 
 				if (--quantum == 0) {
 					/* come back to this later */
-					Genode::Signal_transmitter(_process_packet_handler).submit();
+					Genode::Signal_transmitter(*_process_packet_handler).submit();
 					return false;
 				}
 			}
@@ -248,6 +296,8 @@ class Vfs_server::Session_component : private Session_resources,
 		 */
 		void _process_packets()
 		{
+			Serialize_guard guard(_worker_lock);
+
 			bool done = process_packets();
 
 			if (done && enqueued()) {
@@ -260,6 +310,18 @@ class Vfs_server::Session_component : private Session_resources,
 			}
 		}
 
+		/**
+		 * Called by signal handler for watch notifications
+		 */
+		void _handle_watch()
+		{
+			Serialize_guard guard(_worker_lock);
+
+			_node_space.for_each<Node>([&] (Node &node) {
+				if (Watch_node *watch = dynamic_cast<Watch_node *>(&node))
+					watch->deliver_pending_response(); });
+		}
+
 		/**
 		 * Check if string represents a valid path (must start with '/')
 		 */
@@ -305,6 +367,8 @@ class Vfs_server::Session_component : private Session_resources,
 		                  Genode::Cap_quota     cap_quota,
 		                  size_t                tx_buf_size,
 		                  Vfs::File_system     &vfs,
+		                  Genode::Entrypoint   &ep,
+		                  Genode::Lock         *worker_lock,
 		                  Node_queue           &pending_nodes,
 		                  Session_queue        &pending_sessions,
 		                  char           const *root_path,
@@ -313,19 +377,25 @@ class Vfs_server::Session_component : private Session_resources,
 			Session_resources(env.pd(), env.rm(), ram_quota, cap_quota, tx_buf_size),
 			Session_rpc_object(_packet_ds.cap(), env.rm(), env.ep().rpc_ep()),
 			_vfs(vfs),
-			_ep(env.ep()),
+			_ep(ep),
+			_worker_lock(worker_lock),
 			_pending_nodes(pending_nodes),
 			_pending_sessions(pending_sessions),
 			_root_path(root_path),
 			_label(label),
 			_writable(writable)
 		{
+			_process_packet_handler.construct(_ep, *this, &Session_component::_process_packets);
+
+			if (_worker_lock)
+				_watch_handler.construct(_ep, *this, &Session_component::_handle_watch);
+
 			/*
 			 * Register an I/O signal handler for
 			 * packet-avail and ready-to-ack signals.
 			 */
-			_tx.sigh_packet_avail(_process_packet_handler);
-			_tx.sigh_ready_to_ack(_process_packet_handler);
+			_tx.sigh_packet_avail(*_process_packet_handler);
+			_tx.sigh_ready_to_ack(*_process_packet_handler);
 		}
 
 		/**
@@ -333,6 +403,20 @@ class Vfs_server::Session_component : private Session_resources,
 		 */
 		~Session_component()
 		{
+			/*
+			 * Dissolve the signal handlers before taking the worker lock.
+			 * Dissolving waits for the completion of a signal dispatched by
+			 * the worker, which may just wait for the worker lock.
+			 */
+			_process_packet_handler.destruct();
+			_watch_handler.destruct();
+
+			/*
+			 * Drain the session while the worker lock is held. Once the lock
+			 * is released, the worker has no reference to the session left.
+			 */
+			Serialize_guard guard(_worker_lock);
+
 			/* flush and close the open handles */
 			while (_node_space.apply_any<Node>([&] (Node &node) {
 				_close(node); })) { }
@@ -344,10 +428,31 @@ class Vfs_server::Session_component : private Session_resources,
 		/**
 		 * Increase quotas
 		 */
-		void upgrade(Genode::Ram_quota ram) {
-			_ram_guard.upgrade(ram); }
-		void upgrade(Genode::Cap_quota caps) {
-			_cap_guard.upgrade(caps); }
+		void upgrade(Genode::Ram_quota ram)
+		{
+			Serialize_guard guard(_worker_lock);
+			_ram_guard.upgrade(ram);
+		}
+
+		void upgrade(Genode::Cap_quota caps)
+		{
+			Serialize_guard guard(_worker_lock);
+			_cap_guard.upgrade(caps);
+		}
+
+		/**
+		 * Rpc_object interface
+		 *
+		 * RPC calls are executed by the component's entrypoint, so they
+		 * must be serialized with the packet processing by the worker.
+		 */
+		Genode::Rpc_exception_code dispatch(Genode::Rpc_opcode        op,
+		                                    Genode::Ipc_unmarshaller &in,
+		                                    Genode::Msgbuf_base      &out) override
+		{
+			Serialize_guard guard(_worker_lock);
+			return Session_rpc_object::dispatch(op, in, out);
+		}
 
 
 		/***************************
@@ -461,7 +566,9 @@ class Vfs_server::Session_component : private Session_resources,
 			Node *node;
 			try { node  = new (_alloc)
 				Watch_node(_node_space, path_str, *vfs_handle,
-				           _pending_nodes, _stream); }
+				           _pending_nodes, _stream,
+				           _watch_handler.constructed() ? Genode::Signal_context_capability(*_watch_handler)
+				                                        : Genode::Signal_context_capability()); }
 			catch (Out_of_memory) { throw Out_of_ram(); }
 
 			return Watch_handle { node->id().value };
@@ -537,6 +644,12 @@ class Vfs_server::Session_component : private Session_resources,
 				file.truncate(size); });
 		}
 
+		Genode::Dataspace_capability dataspace(File_handle file_handle) override
+		{
+			return _apply(file_handle, [&] (File &file) {
+				return file.dataspace(_ram_guard); });
+		}
+
 		void move(Dir_handle from_dir_handle, Name const &from_name,
 		          Dir_handle to_dir_handle,   Name const &to_name) override
 		{
@@ -566,6 +679,126 @@ class Vfs_server::Session_component : private Session_resources,
 };
 
 
+/**
+ * Object for post-I/O-signal processing
+ *
+ * This allows packet and VFS backend signals to
+ * be dispatched quickly followed by a processing
+ * of sessions that might be unblocked.
+ */
+class Vfs_server::Io_progress_handler : public Genode::Entrypoint::Io_progress_handler
+{
+	private:
+
+		/*
+		 * Noncopyable
+		 */
+		Io_progress_handler(Io_progress_handler const &);
+		Io_progress_handler &operator = (Io_progress_handler const &);
+
+		/* lock of the worker using the handler, or nullptr */
+		Genode::Lock * const _lock;
+
+	public:
+
+		/* All nodes with a packet operation awaiting an I/O signal */
+		Node_queue pending_nodes { };
+
+		/* All sessions with packet queues that await processing */
+		Session_queue pending_sessions { };
+
+		Io_progress_handler(Genode::Lock *lock) : _lock(lock) { }
+
+		/**
+		 * Post-signal hook invoked by entrypoint
+		 */
+		void handle_io_progress() override
+		{
+			Serialize_guard guard(_lock);
+
+			bool handle_progress = false;
+
+			/* process handles awaiting progress */
+			{
+				/* nodes to process later */
+				Node_queue retry { };
+
+				/* empty the pending nodes and process */
+				pending_nodes.dequeue_all([&] (Node &node) {
+					if (node.process_io()) {
+						handle_progress = true;
+					} else {
+						if (!node.enqueued()) {
+							retry.enqueue(node);
+						}
+					}
+				});
+
+				/* requeue the unprocessed nodes in order */
+				retry.dequeue_all([&] (Node &node) {
+					pending_nodes.enqueue(node); });
+			}
+
+			/*
+			 * if any pending handles were processed then
+			 * process session packet queues awaiting progress
+			 */
+			if (handle_progress) {
+				/* sessions to process later */
+				Session_queue retry { };
+
+				/* empty the pending nodes and process */
+				pending_sessions.dequeue_all([&] (Session_component &session) {
+					if (!session.process_packets()) {
+						/* requeue the session if there are packets remaining */
+						if (!session.enqueued()) {
+							retry.enqueue(session);
+						}
+					}
+				});
+
+				/* requeue the unprocessed sessions in order */
+				retry.dequeue_all([&] (Session_component &session) {
+					pending_sessions.enqueue(session); });
+			}
+		}
+};
+
+
+/**
+ * Entrypoint serving sessions in parallel to the component's entrypoint
+ *
+ * Each worker processes the packet streams of its sessions and handles the
+ * I/O progress of their nodes. RPC calls are still executed by the
+ * component's entrypoint. Hence, all activities regarding the sessions of
+ * a worker are serialized by the worker's lock.
+ */
+class Vfs_server::Worker
+{
+	private:
+
+		enum { STACK_SIZE = 16*1024*sizeof(long) };
+
+		Genode::Entrypoint _ep;
+
+	public:
+
+		Genode::Lock lock { };
+
+		Io_progress_handler progress_handler { &lock };
+
+		Worker(Genode::Env &env, unsigned index)
+		:
+			_ep(env, STACK_SIZE, Genode::String<16>("vfs_worker_", index).string(),
+			    env.cpu().affinity_space().location_of_index(index + 1))
+		{
+			_ep.register_io_progress_handler(progress_handler);
+		}
+
+		Genode::Entrypoint &ep() { return _ep; }
+};
+
+
 class Vfs_server::Root : public Genode::Root_component<Session_component>
 {
 	private:
@@ -590,7 +823,13 @@ class Vfs_server::Root : public Genode::Root_component<Session_component>
 		void _config_update()
 		{
 			_config_rom.update();
+
+			/* quiesce the workers while the file systems are reconfigured */
+			_for_each_worker_lock([] (Genode::Lock &lock) { lock.lock(); });
+
 			_vfs_env.root_dir().apply_config(vfs_config());
+
+			_for_each_worker_lock([] (Genode::Lock &lock) { lock.unlock(); });
 		}
 
 		/**
@@ -600,73 +839,53 @@ class Vfs_server::Root : public Genode::Root_component<Session_component>
 		Genode::Heap    _vfs_heap { &_env.ram(), &_env.rm() };
 		Vfs::Simple_env _vfs_env  { _env, _vfs_heap, vfs_config() };
 
-		/**
-		 * Object for post-I/O-signal processing
+		Io_progress_handler _progress_handler { nullptr };
+
+		/*
+		 * Optional worker entrypoints
 		 *
-		 * This allows packet and VFS backend signals to
-		 * be dispatched quickly followed by a processing
-		 * of sessions that might be unblocked.
+		 * If configured via the 'workers' attribute, sessions are assigned
+		 * to the workers in a round-robin fashion so that the packets of
+		 * independent sessions are processed in parallel. This requires
+		 * all file systems of the VFS to be thread safe.
 		 */
-		struct Io_progress_handler : Genode::Entrypoint::Io_progress_handler
-		{
-			/* All nodes with a packet operation awaiting an I/O signal */
-			Node_queue pending_nodes { };
+		enum { MAX_WORKERS = 32 };
 
-			/* All sessions with packet queues that await processing */
-			Session_queue pending_sessions { };
+		Genode::Constructible<Worker> _workers[MAX_WORKERS];
 
-			/**
-			 * Post-signal hook invoked by entrypoint
-			 */
-			void handle_io_progress() override
-			{
-				bool handle_progress = false;
-
-				/* process handles awaiting progress */
-				{
-					/* nodes to process later */
-					Node_queue retry { };
-
-					/* empty the pending nodes and process */
-					pending_nodes.dequeue_all([&] (Node &node) {
-						if (node.process_io()) {
-							handle_progress = true;
-						} else {
-							if (!node.enqueued()) {
-								retry.enqueue(node);
-							}
-						}
-					});
+		unsigned _num_workers = 0;
+		unsigned _next_worker = 0;
 
-					/* requeue the unprocessed nodes in order */
-					retry.dequeue_all([&] (Node &node) {
-						pending_nodes.enqueue(node); });
-				}
+		void _construct_workers()
+		{
+			unsigned const num_workers =
+				Genode::min(_config_rom.xml().attribute_value("workers", 0U),
+				            (unsigned)MAX_WORKERS);
 
-				/*
-				 * if any pending handles were processed then
-				 * process session packet queues awaiting progress
-				 */
-				if (handle_progress) {
-					/* sessions to process later */
-					Session_queue retry { };
-
-					/* empty the pending nodes and process */
-					pending_sessions.dequeue_all([&] (Session_component &session) {
-						if (!session.process_packets()) {
-							/* requeue the session if there are packets remaining */
-							if (!session.enqueued()) {
-								retry.enqueue(session);
-							}
-						}
-					});
+			if (!num_workers)
+				return;
 
-					/* requeue the unprocessed sessions in order */
-					retry.dequeue_all([&] (Session_component &session) {
-						pending_sessions.enqueue(session); });
-				}
+			if (!_vfs_env.root_dir().thread_safe()) {
+				Genode::warning("VFS is not thread safe, "
+				                "serving all sessions by the main entrypoint");
+				return;
 			}
-		} _progress_handler { };
+
+			for (unsigned i = 0; i < num_workers; i++)
+				_workers[i].construct(_env, i);
+
+			_num_workers = num_workers;
+		}
+
+		/**
+		 * Apply functor to all worker locks
+		 */
+		template <typename FN>
+		void _for_each_worker_lock(FN const &fn)
+		{
+			for (unsigned i = 0; i < _num_workers; i++)
+				fn(_workers[i]->lock);
+		}
 
 	protected:
 
@@ -749,13 +968,26 @@ class Vfs_server::Root : public Genode::Root_component<Session_component>
 				throw Service_denied();
 			}
 
+			Entrypoint          *ep       = &_env.ep();
+			Lock                *lock     = nullptr;
+			Io_progress_handler *progress = &_progress_handler;
+
+			if (_num_workers) {
+				Worker &worker = *_workers[_next_worker++ % _num_workers];
+
+				ep       = &worker.ep();
+				lock     = &worker.lock;
+				progress = &worker.progress_handler;
+			}
+
 			Session_component *session = new (md_alloc())
 				Session_component(_env, label.string(),
 				                  Genode::Ram_quota{ram_quota},
 				                  Genode::Cap_quota{cap_quota},
 				                  tx_buf_size, _vfs_env.root_dir(),
-				                  _progress_handler.pending_nodes,
-				                  _progress_handler.pending_sessions,
+				                  *ep, lock,
+				                  progress->pending_nodes,
+				                  progress->pending_sessions,
 				                  session_root.base(), writeable);
 
 			auto ram_used = _env.pd().used_ram().value - initial_ram_usage;
@@ -801,6 +1033,7 @@ class Vfs_server::Root : public Genode::Root_component<Session_component>
 			_env(env)
 		{
 			_env.ep().register_io_progress_handler(_progress_handler);
+			_construct_workers();
 			_config_rom.sigh(_config_handler);
 			env.parent().announce(env.ep().manage(*this));
 		}
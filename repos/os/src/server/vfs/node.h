@@ -20,6 +20,10 @@
 #include <vfs/file_system.h>
 #include <os/path.h>
 #include <base/id_space.h>
+#include <base/quota_guard.h>
+#include <dataspace/client.h>
+#include <base/signal.h>
+#include <cpu/atomic.h>
 
 /* Local includes */
 #include "assert.h"
@@ -460,14 +464,35 @@ class Vfs_server::Watch_node final : public Vfs_server::Node,
 
 		Vfs::Vfs_watch_handle &_watch_handle;
 
+		/*
+		 * Signal handler of the session, valid if the session is served
+		 * by worker threads
+		 *
+		 * A thread-safe file system may trigger the watch response from
+		 * the context of another session's worker. In this case, the
+		 * response is merely marked as pending and delivered by the
+		 * entrypoint of the session while holding its worker lock.
+		 */
+		Genode::Signal_context_capability const _sigh;
+
+		int volatile _pending = 0;
+
+		void _deliver()
+		{
+			/* send a packet immediately otherwise defer */
+			if (!process_io() && !enqueued())
+				_response_queue.enqueue(*this);
+		}
+
 	public:
 
 		Watch_node(Node_space &space,  char const *path,
 		           Vfs::Vfs_watch_handle &handle,
 		           Node_queue &response_queue,
-		           Packet_stream &stream)
+		           Packet_stream &stream,
+		           Genode::Signal_context_capability sigh)
 		: Node(space, path, response_queue, stream),
-		  _watch_handle(handle)
+		  _watch_handle(handle), _sigh(sigh)
 		{
 			_watch_handle.handler(this);
 		}
@@ -475,6 +500,17 @@ class Vfs_server::Watch_node final : public Vfs_server::Node,
 		~Watch_node() {
 			_watch_handle.close(); }
 
+		/**
+		 * Deliver response marked as pending by 'watch_response'
+		 *
+		 * Must be called with the worker lock of the session held.
+		 */
+		void deliver_pending_response()
+		{
+			if (Genode::cmpxchg(&_pending, 1, 0))
+				_deliver();
+		}
+
 
 		/*******************************************
 		 ** Vfs::Watch_response_handler interface **
@@ -482,9 +518,13 @@ class Vfs_server::Watch_node final : public Vfs_server::Node,
 
 		void watch_response() override
 		{
-			/* send a packet immediately otherwise defer */
-			if (!process_io() && !enqueued())
-				_response_queue.enqueue(*this);
+			if (!_sigh.valid()) {
+				_deliver();
+				return;
+			}
+
+			_pending = 1;
+			Genode::Signal_transmitter(_sigh).submit();
 		}
 
 
@@ -609,6 +649,26 @@ class Vfs_server::File : public Io_node
 
 		char const *_leaf_path = nullptr; /* offset pointer to Node::_path */
 
+		/* dataspace handed out by 'dataspace()' */
+		Genode::Dataspace_capability _ds { };
+
+		/* session quota charged for '_ds' */
+		Genode::Ram_quota_guard *_ds_guard = nullptr;
+		Genode::Ram_quota        _ds_quota { 0 };
+
+		void _release_ds()
+		{
+			if (_ds.valid())
+				_handle.ds().release(_leaf_path, _ds);
+
+			if (_ds_guard)
+				_ds_guard->replenish(_ds_quota);
+
+			_ds       = Genode::Dataspace_capability();
+			_ds_guard = nullptr;
+			_ds_quota = Genode::Ram_quota { 0 };
+		}
+
 		inline
 		seek_off_t seek_tail(file_size count)
 		{
@@ -689,11 +749,54 @@ class Vfs_server::File : public Io_node
 			_leaf_path = vfs.leaf_path(path());
 		}
 
+		~File() { _release_ds(); }
+
 		void truncate(file_size_t size)
 		{
 			assert_truncate(_handle.fs().ftruncate(&_handle, size));
 			mark_as_updated();
 		}
+
+		/**
+		 * Return dataspace with the current file content
+		 *
+		 * The dataspace handed out before is released. VFS plugins may
+		 * allocate a copy of the content from the RAM of the server, so
+		 * the size of the dataspace is charged to the session's
+		 * 'ram_guard' until the dataspace is released.
+		 *
+		 * \throw Permission_denied
+		 * \throw Unavailable
+		 * \throw Out_of_ram
+		 */
+		Genode::Dataspace_capability dataspace(Genode::Ram_quota_guard &ram_guard)
+		{
+			if (!(mode() & READ_ONLY))
+				throw Permission_denied();
+
+			_release_ds();
+
+			/* don't let the plugin copy content the session cannot pay for */
+			Vfs::Directory_service::Stat st;
+			if (_handle.ds().stat(_leaf_path, st) == Directory_service::STAT_OK
+			 && st.size > ram_guard.avail().value)
+				throw Out_of_ram();
+
+			_ds = _handle.ds().dataspace(_leaf_path);
+			if (!_ds.valid())
+				throw Unavailable();
+
+			Genode::Ram_quota const quota { Genode::Dataspace_client(_ds).size() };
+			try { ram_guard.withdraw(quota); }
+			catch (Genode::Ram_quota_guard::Limit_exceeded) {
+				_release_ds();
+				throw Out_of_ram();
+			}
+
+			_ds_guard = &ram_guard;
+			_ds_quota = quota;
+			return _ds;
+		}
 };
 
 
@@ -0,0 +1,85 @@
+/*
+ * \brief  Startup of many instances of a binary with large writable segments
+ * \author agent
+ * \date   2026-10-19
+ *
+ * The binary comes with a large initialized '.data' and an even larger
+ * '.bss' part of which only a few pages are used. Each instance logs the
+ * time stamp at which it became ready.
+ *
+ * An instance configured as "marker" is started first. It logs the time
+ * stamp of the begin of the scenario and calibrates the time-stamp counter
+ * against the timer, which allows the run script to convert the time stamps
+ * into milliseconds.
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+#include <base/log.h>
+#include <base/component.h>
+#include <base/attached_rom_dataspace.h>
+#include <timer_session/connection.h>
+#include <trace/timestamp.h>
+
+enum { DATA_SIZE = 512*1024, BSS_SIZE = 8*1024*1024, PAGE = 4096 };
+
+/* initialized data, not a zero-filled array to keep it in '.data' */
+static char data_segment[DATA_SIZE] = { 1 };
+
+static char bss_segment[BSS_SIZE];
+
+namespace Test {
+	struct Main;
+	using namespace Genode;
+}
+
+
+struct Test::Main
+{
+	Env &_env;
+
+	Attached_rom_dataspace _config { _env, "config" };
+
+	void _marker()
+	{
+		log("marker at tsc=", Trace::timestamp());
+
+		Timer::Connection timer { _env };
+
+		enum { CALIBRATION_MS = 1000 };
+
+		Trace::Timestamp const start = Trace::timestamp();
+		timer.msleep(CALIBRATION_MS);
+		Trace::Timestamp const end = Trace::timestamp();
+
+		log("tsc per ms=", (end - start)/CALIBRATION_MS);
+	}
+
+	void _instance()
+	{
+		/* use a few pages of both segments like a typical component */
+		unsigned long sum = 0;
+		for (unsigned i = 0; i < 4; i++) {
+			sum += (unsigned char)data_segment[i*PAGE];
+			bss_segment[i*PAGE] = (char)sum;
+		}
+
+		log("ready at tsc=", Trace::timestamp(), " (", sum, ")");
+	}
+
+	Main(Env &env) : _env(env)
+	{
+		if (_config.xml().attribute_value("marker", false))
+			_marker();
+		else
+			_instance();
+	}
+};
+
+
+void Component::construct(Genode::Env &env) { static Test::Main main(env); }
@@ -0,0 +1,3 @@
+TARGET = test-elf_startup
+SRC_CC = main.cc
+LIBS   = base
@@ -0,0 +1,138 @@
+/*
+ * \brief  Benchmark of the logging throughput of fs_log
+ * \author agent
+ * \date   2026-10-19
+ *
+ * The benchmark writes a number of log lines to a LOG session served by
+ * fs_log and measures the time needed for submitting the lines. After
+ * closing the session, it measures the time until the log file observed
+ * via the file system reached its expected size.
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+#include <base/log.h>
+#include <base/heap.h>
+#include <base/component.h>
+#include <base/allocator_avl.h>
+#include <base/attached_rom_dataspace.h>
+#include <log_session/connection.h>
+#include <file_system_session/connection.h>
+#include <file_system/util.h>
+#include <timer_session/connection.h>
+
+namespace Test {
+	struct Main;
+	using namespace Genode;
+}
+
+
+struct Test::Main
+{
+	typedef String<File_system::MAX_PATH_LEN> Path;
+	typedef String<File_system::MAX_NAME_LEN> Name;
+
+	Env &_env;
+
+	Attached_rom_dataspace _config { _env, "config" };
+
+	Heap _heap { _env.ram(), _env.rm() };
+
+	Allocator_avl _tx_alloc { &_heap };
+
+	File_system::Connection _fs { _env, _tx_alloc, "", "/", false, 4096 };
+
+	Timer::Connection _timer { _env };
+
+	Xml_node const _config_xml = _config.xml();
+
+	unsigned const _lines     = _config_xml.attribute_value("lines",     100000U);
+	unsigned const _line_size = _config_xml.attribute_value("line_size", 80U);
+	unsigned const _rounds    = _config_xml.attribute_value("rounds",    3U);
+
+	/* location of the log file as chosen by fs_log */
+	Path const _dir  = _config_xml.attribute_value("dir",  Path("/test-fs_log_bench"));
+	Name const _file = _config_xml.attribute_value("file", Name("bench.log"));
+
+	/* the size check does not apply if the log file is rotated */
+	bool const _verify = _config_xml.attribute_value("verify", true);
+
+	File_system::file_size_t _file_size()
+	{
+		try {
+			File_system::Dir_handle dir = _fs.dir(_dir.string(), false);
+			File_system::Handle_guard dir_guard(_fs, dir);
+
+			File_system::File_handle file =
+				_fs.file(dir, _file.string(), File_system::READ_ONLY, false);
+			File_system::Handle_guard file_guard(_fs, file);
+
+			return _fs.status(file).size;
+		}
+		catch (...) { return 0; }
+	}
+
+	void _round(unsigned round)
+	{
+		enum { MAX_LINE = Log_session::String::MAX_SIZE };
+
+		char line[MAX_LINE];
+		size_t const len = min((size_t)_line_size, (size_t)MAX_LINE - 1);
+		for (size_t i = 0; i < len; i++)
+			line[i] = 'a' + (i % 26);
+		line[len - 1] = '\n';
+		line[len]     = 0;
+
+		unsigned long const start_ms = _timer.elapsed_ms();
+		{
+			Log_connection log(_env, "bench");
+
+			for (unsigned i = 0; i < _lines; i++)
+				log.write(Log_session::String(line));
+		}
+		unsigned long const written_ms = max(_timer.elapsed_ms() - start_ms, 1UL);
+
+		uint64_t const bytes = (uint64_t)len*_lines;
+
+		log("round ", round, ": lines=", _lines, " line_size=", len,
+		    " write duration=", written_ms, " ms rate=",
+		    (uint64_t)_lines*1000/written_ms, " lines/s ",
+		    bytes*1000/written_ms/1024, " KiB/s");
+
+		if (!_verify)
+			return;
+
+		/* wait until the log file reached its expected size */
+		enum { POLL_MS = 10, TIMEOUT_MS = 30*1000 };
+		while (_file_size() < bytes) {
+			if (_timer.elapsed_ms() - start_ms > TIMEOUT_MS) {
+				error("log file has size ", _file_size(), ", expected ", bytes);
+				throw -1;
+			}
+			_timer.msleep(POLL_MS);
+		}
+		unsigned long const stored_ms = max(_timer.elapsed_ms() - start_ms, 1UL);
+
+		log("round ", round, ": stored duration=", stored_ms, " ms rate=",
+		    bytes*1000/stored_ms/1024, " KiB/s");
+	}
+
+	Main(Env &env) : _env(env)
+	{
+		log("--- test-fs_log_bench started ---");
+
+		for (unsigned i = 0; i < _rounds; i++)
+			_round(i);
+
+		log("--- test-fs_log_bench finished ---");
+		_env.parent().exit(0);
+	}
+};
+
+
+void Component::construct(Genode::Env &env) { static Test::Main main(env); }
@@ -0,0 +1,162 @@
+/*
+ * \brief  Benchmark of obtaining file content from a file-system server
+ * \author agent
+ * \date   2026-10-19
+ *
+ * The benchmark obtains the content of a large file repeatedly by reading
+ * it via packets, by requesting it as dataspace from the file-system
+ * session, and by opening it as ROM module. Each variant touches all
+ * pages of the content, similar to the loading of a binary.
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+#include <base/log.h>
+#include <base/heap.h>
+#include <base/component.h>
+#include <base/allocator_avl.h>
+#include <base/attached_dataspace.h>
+#include <base/attached_ram_dataspace.h>
+#include <base/attached_rom_dataspace.h>
+#include <file_system_session/connection.h>
+#include <file_system/util.h>
+#include <timer_session/connection.h>
+
+namespace Test {
+	struct Main;
+	using namespace Genode;
+}
+
+
+struct Test::Main
+{
+	typedef File_system::Session::Tx::Source Tx_source;
+	typedef String<File_system::MAX_NAME_LEN> Name;
+
+	Env &_env;
+
+	Attached_rom_dataspace _config { _env, "config" };
+
+	Heap _heap { _env.ram(), _env.rm() };
+
+	Allocator_avl _tx_alloc { &_heap };
+
+	File_system::Connection _fs { _env, _tx_alloc, "", "/", false, 1024*1024 };
+
+	Timer::Connection _timer { _env };
+
+	Name     const _name   = _config.xml().attribute_value("file", Name("large"));
+	unsigned const _rounds = _config.xml().attribute_value("rounds", 10U);
+
+	unsigned _checksum = 0;
+
+	/**
+	 * Read one byte per page, similar to the page faults of a loader
+	 */
+	void _touch(char const *base, size_t size)
+	{
+		enum { PAGE_SIZE = 4096 };
+		for (size_t i = 0; i < size; i += PAGE_SIZE)
+			_checksum += *(unsigned char const volatile *)(base + i);
+	}
+
+	template <typename FN>
+	void _measure(char const *variant, size_t size, FN const &fn)
+	{
+		unsigned long const start_ms = _timer.elapsed_ms();
+
+		for (unsigned i = 0; i < _rounds; i++)
+			fn();
+
+		unsigned long const ms = max(_timer.elapsed_ms() - start_ms, 1UL);
+
+		log(variant, ": rounds=", _rounds, " size=", size, " duration=", ms,
+		    " ms rate=", (uint64_t)size*_rounds/ms*1000/(1024*1024), " MiB/s");
+	}
+
+	/**
+	 * Copy file content via packets, as done by fs_rom without mapping
+	 */
+	void _read(File_system::File_handle handle, size_t size)
+	{
+		Attached_ram_dataspace ds(_env.ram(), _env.rm(), size);
+
+		Tx_source &source = *_fs.tx();
+
+		size_t const chunk_size = source.bulk_buffer_size()/2;
+
+		for (size_t seek = 0; seek < size; ) {
+
+			size_t const count = min(size - seek, chunk_size);
+
+			source.submit_packet(File_system::Packet_descriptor(
+				source.alloc_packet(count), handle,
+				File_system::Packet_descriptor::READ, count, seek));
+
+			File_system::Packet_descriptor const packet = source.get_acked_packet();
+
+			size_t const length = packet.succeeded() ? packet.length() : 0;
+
+			memcpy(ds.local_addr<char>() + seek, source.packet_content(packet),
+			       length);
+
+			source.release_packet(packet);
+
+			if (!length) {
+				error("reading '", _name, "' failed at offset ", seek);
+				break;
+			}
+			seek += length;
+		}
+
+		_touch(ds.local_addr<char const>(), size);
+	}
+
+	void _map(File_system::File_handle handle)
+	{
+		Attached_dataspace ds(_env.rm(), _fs.dataspace(handle));
+
+		_touch(ds.local_addr<char const>(), ds.size());
+	}
+
+	void _rom()
+	{
+		Attached_rom_dataspace rom(_env, _name.string());
+
+		_touch(rom.local_addr<char const>(), rom.size());
+	}
+
+	Main(Env &env) : _env(env)
+	{
+		log("--- test-fs_map_bench started ---");
+
+		File_system::Dir_handle dir = _fs.dir("/", false);
+		File_system::Handle_guard dir_guard(_fs, dir);
+
+		File_system::File_handle file =
+			_fs.file(dir, _name.string(), File_system::READ_ONLY, false);
+		File_system::Handle_guard file_guard(_fs, file);
+
+		size_t const size = _fs.status(file).size;
+
+		_measure("read", size, [&] () { _read(file, size); });
+
+		try {
+			_measure("map ", size, [&] () { _map(file); }); }
+		catch (File_system::Unavailable) {
+			log("map : not supported by file-system server"); }
+
+		_measure("rom ", size, [&] () { _rom(); });
+
+		log("--- test-fs_map_bench finished ---");
+		_env.parent().exit(0);
+	}
+};
+
+
+void Component::construct(Genode::Env &env) { static Test::Main main(env); }
@@ -13,6 +13,7 @@
 
 
 #include <file_system_session/connection.h>
+#include <timer_session/connection.h>
 #include <base/attached_rom_dataspace.h>
 #include <base/heap.h>
 #include <base/allocator_avl.h>
@@ -33,7 +34,11 @@ struct Fs_packet::Main
 
 	Heap heap { env.pd(), env.rm() };
 	Allocator_avl avl_alloc { &heap };
-	File_system::Connection fs { env, avl_alloc, "", "/", false, 4<<10 };
+
+	size_t const buffer_size =
+		config_rom.xml().attribute_value("buffer_size", Number_of_bytes(4<<10));
+
+	File_system::Connection fs { env, avl_alloc, "", "/", false, buffer_size };
 	File_system::Session::Tx::Source &pkt_tx { *fs.tx() };
 
 	Dir_handle dir_handle { fs.dir("/", false) };
@@ -43,12 +48,31 @@ struct Fs_packet::Main
 
 	int pkt_count = config_rom.xml().attribute_value("count", 1U << 10);
 
+	/*
+	 * Throughput measurement
+	 */
+	Timer::Connection timer { env };
+
+	uint64_t const start_ms = timer.elapsed_ms();
+
+	uint64_t bytes_read = 0;
+
+	void log_throughput()
+	{
+		uint64_t const elapsed_ms = max(timer.elapsed_ms() - start_ms, 1ULL);
+
+		log("read ", bytes_read/1024, " KiB in ", elapsed_ms, " ms, ",
+		    bytes_read/elapsed_ms, " KB/s");
+	}
+
 	void handle_ack()
 	{
 		while (pkt_tx.ack_avail()) {
 			auto pkt = pkt_tx.get_acked_packet();
+			bytes_read += pkt.length();
 			--pkt_count;
 			if (pkt_count < 0) {
+				log_throughput();
 				log("--- test complete ---");
 				env.parent().exit(0);
 				sleep_forever();
@@ -0,0 +1,93 @@
+/*
+ * \brief  Benchmark of the throughput and latency of LOG output
+ * \author agent
+ * \date   2026-10-19
+ *
+ * The benchmark writes log lines via 'Genode::log' and measures the
+ * throughput as well as the duration of the individual 'log' calls. The
+ * results are written to a separate LOG session labeled "result". The same
+ * code is built with and without the shared-memory ring of the LOG session.
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+#include <base/log.h>
+#include <base/component.h>
+#include <base/attached_rom_dataspace.h>
+#include <log_session/connection.h>
+#include <timer_session/connection.h>
+#include <trace/timestamp.h>
+
+namespace Test {
+	struct Main;
+	using namespace Genode;
+}
+
+
+struct Test::Main
+{
+	Env &_env;
+
+	Attached_rom_dataspace _config { _env, "config" };
+
+	Timer::Connection _timer { _env };
+
+	Log_connection _result { _env, "result" };
+
+	unsigned const _lines  = _config.xml().attribute_value("lines",  100000U);
+	unsigned const _rounds = _config.xml().attribute_value("rounds", 3U);
+
+	template <typename... ARGS>
+	void _report(ARGS &&... args)
+	{
+		String<Log_session::MAX_STRING_LEN> const line(args..., "\n");
+		_result.write(line.string());
+	}
+
+	void _round(unsigned round)
+	{
+		using Genode::Trace::Timestamp;
+
+		Timestamp max_ts = 0, sum_ts = 0;
+
+		uint64_t const start_us = _timer.elapsed_us();
+
+		for (unsigned i = 0; i < _lines; i++) {
+
+			Timestamp const start = Trace::timestamp();
+
+			log("round ", round, " line ", i,
+			    " abcdefghijklmnopqrstuvwxyz0123456789");
+
+			Timestamp const duration = Trace::timestamp() - start;
+
+			sum_ts += duration;
+			max_ts  = max(max_ts, duration);
+		}
+
+		uint64_t const us = max(_timer.elapsed_us() - start_us, (uint64_t)1);
+
+		_report("round ", round, ": lines=", _lines, " duration=", us/1000,
+		        " ms rate=", (uint64_t)_lines*1000*1000/us, " lines/s",
+		        " latency avg=", sum_ts/_lines, " max=", max_ts, " ticks");
+	}
+
+	Main(Env &env) : _env(env)
+	{
+		_report("--- test-log_bench started ---");
+
+		for (unsigned i = 0; i < _rounds; i++)
+			_round(i);
+
+		_report("--- test-log_bench finished ---");
+		_env.parent().exit(0);
+	}
+};
+
+
+void Component::construct(Genode::Env &env) { static Test::Main main(env); }
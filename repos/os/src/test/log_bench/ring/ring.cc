@@ -0,0 +1,16 @@
+/*
+ * \brief  Enable the shared-memory ring for the LOG output of the benchmark
+ * \author agent
+ * \date   2026-10-19
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+#include <base/component.h>
+
+Genode::size_t Component::log_ring_size() { return 64*1024; }
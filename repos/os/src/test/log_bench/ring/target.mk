@@ -0,0 +1,5 @@
+TARGET = test-log_bench_ring
+SRC_CC = main.cc ring.cc
+LIBS   = base
+
+vpath main.cc $(PRG_DIR)/..
@@ -0,0 +1,5 @@
+TARGET = test-log_bench_rpc
+SRC_CC = main.cc
+LIBS   = base
+
+vpath main.cc $(PRG_DIR)/..
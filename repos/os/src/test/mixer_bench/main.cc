@@ -0,0 +1,291 @@
+/*
+ * \brief  Benchmark of the audio mixer
+ * \author agent
+ * \date   2026-10-19
+ *
+ * The component is used in two roles. As "sink", it provides the Audio_out
+ * service to the mixer and consumes the mixed packets at the pace of a sound
+ * card. As "source", it opens a number of stereo sessions at the mixer and
+ * keeps their queues filled. The CPU load of the mixer is observed with 'top'
+ * by the run script, which relates it to the number of mixed channels.
+ *
+ * The 'speedup' attribute shortens the period of both roles to push the
+ * mixer beyond real-time playback.
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+#include <base/component.h>
+#include <base/attached_rom_dataspace.h>
+#include <base/heap.h>
+#include <base/log.h>
+#include <root/component.h>
+#include <audio_out_session/connection.h>
+#include <audio_out_session/rpc_object.h>
+#include <timer_session/connection.h>
+
+namespace Test {
+
+	using namespace Genode;
+	using namespace Audio_out;
+
+	enum Channel_number { LEFT, RIGHT, MAX_CHANNELS, INVALID = MAX_CHANNELS };
+
+	static unsigned period_us(Xml_node config)
+	{
+		unsigned const speedup = max(1U, config.attribute_value("speedup", 1U));
+		return (unsigned)(((uint64_t)PERIOD*1000*1000/SAMPLE_RATE)/speedup);
+	}
+
+	static Channel_number channel_from_name(char const *name)
+	{
+		if (!strcmp(name, "left")  || !strcmp(name, "front left"))  return LEFT;
+		if (!strcmp(name, "right") || !strcmp(name, "front right")) return RIGHT;
+		return INVALID;
+	}
+
+	struct Sink;
+	struct Source;
+	struct Main;
+}
+
+
+/*
+ * Output device consuming one packet per channel and period
+ */
+struct Test::Sink
+{
+	/*
+	 * Noncopyable
+	 */
+	Sink(Sink const &);
+	Sink &operator = (Sink const &);
+
+	struct Session_component : Session_rpc_object
+	{
+		Sink          &_sink;
+		Channel_number _channel;
+
+		Session_component(Env &env, Sink &sink, Channel_number channel)
+		:
+			Session_rpc_object(env, sink._data_avail_handler),
+			_sink(sink), _channel(channel)
+		{
+			_sink._channels[_channel] = this;
+		}
+
+		~Session_component() { _sink._channels[_channel] = nullptr; }
+	};
+
+	struct Root : Root_component<Session_component>
+	{
+		Env  &_env;
+		Sink &_sink;
+
+		Session_component *_create_session(char const *args) override
+		{
+			char channel_name[16];
+			Arg_string::find_arg(args, "channel").string(channel_name,
+			                                             sizeof(channel_name),
+			                                             "left");
+
+			Channel_number const channel = channel_from_name(channel_name);
+
+			if (channel == INVALID || _sink._channels[channel])
+				throw Service_denied();
+
+			size_t const ram_quota =
+				Arg_string::find_arg(args, "ram_quota").ulong_value(0);
+
+			if (ram_quota < sizeof(Stream) + align_addr(sizeof(Session_component), 12))
+				throw Insufficient_ram_quota();
+
+			return new (md_alloc()) Session_component(_env, _sink, channel);
+		}
+
+		Root(Env &env, Allocator &md_alloc, Sink &sink)
+		: Root_component<Session_component>(env.ep(), md_alloc),
+		  _env(env), _sink(sink) { }
+	};
+
+	Env &_env;
+
+	Session_component *_channels[MAX_CHANNELS] { nullptr, nullptr };
+
+	Heap _heap { _env.ram(), _env.rm() };
+
+	Timer::Connection _timer { _env };
+
+	unsigned long _played = 0, _silent = 0;
+	uint64_t      _last_report_ms = 0;
+
+	bool _active() const
+	{
+		return _channels[LEFT]  && _channels[LEFT]->active()
+		    && _channels[RIGHT] && _channels[RIGHT]->active();
+	}
+
+	void _handle_data_avail() { }
+
+	void _handle_timer()
+	{
+		if (!_active())
+			return;
+
+		bool played = true;
+		for (unsigned i = 0; i < MAX_CHANNELS; i++) {
+			Stream &stream = *_channels[i]->stream();
+			Packet &packet = *stream.get(stream.pos());
+
+			played &= packet.valid();
+			packet.invalidate();
+			packet.mark_as_played();
+		}
+
+		if (played) _played++; else _silent++;
+
+		for (unsigned i = 0; i < MAX_CHANNELS; i++) {
+			Stream &stream = *_channels[i]->stream();
+			bool const full = stream.full();
+
+			stream.increment_position();
+
+			if (full)
+				_channels[i]->alloc_submit();
+			_channels[i]->progress_submit();
+		}
+
+		uint64_t const now_ms = _timer.elapsed_ms();
+		if (now_ms - _last_report_ms >= 5000) {
+			log("sink: played ", _played, " periods, ", _silent, " underruns");
+			_last_report_ms = now_ms;
+			_played = _silent = 0;
+		}
+	}
+
+	Signal_handler<Sink> _data_avail_handler {
+		_env.ep(), *this, &Sink::_handle_data_avail };
+
+	Signal_handler<Sink> _timer_handler {
+		_env.ep(), *this, &Sink::_handle_timer };
+
+	Root _root { _env, _heap, *this };
+
+	Sink(Env &env, Xml_node config) : _env(env)
+	{
+		_timer.sigh(_timer_handler);
+		_timer.trigger_periodic(period_us(config));
+
+		_env.parent().announce(_env.ep().manage(_root));
+	}
+};
+
+
+/*
+ * Stereo streams played via the mixer
+ */
+struct Test::Source
+{
+	enum { MAX_SESSIONS = 64, QUEUED = 8 };
+
+	struct Stereo
+	{
+		Audio_out::Connection _left, _right;
+
+		Stereo(Env &env)
+		:
+			_left (env, "left",  false, false),
+			_right(env, "right", false, false)
+		{
+			_left.start();
+			_right.start();
+		}
+
+		/*
+		 * Keep a few packets queued in both streams
+		 */
+		void fill(float phase)
+		{
+			while (_left.stream()->queued() < QUEUED) {
+
+				Packet *left = nullptr;
+				try { left = _left.stream()->alloc(); }
+				catch (Stream::Alloc_failed) { return; }
+
+				unsigned const pos  = _left.stream()->packet_position(left);
+				Packet  *const right = _right.stream()->get(pos);
+
+				float *l = left->content(), *r = right->content();
+				for (unsigned i = 0; i < PERIOD; i++) {
+					float const v = (float)((i + pos) % 64)/64.f - .5f;
+					l[i] = v*phase;
+					r[i] = -v*phase;
+				}
+
+				_left.submit(left);
+				_right.submit(right);
+			}
+		}
+	};
+
+	Env &_env;
+
+	Heap _heap { _env.ram(), _env.rm() };
+
+	Timer::Connection _timer { _env };
+
+	unsigned const _sessions;
+
+	Constructible<Stereo> _streams[MAX_SESSIONS];
+
+	void _handle_timer()
+	{
+		for (unsigned i = 0; i < _sessions; i++)
+			_streams[i]->fill(1.f/(float)(i + 1));
+	}
+
+	Signal_handler<Source> _timer_handler {
+		_env.ep(), *this, &Source::_handle_timer };
+
+	Source(Env &env, Xml_node config)
+	:
+		_env(env),
+		_sessions(min(config.attribute_value("sessions", 1U),
+		              (unsigned)MAX_SESSIONS))
+	{
+		for (unsigned i = 0; i < _sessions; i++)
+			_streams[i].construct(_env);
+
+		log("source: playing ", _sessions, " stereo streams");
+
+		_timer.sigh(_timer_handler);
+		_timer.trigger_periodic(period_us(config));
+	}
+};
+
+
+struct Test::Main
+{
+	Attached_rom_dataspace _config;
+
+	Constructible<Sink>   _sink   { };
+	Constructible<Source> _source { };
+
+	Main(Env &env) : _config(env, "config")
+	{
+		Xml_node const config = _config.xml();
+
+		if (config.attribute_value("role", String<16>()) == "sink")
+			_sink.construct(env, config);
+		else
+			_source.construct(env, config);
+	}
+};
+
+
+void Component::construct(Genode::Env &env) { static Test::Main main(env); }
@@ -0,0 +1,100 @@
+/*
+ * \brief  Benchmark of the startup of many components in parallel
+ * \author agent
+ * \date   2026-10-19
+ *
+ * Each instance performs the interactions with core that are typical for
+ * the startup of a component, i.e., the allocation and attachment of RAM
+ * dataspaces, the creation of region maps, threads, and signal handlers.
+ * When started in many instances at once, the duration reported by each
+ * instance reflects how well core serves concurrent requests.
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+#include <base/log.h>
+#include <base/thread.h>
+#include <base/component.h>
+#include <base/attached_rom_dataspace.h>
+#include <rm_session/connection.h>
+#include <region_map/client.h>
+#include <timer_session/connection.h>
+
+namespace Test {
+	struct Main;
+	using namespace Genode;
+}
+
+
+struct Test::Main
+{
+	Env &_env;
+
+	Timer::Connection _timer { _env };
+
+	uint64_t const _start_ms = _timer.elapsed_ms();
+
+	Attached_rom_dataspace _config { _env, "config" };
+
+	unsigned const _rounds = _config.xml().attribute_value("rounds", 16U);
+
+	enum { DS_SIZE = 16*1024, NUM_DS = 16, STACK_SIZE = 4*1024*sizeof(long) };
+
+	struct Worker : Thread
+	{
+		Worker(Env &env) : Thread(env, "worker", STACK_SIZE) { }
+
+		void entry() override { }
+	};
+
+	Signal_handler<Main> _handler { _env.ep(), *this, &Main::_handle };
+
+	void _handle() { }
+
+	/**
+	 * Allocate, attach, touch, and release RAM dataspaces
+	 */
+	void _round()
+	{
+		Ram_dataspace_capability ds[NUM_DS];
+
+		for (unsigned i = 0; i < NUM_DS; i++) {
+			ds[i] = _env.ram().alloc(DS_SIZE);
+
+			char * const ptr = _env.rm().attach(ds[i]);
+			*(char volatile *)ptr = 1;
+			_env.rm().detach(ptr);
+		}
+
+		Rm_connection rm { _env };
+		Region_map_client region_map { rm.create(NUM_DS*DS_SIZE) };
+		for (unsigned i = 0; i < NUM_DS; i++)
+			region_map.attach_at(ds[i], i*DS_SIZE);
+
+		Worker worker { _env };
+		worker.start();
+		worker.join();
+
+		Signal_context_capability const sigh = _handler;
+		Signal_transmitter(sigh).submit();
+
+		for (unsigned i = 0; i < NUM_DS; i++)
+			_env.ram().free(ds[i]);
+	}
+
+	Main(Env &env) : _env(env)
+	{
+		for (unsigned i = 0; i < _rounds; i++)
+			_round();
+
+		log("ready after ", _timer.elapsed_ms() - _start_ms, " ms");
+	}
+};
+
+
+void Component::construct(Genode::Env &env) { static Test::Main main(env); }
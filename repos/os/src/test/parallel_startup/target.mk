@@ -0,0 +1,3 @@
+TARGET = test-parallel_startup
+SRC_CC = main.cc
+LIBS   = base
@@ -0,0 +1,161 @@
+/*
+ * \brief  Benchmark of the report rate of the report-ROM service
+ * \author agent
+ * \date   2026-10-19
+ *
+ * A single reporter submits a series of reports to a module read by a
+ * varying number of ROM clients. The next report is submitted as soon as
+ * all readers have observed the previous one.
+ */
+
+/*
+ * Copyright (C) 2026 Genode Labs GmbH
+ *
+ * This file is part of the Genode OS framework, which is distributed
+ * under the terms of the GNU Affero General Public License version 3.
+ */
+
+#include <base/log.h>
+#include <base/heap.h>
+#include <base/registry.h>
+#include <base/component.h>
+#include <base/attached_rom_dataspace.h>
+#include <base/attached_ram_dataspace.h>
+#include <os/reporter.h>
+#include <timer_session/connection.h>
+
+namespace Test {
+	struct Reader;
+	struct Main;
+	using namespace Genode;
+}
+
+
+struct Test::Reader
+{
+	Attached_rom_dataspace _rom;
+
+	Signal_handler<Reader> _handler;
+
+	Signal_context_capability _sigh;
+
+	unsigned _seen = 0;
+
+	void _handle_update()
+	{
+		_rom.update();
+
+		_seen = _rom.valid() ? *_rom.local_addr<unsigned const>() : 0;
+
+		Signal_transmitter(_sigh).submit();
+	}
+
+	Reader(Env &env, Signal_context_capability sigh)
+	:
+		_rom(env, "state"),
+		_handler(env.ep(), *this, &Reader::_handle_update),
+		_sigh(sigh)
+	{
+		_rom.sigh(_handler);
+	}
+
+	unsigned seen() const { return _seen; }
+};
+
+
+struct Test::Main
+{
+	Env &_env;
+
+	Attached_rom_dataspace _config { _env, "config" };
+
+	Heap _heap { _env.ram(), _env.rm() };
+
+	Timer::Connection _timer { _env };
+
+	size_t   const _size    = _config.xml().attribute_value("size", Number_of_bytes(64*1024));
+	unsigned const _reports = _config.xml().attribute_value("reports", 500U);
+	unsigned const _max_readers =
+		_config.xml().attribute_value("max_readers", 64U);
+
+	Reporter _reporter { _env, "state", "state", _size };
+
+	Registry<Registered_no_delete<Reader> > _readers { };
+
+	unsigned _num_readers = 1;
+	unsigned _seq         = 0;
+
+	unsigned long _start_ms = 0;
+
+	Attached_ram_dataspace _content { _env.ram(), _env.rm(), _size };
+
+	void _submit()
+	{
+		_seq++;
+		memcpy(_content.local_addr<char>(), &_seq, sizeof(_seq));
+		_reporter.report(_content.local_addr<char const>(), _size);
+	}
+
+	void _start_round()
+	{
+		for (unsigned i = 0; i < _num_readers; i++)
+			new (_heap) Registered_no_delete<Reader>(_readers, _env, _reader_handler);
+
+		_seq      = 0;
+		_start_ms = _timer.elapsed_ms();
+		_submit();
+	}
+
+	void _finish_round()
+	{
+		unsigned long const ms = max(_timer.elapsed_ms() - _start_ms, 1UL);
+
+		log("readers=", _num_readers, " reports=", _reports, " size=",
+		    _size, " duration=", ms, " ms rate=",
+		    (unsigned long)_reports*1000/ms, " reports/s");
+
+		_readers.for_each([&] (Registered_no_delete<Reader> &reader) {
+			destroy(_heap, &reader); });
+	}
+
+	void _handle_reader()
+	{
+		bool all_seen = true;
+		_readers.for_each([&] (Reader const &reader) {
+			if (reader.seen() != _seq)
+				all_seen = false; });
+
+		if (!all_seen)
+			return;
+
+		if (_seq < _reports) {
+			_submit();
+			return;
+		}
+
+		_finish_round();
+
+		_num_readers *= 2;
+		if (_num_readers > _max_readers) {
+			log("--- test-report_rom_bench finished ---");
+			_env.parent().exit(0);
+			return;
+		}
+
+		_start_round();
+	}
+
+	Signal_handler<Main> _reader_handler {
+		_env.ep(), *this, &Main::_handle_reader };
+
+	Main(Env &env) : _env(env)
+	{
+		log("--- test-report_rom_bench started ---");
+
+		_reporter.enabled(true);
+		_start_round();
+	}
+};
+
+
+void Component::construct(Genode::Env &env) { static Test::Main main(env); }
@@ -509,6 +509,133 @@ struct Unlink_test : public Stress_test
 	}
 };
 
+
+/*
+ * Benchmark of metadata operations on a single large directory
+ *
+ * The test creates, stats, reads, and unlinks a configurable number of
+ * files within one directory, which stresses the lookup of directory
+ * entries by name and the sequential reading of directories.
+ */
+struct Metadata_test : public Stress_test
+{
+	Genode::Entrypoint &_ep;
+	Timer::Connection  &_timer;
+
+	unsigned const _num_files;
+
+	char _file_path[Vfs::MAX_PATH_LEN];
+
+	char const *_file(unsigned i)
+	{
+		snprintf(_file_path, sizeof(_file_path), "%s/file_%u", path.base(), i);
+		return _file_path;
+	}
+
+	template <typename FN>
+	void _measure(char const *op, FN const &fn)
+	{
+		uint64_t const start_ms = _timer.elapsed_ms();
+
+		for (unsigned i = 0; i < _num_files; i++) {
+			fn(i);
+			++count;
+		}
+
+		uint64_t const elapsed_ms = _timer.elapsed_ms() - start_ms;
+
+		log(op, " ", _num_files, " files in ", elapsed_ms, "ms, ",
+		    (elapsed_ms*1000)/_num_files, "μs/op");
+	}
+
+	void _create(unsigned i)
+	{
+		Vfs::Vfs_handle *handle = nullptr;
+		assert_open(vfs.open(_file(i), Vfs::Directory_service::OPEN_MODE_CREATE,
+		                     &handle, alloc));
+		handle->close();
+	}
+
+	void _stat(unsigned i)
+	{
+		Vfs::Directory_service::Stat stat;
+		if (vfs.stat(_file(i), stat) != Vfs::Directory_service::STAT_OK) {
+			error("stat of ", Cstring(_file_path), " failed");
+			throw Exception();
+		}
+	}
+
+	Vfs::Directory_service::Dirent _read_dirent(Vfs::Vfs_handle &dir_handle,
+	                                            unsigned i)
+	{
+		Vfs::Directory_service::Dirent dirent;
+		Vfs::file_size out_count = 0;
+
+		dir_handle.seek(i * sizeof(dirent));
+		dir_handle.fs().queue_read(&dir_handle, sizeof(dirent));
+
+		Vfs::File_io_service::Read_result read_result;
+
+		while ((read_result =
+		        dir_handle.fs().complete_read(&dir_handle, (char*)&dirent,
+		                                      sizeof(dirent), out_count)) ==
+		       Vfs::File_io_service::READ_QUEUED)
+			_ep.wait_and_dispatch_one_io_signal();
+
+		assert_read(read_result);
+		return dirent;
+	}
+
+	void _unlink(unsigned i)
+	{
+		assert_unlink(vfs.unlink(_file(i)));
+	}
+
+	Metadata_test(Vfs::File_system &vfs, Genode::Allocator &alloc,
+	              char const *parent, Genode::Entrypoint &ep,
+	              Timer::Connection &timer, unsigned num_files)
+	:
+		Stress_test(vfs, alloc, parent), _ep(ep), _timer(timer),
+		_num_files(num_files)
+	{
+		try {
+			{
+				Vfs::Vfs_handle *dir_handle = nullptr;
+				assert_opendir(vfs.opendir(path.base(), true, &dir_handle, alloc));
+				Vfs::Vfs_handle::Guard guard(dir_handle);
+
+				_measure	("created", [&] (unsigned i) { _create(i); });
+				_measure("stat'ed", [&] (unsigned i) { _stat(i); });
+
+				_measure("read", [&] (unsigned i) {
+					if (_read_dirent(*dir_handle, i).type ==
+					    Vfs::Directory_service::DIRENT_TYPE_END) {
+						error("reached the end of ", path, " prematurely");
+						throw Exception();
+					}
+				});
+
+				if (_read_dirent(*dir_handle, _num_files).type !=
+				    Vfs::Directory_service::DIRENT_TYPE_END) {
+					error("unexpected entries in ", path);
+					throw Exception();
+				}
+			}
+
+			_measure("unlinked", [&] (unsigned i) { _unlink(i); });
+			assert_unlink(vfs.unlink(path.base()));
+		} catch (...) {
+			error("failed at ", path, " after ", count, " operations");
+		}
+	}
+
+	Vfs::file_size wait()
+	{
+		return count;
+	}
+};
+
+
 void die(Genode::Env &env, int code) { env.parent().exit(code); }
 
 void Component::construct(Genode::Env &env)
@@ -549,6 +676,20 @@ void Component::construct(Genode::Env &env)
 
 	size_t initial_consumption = env.pd().used_ram().value;
 
+	/************************
+	 ** Metadata benchmark **
+	 ************************/
+
+	if (unsigned const num_files = config_xml.attribute_value("metadata", 0U)) {
+		log("metadata operations...");
+
+		Metadata_test test(vfs_root, heap, "/metadata", env.ep(), timer, num_files);
+		if (test.wait() != 4*num_files)
+			return die(env, -1);
+
+		vfs_root_sync();
+	}
+
 	/**************************
 	 ** Generate directories **
 	 **************************/